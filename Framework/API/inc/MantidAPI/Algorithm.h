@@ -344,6 +344,10 @@ protected:
 
   /// Return a reference to the algorithm's notification dispatcher
   Poco::NotificationCenter &notificationCenter() const;
+  /// True if any observer is registered with the notification dispatcher
+  bool isObserved() const;
+  /// Post a notification, taking ownership of it, if the algorithm is observed
+  void postNotification(Poco::Notification *notification) const;
 
   /// Observation slot for child algorithm progress notification messages, these
   /// are scaled and then signalled for this algorithm.
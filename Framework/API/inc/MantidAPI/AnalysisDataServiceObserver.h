@@ -12,6 +12,11 @@
 #include "MantidKernel/DataService.h"
 #include <Poco/NObserver.h>
 
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
 using namespace Mantid::Kernel;
 using namespace Mantid::API;
 
@@ -34,6 +39,13 @@ namespace API {
  *
  * This works in both C++ and Python, some functionality is limited in
  * python, but the handlers will all be called.
+ *
+ * Calling batchNotifications() holds back the changes that a thread makes
+ * inside a notification batch, e.g. while a top-level algorithm runs on it,
+ * and delivers them when the batch ends with a single call to
+ * anyChangeHandle. Workspaces that were added and then deleted within the
+ * batch are not reported at all. The workspace passed to deleteHandle for a
+ * held back deletion is null, as it is not kept alive until the batch ends.
  */
 
 class MANTID_API_DLL AnalysisDataServiceObserver {
@@ -50,6 +62,7 @@ public:
   void observeGroup(bool turnOn = true);
   void observeUnGroup(bool turnOn = true);
   void observeGroupUpdate(bool turnOn = true);
+  void batchNotifications(bool turnOn = true);
 
   virtual void anyChangeHandle();
   virtual void addHandle(const std::string &wsName, const Workspace_sptr &ws);
@@ -67,6 +80,34 @@ public:
                                  const Workspace_sptr &ws);
 
 private:
+  /// A change to the ADS held back until the end of a notification batch
+  struct PendingChange {
+    enum class Kind {
+      Add,
+      Replace,
+      Delete,
+      Clear,
+      Rename,
+      Group,
+      UnGroup,
+      GroupUpdate
+    };
+    Kind kind;
+    std::string name;
+    std::string newName;
+    Workspace_sptr workspace;
+  };
+
+  void notifyChange(PendingChange change);
+  bool deferChange(PendingChange &change);
+  void deliverChanges(std::vector<PendingChange> changes);
+  void dispatchChange(const PendingChange &change);
+
+  bool m_batching{false};
+  /// The changes held back for each thread that is in a batch
+  std::map<std::thread::id, std::vector<PendingChange>> m_pendingChanges;
+  std::mutex m_pendingMutex;
+
   bool m_observingAdd{false}, m_observingReplace{false},
       m_observingDelete{false}, m_observingClear{false},
       m_observingRename{false}, m_observingGroup{false},
@@ -92,6 +133,8 @@ private:
   void _groupUpdateHandle(
       const Poco::AutoPtr<AnalysisDataServiceImpl::GroupUpdatedNotification>
           &pNf);
+  void _batchEndHandle(
+      const Poco::AutoPtr<AnalysisDataServiceImpl::BatchEndNotification> &pNf);
 
   /// Poco::NObserver for AddNotification.
   Poco::NObserver<AnalysisDataServiceObserver,
@@ -132,6 +175,11 @@ private:
   Poco::NObserver<AnalysisDataServiceObserver,
                   AnalysisDataServiceImpl::GroupUpdatedNotification>
       m_groupUpdatedObserver;
+
+  /// Poco::NObserver for BatchEndNotification
+  Poco::NObserver<AnalysisDataServiceObserver,
+                  AnalysisDataServiceImpl::BatchEndNotification>
+      m_batchEndObserver;
 };
 
 } // namespace API
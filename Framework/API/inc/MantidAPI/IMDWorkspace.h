@@ -44,6 +44,10 @@ public:
       const Parallel::StorageMode storageMode = Parallel::StorageMode::Cloned);
   IMDWorkspace &operator=(const IMDWorkspace &other) = delete;
 
+  /// MD workspaces have no IndexInfo to carry the storage mode, so algorithms
+  /// running in MPI mode set it on their outputs directly
+  using Workspace::setStorageMode;
+
   /**
    * Holds X, Y, E for a line plot
    */
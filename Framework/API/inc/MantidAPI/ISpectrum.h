@@ -117,18 +117,20 @@ public:
     mutableHistogramRef().convertToFrequencies();
   }
 
-  HistogramData::BinEdges binEdges() const { return histogramRef().binEdges(); }
-  HistogramData::Points points() const { return histogramRef().points(); }
+  HistogramData::BinEdges binEdges() const {
+    return histogramXRef().binEdges();
+  }
+  HistogramData::Points points() const { return histogramXRef().points(); }
   HistogramData::PointStandardDeviations pointStandardDeviations() const {
     return histogramRef().pointStandardDeviations();
   }
   template <typename... T> void setBinEdges(T &&... data) & {
-    mutableHistogramRef().setBinEdges(std::forward<T>(data)...);
+    mutableHistogramXRef().setBinEdges(std::forward<T>(data)...);
   }
   template <typename... T> void setPoints(T &&... data) & {
     // Check for the special case EventList, it only works with BinEdges.
     checkWorksWithPoints();
-    mutableHistogramRef().setPoints(std::forward<T>(data)...);
+    mutableHistogramXRef().setPoints(std::forward<T>(data)...);
   }
   template <typename... T> void setPointVariances(T &&... data) & {
     // Note that we can set point variances even if storage mode is BinEdges, Dx
@@ -184,7 +186,7 @@ public:
     mutableHistogramRef().setFrequencyStandardDeviations(
         std::forward<T>(data)...);
   }
-  const HistogramData::HistogramX &x() const { return histogramRef().x(); }
+  const HistogramData::HistogramX &x() const { return histogramXRef().x(); }
   virtual const HistogramData::HistogramY &y() const {
     return histogramRef().y();
   }
@@ -193,7 +195,7 @@ public:
   }
   const HistogramData::HistogramDx &dx() const { return histogramRef().dx(); }
   HistogramData::HistogramX &mutableX() & {
-    return mutableHistogramRef().mutableX();
+    return mutableHistogramXRef().mutableX();
   }
   HistogramData::HistogramDx &mutableDx() & {
     return mutableHistogramRef().mutableDx();
@@ -207,7 +209,7 @@ public:
     return mutableHistogramRef().mutableE();
   }
   Kernel::cow_ptr<HistogramData::HistogramX> sharedX() const {
-    return histogramRef().sharedX();
+    return histogramXRef().sharedX();
   }
   virtual Kernel::cow_ptr<HistogramData::HistogramY> sharedY() const {
     return histogramRef().sharedY();
@@ -219,7 +221,7 @@ public:
     return histogramRef().sharedDx();
   }
   void setSharedX(const Kernel::cow_ptr<HistogramData::HistogramX> &x) & {
-    mutableHistogramRef().setSharedX(x);
+    mutableHistogramXRef().setSharedX(x);
   }
   void setSharedDx(const Kernel::cow_ptr<HistogramData::HistogramDx> &dx) & {
     mutableHistogramRef().setSharedDx(dx);
@@ -243,6 +245,15 @@ protected:
   virtual void checkAndSanitizeHistogram(HistogramData::Histogram &){};
   virtual void checkWorksWithPoints() const {}
   virtual void checkIsYAndEWritable() const {}
+  /// The histogram for reading its X data only. Spectra that provide their
+  /// data on demand may skip the Y and E data here.
+  virtual const HistogramData::Histogram &histogramXRef() const {
+    return histogramRef();
+  }
+  /// The histogram for modifying its X data only.
+  virtual HistogramData::Histogram &mutableHistogramXRef() {
+    return mutableHistogramRef();
+  }
 
   // Copy and move are not public since this is an abstract class, but protected
   // such that derived classes can implement copy and move.
@@ -83,10 +83,21 @@ public:
     return attName == "domains";
   }
 
+  /// Evaluate the member functions concurrently
+  void setParallel(bool on) { m_parallel = on; }
+  /// Check if the member functions are evaluated concurrently
+  bool isParallel() const { return m_parallel; }
+
 protected:
   /// Counts number of the domains
   void countNumberOfDomains();
   void countValueOffsets(const CompositeDomain &domain) const;
+  /// Evaluate the member functions concurrently
+  void functionParallel(const CompositeDomain &domain,
+                        FunctionValues &values) const;
+  /// Evaluate the member function derivatives concurrently
+  void functionDerivParallel(const CompositeDomain &domain,
+                             Jacobian &jacobian);
 
   /// Domain index map: finction -> domain
   std::map<size_t, std::vector<size_t>> m_domains;
@@ -96,6 +107,8 @@ protected:
   /// Maximum domain index
   size_t m_maxIndex;
   mutable std::vector<size_t> m_valueOffsets;
+  /// Flag to evaluate the member functions concurrently
+  bool m_parallel;
 };
 
 } // namespace API
@@ -206,7 +206,9 @@ void Algorithm::removeObserver(const Poco::AbstractObserver &observer) const {
  */
 void Algorithm::progress(double p, const std::string &msg, double estimatedTime,
                          int progressPrecision) {
-  notificationCenter().postNotification(
+  if (!isObserved())
+    return;
+  postNotification(
       new ProgressNotification(this, p, msg, estimatedTime, progressPrecision));
 }
 
@@ -490,6 +492,14 @@ void Algorithm::unlockWorkspaces() {
 
 bool Algorithm::executeInternal() {
   Timer timer;
+  // Changes to the ADS made by a top-level algorithm, including those of any
+  // algorithms it runs, form one batch for observers that coalesce them.
+  // Asynchronous algorithms, such as MonitorLiveData, may run indefinitely,
+  // so their changes are not held back.
+  std::unique_ptr<AnalysisDataServiceImpl::NotificationBatch> adsBatch;
+  if (!isChild() && !m_runningAsync)
+    adsBatch = std::make_unique<AnalysisDataServiceImpl::NotificationBatch>(
+        AnalysisDataService::Instance());
   AlgorithmManager::Instance().notifyAlgorithmStarting(this->getAlgorithmID());
   {
     auto *depo = dynamic_cast<DeprecatedAlgorithm *>(this);
@@ -497,7 +507,7 @@ bool Algorithm::executeInternal() {
       getLogger().error(depo->deprecationMsg(this));
   }
 
-  notificationCenter().postNotification(new StartedNotification(this));
+  postNotification(new StartedNotification(this));
   Mantid::Types::Core::DateAndTime startTime;
 
   // Return a failure if the algorithm hasn't been initialized
@@ -524,7 +534,7 @@ bool Algorithm::executeInternal() {
     }
     // Try the validation again
     if (!validateProperties()) {
-      notificationCenter().postNotification(
+      postNotification(
           new ErrorNotification(this, "Some invalid Properties found"));
       throw std::runtime_error("Some invalid Properties found");
     }
@@ -546,8 +556,7 @@ bool Algorithm::executeInternal() {
     getLogger().error() << "Error in execution of algorithm " << this->name()
                         << "\n"
                         << ex.what() << "\n";
-    notificationCenter().postNotification(
-        new ErrorNotification(this, ex.what()));
+    postNotification(new ErrorNotification(this, ex.what()));
     m_running = false;
     if (m_isChildAlgorithm || m_runningAsync || m_rethrow) {
       m_runningAsync = false;
@@ -583,7 +592,7 @@ bool Algorithm::executeInternal() {
       }
       // Throw because something was invalid
       if (numErrors > 0) {
-        notificationCenter().postNotification(
+        postNotification(
             new ErrorNotification(this, "Some invalid Properties found"));
         throw std::runtime_error("Some invalid Properties found");
       }
@@ -649,14 +658,15 @@ bool Algorithm::executeInternal() {
       setExecuted(true);
 
       // Log that execution has completed.
-      getLogger().debug(
-          "Time to validate properties: " +
-          std::to_string(timingPropertyValidation) + " seconds\n" +
-          "Time for other input validation: " +
-          std::to_string(timingInputValidation) + " seconds\n" +
-          "Time for other initialization: " + std::to_string(timingInit) +
-          " seconds\n" + "Time to run exec: " + std::to_string(timingExec) +
-          " seconds\n");
+      if (getLogger().is(Logger::Priority::PRIO_DEBUG))
+        getLogger().debug(
+            "Time to validate properties: " +
+            std::to_string(timingPropertyValidation) + " seconds\n" +
+            "Time for other input validation: " +
+            std::to_string(timingInputValidation) + " seconds\n" +
+            "Time for other initialization: " + std::to_string(timingInit) +
+            " seconds\n" + "Time to run exec: " + std::to_string(timingExec) +
+            " seconds\n");
       reportCompleted(duration);
     } catch (std::runtime_error &ex) {
       this->unlockWorkspaces();
@@ -667,8 +677,7 @@ bool Algorithm::executeInternal() {
             << "Error in execution of algorithm " << this->name() << '\n'
             << ex.what() << '\n';
       }
-      notificationCenter().postNotification(
-          new ErrorNotification(this, ex.what()));
+      postNotification(new ErrorNotification(this, ex.what()));
       m_running = false;
     } catch (std::logic_error &ex) {
       this->unlockWorkspaces();
@@ -679,16 +688,14 @@ bool Algorithm::executeInternal() {
             << "Logic Error in execution of algorithm " << this->name() << '\n'
             << ex.what() << '\n';
       }
-      notificationCenter().postNotification(
-          new ErrorNotification(this, ex.what()));
+      postNotification(new ErrorNotification(this, ex.what()));
       m_running = false;
     }
   } catch (CancelException &ex) {
     m_runningAsync = false;
     m_running = false;
     getLogger().error() << this->name() << ": Execution terminated by user.\n";
-    notificationCenter().postNotification(
-        new ErrorNotification(this, ex.what()));
+    postNotification(new ErrorNotification(this, ex.what()));
     this->unlockWorkspaces();
     throw;
   }
@@ -698,8 +705,7 @@ bool Algorithm::executeInternal() {
     m_runningAsync = false;
     m_running = false;
 
-    notificationCenter().postNotification(
-        new ErrorNotification(this, ex.what()));
+    postNotification(new ErrorNotification(this, ex.what()));
     getLogger().error() << "Error in execution of algorithm " << this->name()
                         << ":\n"
                         << ex.what() << "\n";
@@ -713,7 +719,7 @@ bool Algorithm::executeInternal() {
     m_runningAsync = false;
     m_running = false;
 
-    notificationCenter().postNotification(
+    postNotification(
         new ErrorNotification(this, "UNKNOWN Exception is caught in exec()"));
     getLogger().error() << this->name()
                         << ": UNKNOWN Exception is caught in exec()\n";
@@ -724,8 +730,7 @@ bool Algorithm::executeInternal() {
   // Unlock the locked workspaces
   this->unlockWorkspaces();
 
-  notificationCenter().postNotification(
-      new FinishedNotification(this, isExecuted()));
+  postNotification(new FinishedNotification(this, isExecuted()));
   // Only gets to here if algorithm ended normally
   return isExecuted();
 }
@@ -1278,14 +1283,13 @@ bool Algorithm::doCallProcessGroups(
     setExecuted(false);
     m_runningAsync = false;
     m_running = false;
-    notificationCenter().postNotification(
-        new ErrorNotification(this, ex.what()));
+    postNotification(new ErrorNotification(this, ex.what()));
     throw;
   } catch (...) {
     setExecuted(false);
     m_runningAsync = false;
     m_running = false;
-    notificationCenter().postNotification(new ErrorNotification(
+    postNotification(new ErrorNotification(
         this, "UNKNOWN Exception caught from processGroups"));
     throw;
   }
@@ -1316,8 +1320,7 @@ bool Algorithm::doCallProcessGroups(
   }
 
   setExecuted(completed);
-  notificationCenter().postNotification(
-      new FinishedNotification(this, isExecuted()));
+  postNotification(new FinishedNotification(this, isExecuted()));
 
   return completed;
 }
@@ -1633,6 +1636,22 @@ Poco::NotificationCenter &Algorithm::notificationCenter() const {
   return *m_notificationCenter;
 }
 
+/// @return True if an observer has been added to the notification dispatcher
+bool Algorithm::isObserved() const {
+  return m_notificationCenter && m_notificationCenter->hasObservers();
+}
+
+/** Post a notification to the observers of this algorithm. Nothing is
+ * dispatched, and the dispatcher is not created, when nothing observes the
+ * algorithm, which is the usual case for child algorithms.
+ * @param notification :: The notification, which is owned by this call
+ */
+void Algorithm::postNotification(Poco::Notification *notification) const {
+  Poco::Notification::Ptr owned(notification);
+  if (isObserved())
+    m_notificationCenter->postNotification(owned);
+}
+
 /** Handles and rescales child algorithm progress notifications.
  *  @param pNf :: The progress notification from the child algorithm.
  */
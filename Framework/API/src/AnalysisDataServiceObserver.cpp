@@ -7,6 +7,8 @@
 
 #include "MantidAPI/AnalysisDataServiceObserver.h"
 
+#include <algorithm>
+
 namespace {
 template <typename Observer>
 void modifyObserver(const bool turnOn, bool &isObserving, Observer &observer) {
@@ -31,12 +33,16 @@ AnalysisDataServiceObserver::AnalysisDataServiceObserver()
       m_groupObserver(*this, &AnalysisDataServiceObserver::_groupHandle),
       m_unGroupObserver(*this, &AnalysisDataServiceObserver::_unGroupHandle),
       m_groupUpdatedObserver(*this,
-                             &AnalysisDataServiceObserver::_groupUpdateHandle) {
+                             &AnalysisDataServiceObserver::_groupUpdateHandle),
+      m_batchEndObserver(*this, &AnalysisDataServiceObserver::_batchEndHandle) {
 }
 
 AnalysisDataServiceObserver::~AnalysisDataServiceObserver() {
   // Turn off/remove all observers
   this->observeAll(false);
+  // Held back changes are dropped: the handlers of a derived class can no
+  // longer be called
+  modifyObserver(false, m_batching, m_batchEndObserver);
 }
 
 // ------------------------------------------------------------
@@ -148,6 +154,28 @@ void AnalysisDataServiceObserver::observeGroupUpdate(bool turnOn) {
   modifyObserver(turnOn, m_observingGroupUpdate, m_groupUpdatedObserver);
 }
 
+/**
+ * @brief Function will turn on/off holding back the changes a thread makes
+ * while it is inside a notification batch of the ADS. The changes are
+ * delivered, after a single call to anyChangeHandle, when the batch ends.
+ * Turning it off delivers any changes that are held back.
+ *
+ * @param turnOn bool; if this is True then changes are batched, otherwise
+ * they are delivered as they happen.
+ */
+void AnalysisDataServiceObserver::batchNotifications(bool turnOn) {
+  modifyObserver(turnOn, m_batching, m_batchEndObserver);
+  if (turnOn)
+    return;
+  std::map<std::thread::id, std::vector<PendingChange>> pending;
+  {
+    std::lock_guard<std::mutex> lock(m_pendingMutex);
+    pending.swap(m_pendingChanges);
+  }
+  for (auto &changes : pending)
+    this->deliverChanges(std::move(changes.second));
+}
+
 // ------------------------------------------------------------
 // Virtual Methods
 // ------------------------------------------------------------
@@ -260,55 +288,176 @@ void AnalysisDataServiceObserver::groupUpdateHandle(const std::string &wsName,
 // ------------------------------------------------------------
 void AnalysisDataServiceObserver::_addHandle(
     const Poco::AutoPtr<AnalysisDataServiceImpl::AddNotification> &pNf) {
-  this->anyChangeHandle();
-  this->addHandle(pNf->objectName(), pNf->object());
+  this->notifyChange({PendingChange::Kind::Add, pNf->objectName(), "",
+                      pNf->object()});
 }
 
 void AnalysisDataServiceObserver::_replaceHandle(
     const Poco::AutoPtr<AnalysisDataServiceImpl::AfterReplaceNotification>
         &pNf) {
-  this->anyChangeHandle();
-  this->replaceHandle(pNf->objectName(), pNf->object());
+  this->notifyChange({PendingChange::Kind::Replace, pNf->objectName(), "",
+                      pNf->object()});
 }
 
 void AnalysisDataServiceObserver::_deleteHandle(
     const Poco::AutoPtr<AnalysisDataServiceImpl::PreDeleteNotification> &pNf) {
-  this->anyChangeHandle();
-  this->deleteHandle(pNf->objectName(), pNf->object());
+  this->notifyChange({PendingChange::Kind::Delete, pNf->objectName(), "",
+                      pNf->object()});
 }
 
 void AnalysisDataServiceObserver::_clearHandle(
     const Poco::AutoPtr<AnalysisDataServiceImpl::ClearNotification> &pNf) {
   UNUSED_ARG(pNf)
-  this->anyChangeHandle();
-  this->clearHandle();
+  this->notifyChange({PendingChange::Kind::Clear, "", "", nullptr});
 }
 
 void AnalysisDataServiceObserver::_renameHandle(
     const Poco::AutoPtr<AnalysisDataServiceImpl::RenameNotification> &pNf) {
-  this->anyChangeHandle();
-  this->renameHandle(pNf->objectName(), pNf->newObjectName());
+  this->notifyChange({PendingChange::Kind::Rename, pNf->objectName(),
+                      pNf->newObjectName(), nullptr});
 }
 
 void AnalysisDataServiceObserver::_groupHandle(
     const Poco::AutoPtr<AnalysisDataServiceImpl::GroupWorkspacesNotification>
         &pNf) {
-  this->anyChangeHandle();
-  this->groupHandle(pNf->objectName(), pNf->object());
+  this->notifyChange({PendingChange::Kind::Group, pNf->objectName(), "",
+                      pNf->object()});
 }
 
 void AnalysisDataServiceObserver::_unGroupHandle(
     const Poco::AutoPtr<
         AnalysisDataServiceImpl::UnGroupingWorkspaceNotification> &pNf) {
-  this->anyChangeHandle();
-  this->unGroupHandle(pNf->objectName(), pNf->object());
+  this->notifyChange({PendingChange::Kind::UnGroup, pNf->objectName(), "",
+                      pNf->object()});
 }
 
 void AnalysisDataServiceObserver::_groupUpdateHandle(
     const Poco::AutoPtr<AnalysisDataServiceImpl::GroupUpdatedNotification>
         &pNf) {
+  this->notifyChange({PendingChange::Kind::GroupUpdate, pNf->objectName(), "",
+                      pNf->object()});
+}
+
+void AnalysisDataServiceObserver::_batchEndHandle(
+    const Poco::AutoPtr<AnalysisDataServiceImpl::BatchEndNotification> &pNf) {
+  UNUSED_ARG(pNf)
+  // The batch ends on the thread that made the changes
+  std::vector<PendingChange> changes;
+  {
+    std::lock_guard<std::mutex> lock(m_pendingMutex);
+    auto pending = m_pendingChanges.find(std::this_thread::get_id());
+    if (pending == m_pendingChanges.end())
+      return;
+    changes.swap(pending->second);
+    m_pendingChanges.erase(pending);
+  }
+  this->deliverChanges(std::move(changes));
+}
+
+/**
+ * Deliver a change to the handlers now, or hold it back until the end of the
+ * current notification batch.
+ * @param change :: The change made to the ADS
+ */
+void AnalysisDataServiceObserver::notifyChange(PendingChange change) {
+  if (this->deferChange(change))
+    return;
+  this->anyChangeHandle();
+  this->dispatchChange(change);
+}
+
+/**
+ * Hold back a change if batching and the calling thread, which made the
+ * change, is inside a notification batch of the ADS. The change is merged
+ * with those the thread already held back for the same workspace: replacing
+ * a held back workspace updates the earlier change and deleting a workspace
+ * added within the batch removes every change to it. Deleted workspaces are
+ * not kept alive until the end of the batch.
+ * @param change :: The change made to the ADS
+ * @return True if the change has been held back or merged
+ */
+bool AnalysisDataServiceObserver::deferChange(PendingChange &change) {
+  using Kind = PendingChange::Kind;
+  if (!m_batching || !AnalysisDataService::Instance().isBatching())
+    return false;
+  {
+    std::lock_guard<std::mutex> lock(m_pendingMutex);
+    auto &pending = m_pendingChanges[std::this_thread::get_id()];
+    if (change.kind == Kind::Delete) {
+      change.workspace.reset();
+      for (auto &p : pending)
+        if (p.name == change.name)
+          p.workspace.reset();
+    }
+    // The last change held back that concerns the same workspace
+    auto last = std::find_if(
+        pending.rbegin(), pending.rend(), [&change](const PendingChange &p) {
+          return p.kind == Kind::Clear || p.name == change.name ||
+                 (p.kind == Kind::Rename && p.newName == change.name);
+        });
+    const bool found = last != pending.rend() && last->name == change.name;
+    if (change.kind == Kind::Clear) {
+      pending.clear();
+      pending.emplace_back(std::move(change));
+    } else if (change.kind == Kind::Replace && found &&
+               (last->kind == Kind::Add || last->kind == Kind::Replace)) {
+      last->workspace = std::move(change.workspace);
+    } else if (change.kind == Kind::Delete && found &&
+               last->kind == Kind::Add) {
+      pending.erase(std::next(last).base());
+    } else {
+      pending.emplace_back(std::move(change));
+    }
+  }
+  return true;
+}
+
+/**
+ * Deliver changes that were held back, if there are any, after a single call
+ * to anyChangeHandle.
+ * @param changes :: The changes held back for one thread
+ */
+void AnalysisDataServiceObserver::deliverChanges(
+    std::vector<PendingChange> changes) {
+  if (changes.empty())
+    return;
   this->anyChangeHandle();
-  this->groupUpdateHandle(pNf->objectName(), pNf->object());
+  for (const auto &change : changes)
+    this->dispatchChange(change);
+}
+
+/**
+ * Call the handler for a single change.
+ * @param change :: The change made to the ADS
+ */
+void AnalysisDataServiceObserver::dispatchChange(const PendingChange &change) {
+  using Kind = PendingChange::Kind;
+  switch (change.kind) {
+  case Kind::Add:
+    this->addHandle(change.name, change.workspace);
+    break;
+  case Kind::Replace:
+    this->replaceHandle(change.name, change.workspace);
+    break;
+  case Kind::Delete:
+    this->deleteHandle(change.name, change.workspace);
+    break;
+  case Kind::Clear:
+    this->clearHandle();
+    break;
+  case Kind::Rename:
+    this->renameHandle(change.name, change.newName);
+    break;
+  case Kind::Group:
+    this->groupHandle(change.name, change.workspace);
+    break;
+  case Kind::UnGroup:
+    this->unGroupHandle(change.name, change.workspace);
+    break;
+  case Kind::GroupUpdate:
+    this->groupUpdateHandle(change.name, change.workspace);
+    break;
+  }
 }
 
 } // namespace API
@@ -128,6 +128,7 @@ ExperimentInfo::~ExperimentInfo() = default;
  * @param other :: the source from which to copy ExperimentInfo
  */
 void ExperimentInfo::copyExperimentInfoFrom(const ExperimentInfo *other) {
+  other->populateIfNotLoaded();
   m_sample = other->m_sample;
   m_run = other->m_run;
   this->setInstrument(other->getInstrument());
@@ -1038,18 +1038,19 @@ void MatrixWorkspace::setDistribution(bool newValue) {
  *  @return whether the workspace contains histogram data
  */
 bool MatrixWorkspace::isHistogramData() const {
-  // all spectra *should* have the same behavior
-  bool isHist = (x(0).size() != y(0).size());
+  // all spectra *should* have the same behavior. Checked on a copy of the
+  // histogram, which spectra that store their data elsewhere can provide
+  // without moving it.
+  const auto histogram = getSpectrum(0).histogram();
+  bool isHist = (histogram.x().size() != histogram.y().size());
   // TODOHIST temporary sanity check
   if (isHist) {
-    if (getSpectrum(0).histogram().xMode() !=
-        HistogramData::Histogram::XMode::BinEdges) {
+    if (histogram.xMode() != HistogramData::Histogram::XMode::BinEdges) {
       throw std::logic_error("In MatrixWorkspace::isHistogramData(): "
                              "Histogram::Xmode is not BinEdges");
     }
   } else {
-    if (getSpectrum(0).histogram().xMode() !=
-        HistogramData::Histogram::XMode::Points) {
+    if (histogram.xMode() != HistogramData::Histogram::XMode::Points) {
       throw std::logic_error("In MatrixWorkspace::isHistogramData(): "
                              "Histogram::Xmode is not Points");
     }
@@ -11,8 +11,11 @@
 #include "MantidAPI/CompositeDomain.h"
 #include "MantidAPI/Expression.h"
 #include "MantidAPI/FunctionFactory.h"
+#include "MantidKernel/ConfigService.h"
+#include "MantidKernel/MultiThreaded.h"
 
 #include <boost/lexical_cast.hpp>
+#include <exception>
 #include <set>
 
 namespace Mantid {
@@ -20,8 +23,13 @@ namespace API {
 
 DECLARE_FUNCTION(MultiDomainFunction)
 
-MultiDomainFunction::MultiDomainFunction() : m_nDomains(0), m_maxIndex(0) {
+MultiDomainFunction::MultiDomainFunction()
+    : m_nDomains(0), m_maxIndex(0), m_parallel(false) {
   setAttributeValue("NumDeriv", true);
+  auto parallel = Kernel::ConfigService::Instance().getValue<bool>(
+      "curvefitting.parallelMultiDomain");
+  if (parallel.is_initialized())
+    m_parallel = parallel.get();
 }
 
 /**
@@ -138,6 +146,10 @@ void MultiDomainFunction::function(const FunctionDomain &domain,
   countValueOffsets(cd);
   // evaluate member functions
   values.zeroCalculated();
+  if (m_parallel && nFunctions() > 1) {
+    functionParallel(cd, values);
+    return;
+  }
   for (size_t iFun = 0; iFun < nFunctions(); ++iFun) {
     // find the domains member function must be applied to
     std::vector<size_t> domains;
@@ -180,6 +192,10 @@ void MultiDomainFunction::functionDeriv(const FunctionDomain &domain,
 
     jacobian.zero();
     countValueOffsets(cd);
+    if (m_parallel && nFunctions() > 1) {
+      functionDerivParallel(cd, jacobian);
+      return;
+    }
     // evaluate member functions derivatives
     for (size_t iFun = 0; iFun < nFunctions(); ++iFun) {
       // find the domains member function must be applied to
@@ -195,6 +211,84 @@ void MultiDomainFunction::functionDeriv(const FunctionDomain &domain,
   }
 }
 
+/**
+ * Evaluate the member functions concurrently, one task per member function.
+ * A member function is never evaluated by two threads at the same time. Each
+ * task writes to its own buffers which are then added to the output in the
+ * same order as in the serial evaluation, so the result doesn't depend on the
+ * number of threads.
+ * @param domain :: The composite domain. The value offsets must be counted.
+ * @param values :: The output values, zeroed.
+ */
+void MultiDomainFunction::functionParallel(const CompositeDomain &domain,
+                                           FunctionValues &values) const {
+  const auto nFun = static_cast<int>(nFunctions());
+  std::vector<std::vector<size_t>> domains(nFun);
+  std::vector<std::vector<FunctionValues>> results(nFun);
+  std::exception_ptr error;
+
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int iFun = 0; iFun < nFun; ++iFun) {
+    try {
+      getDomainIndices(iFun, domain.getNParts(), domains[iFun]);
+      auto &funResults = results[iFun];
+      funResults.reserve(domains[iFun].size());
+      for (auto &i : domains[iFun]) {
+        const FunctionDomain &d = domain.getDomain(i);
+        funResults.emplace_back(d);
+        getFunction(iFun)->function(d, funResults.back());
+      }
+    } catch (...) {
+      PARALLEL_CRITICAL(MultiDomainFunction_function) {
+        if (!error)
+          error = std::current_exception();
+      }
+    }
+  }
+  if (error)
+    std::rethrow_exception(error);
+
+  for (size_t iFun = 0; iFun < results.size(); ++iFun) {
+    for (size_t k = 0; k < results[iFun].size(); ++k) {
+      values.addToCalculated(m_valueOffsets[domains[iFun][k]],
+                             results[iFun][k]);
+    }
+  }
+}
+
+/**
+ * Evaluate the derivatives of the member functions concurrently, one task
+ * per member function. Different member functions write to different columns
+ * of the jacobian.
+ * @param domain :: The composite domain. The value offsets must be counted.
+ * @param jacobian :: The output jacobian, zeroed.
+ */
+void MultiDomainFunction::functionDerivParallel(const CompositeDomain &domain,
+                                                Jacobian &jacobian) {
+  const auto nFun = static_cast<int>(nFunctions());
+  std::exception_ptr error;
+
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int iFun = 0; iFun < nFun; ++iFun) {
+    try {
+      std::vector<size_t> domains;
+      getDomainIndices(iFun, domain.getNParts(), domains);
+      for (auto &i : domains) {
+        const FunctionDomain &d = domain.getDomain(i);
+        PartialJacobian J(&jacobian, m_valueOffsets[i], paramOffset(iFun));
+        getFunction(iFun)->functionDeriv(d, J);
+      }
+    } catch (...) {
+      PARALLEL_CRITICAL(MultiDomainFunction_functionDeriv) {
+        if (!error)
+          error = std::current_exception();
+      }
+    }
+  }
+  if (error)
+    std::rethrow_exception(error);
+}
+
 /**
  * Called at the start of each iteration. Call iterationStarting() of the
  * members.
@@ -23,6 +23,10 @@
 #include "Poco/DateTime.h"
 #include <Poco/DateTimeParser.h>
 
+#include <algorithm>
+#include <iterator>
+#include <unordered_set>
+
 using Mantid::Kernel::EnvironmentHistory;
 using boost::algorithm::split;
 
@@ -50,6 +54,33 @@ struct AlgorithmHistoryComparator {
     return a->uuid() == b->uuid();
   }
 };
+
+/** Remove all but the first copy of each record from a history that is in
+ * execution order. Copies of a record have the same execution count, so they
+ * are in the same run of records with equal counts.
+ * @param histories :: The records in execution order
+ */
+void removeRepeatedRecords(AlgorithmHistories &histories) {
+  AlgorithmHistorySearch executedBefore;
+  auto unique = histories.begin();
+  for (auto run = histories.begin(); run != histories.end();) {
+    const auto runStart = *run;
+    const auto runEnd = std::find_if(
+        run, histories.end(), [&](const AlgorithmHistory_sptr &history) {
+          return executedBefore(runStart, history);
+        });
+    if (std::next(run) == runEnd) {
+      *unique++ = *run++;
+      continue;
+    }
+    std::unordered_set<std::string> uuids;
+    for (; run != runEnd; ++run) {
+      if (uuids.insert((*run)->uuid()).second)
+        *unique++ = *run;
+    }
+  }
+  histories.erase(unique, histories.end());
+}
 } // namespace
 
 /// Default Constructor
@@ -89,6 +120,31 @@ void WorkspaceHistory::addHistory(const WorkspaceHistory &otherHistory) {
   const AlgorithmHistories &otherAlgorithms =
       otherHistory.getAlgorithmHistories();
 
+  // Histories are usually copied from an input workspace, so the other
+  // history is often this one or its beginning. Then there is nothing to add.
+  if (otherAlgorithms.size() <= m_algorithms.size() &&
+      std::equal(otherAlgorithms.begin(), otherAlgorithms.end(),
+                 m_algorithms.begin())) {
+    return;
+  }
+
+  // Both histories are in execution order: merge them in linear time rather
+  // than hashing and sorting every record of a long history
+  AlgorithmHistorySearch executedBefore;
+  if (std::is_sorted(m_algorithms.begin(), m_algorithms.end(),
+                     executedBefore) &&
+      std::is_sorted(otherAlgorithms.begin(), otherAlgorithms.end(),
+                     executedBefore)) {
+    AlgorithmHistories merged;
+    merged.reserve(m_algorithms.size() + otherAlgorithms.size());
+    std::merge(m_algorithms.begin(), m_algorithms.end(),
+               otherAlgorithms.begin(), otherAlgorithms.end(),
+               std::back_inserter(merged), executedBefore);
+    removeRepeatedRecords(merged);
+    m_algorithms = std::move(merged);
+    return;
+  }
+
   for (const auto &algHistory : otherAlgorithms) {
     this->addHistory(algHistory);
   }
@@ -15,6 +15,9 @@
 #include "MantidAPI/FrameworkManager.h"
 #include "MantidAPI/MatrixWorkspace.h"
 
+#include <boost/weak_ptr.hpp>
+#include <thread>
+
 using namespace Mantid::API;
 
 class FakeAnalysisDataServiceObserver
@@ -32,11 +35,14 @@ public:
 
   ~FakeAnalysisDataServiceObserver() { this->observeAll(false); }
 
-  void anyChangeHandle() override { m_anyChangeHandleCalled = true; }
+  void anyChangeHandle() override {
+    m_anyChangeHandleCalled = true;
+    ++m_anyChangeHandleCount;
+  }
   void addHandle(const std::string &wsName, const Workspace_sptr &ws) override {
-    UNUSED_ARG(wsName)
     UNUSED_ARG(ws)
     m_addHandleCalled = true;
+    m_addedNames.emplace_back(wsName);
   }
   void replaceHandle(const std::string &wsName,
                      const Workspace_sptr &ws) override {
@@ -80,6 +86,8 @@ public:
   bool m_anyChangeHandleCalled, m_addHandleCalled, m_replaceHandleCalled,
       m_deleteHandleCalled, m_clearHandleCalled, m_renameHandleCalled,
       m_groupHandleCalled, m_unGroupHandleCalled, m_groupUpdateHandleCalled;
+  int m_anyChangeHandleCount{0};
+  std::vector<std::string> m_addedNames;
 };
 
 class AnalysisDataServiceObserverTest : public CxxTest::TestSuite {
@@ -238,6 +246,86 @@ public:
 
     TS_ASSERT(m_mockInheritingClass->m_groupUpdateHandleCalled)
   }
+
+  void test_batched_changes_are_delivered_when_the_batch_ends() {
+    addWorkspaceToADS("existing");
+    m_mockInheritingClass->observeAll();
+    m_mockInheritingClass->batchNotifications();
+    {
+      AnalysisDataServiceImpl::NotificationBatch batch(ads);
+      addWorkspaceToADS("dummy");
+      addWorkspaceToADS("temporary");
+      addWorkspaceToADS("dummy");
+      ads.remove("temporary");
+      ads.remove("existing");
+
+      TS_ASSERT(!m_mockInheritingClass->m_anyChangeHandleCalled)
+      TS_ASSERT(!m_mockInheritingClass->m_addHandleCalled)
+    }
+
+    TS_ASSERT_EQUALS(m_mockInheritingClass->m_anyChangeHandleCount, 1)
+    TS_ASSERT_EQUALS(m_mockInheritingClass->m_addedNames,
+                     std::vector<std::string>{"dummy"})
+    // The replacement is merged into the addition of "dummy"
+    TS_ASSERT(!m_mockInheritingClass->m_replaceHandleCalled)
+    TS_ASSERT(m_mockInheritingClass->m_deleteHandleCalled)
+  }
+
+  void test_batched_changes_made_by_an_algorithm_are_one_update() {
+    addWorkspaceToADS("dummy");
+    addWorkspaceToADS("dummy2");
+    m_mockInheritingClass->observeAll();
+    m_mockInheritingClass->batchNotifications();
+
+    IAlgorithm_sptr alg =
+        Mantid::API::AlgorithmManager::Instance().createUnmanaged(
+            "GroupWorkspaces");
+    alg->initialize();
+    alg->setPropertyValue("InputWorkspaces", "dummy,dummy2");
+    alg->setPropertyValue("OutputWorkspace", "newGroup");
+    alg->execute();
+
+    TS_ASSERT_EQUALS(m_mockInheritingClass->m_anyChangeHandleCount, 1)
+    TS_ASSERT(m_mockInheritingClass->m_groupHandleCalled)
+    TS_ASSERT(m_mockInheritingClass->m_addHandleCalled)
+  }
+
+  void test_changes_of_other_threads_are_not_held_back() {
+    m_mockInheritingClass->observeAdd();
+    m_mockInheritingClass->batchNotifications();
+    AnalysisDataServiceImpl::NotificationBatch batch(ads);
+    std::thread other([this]() { addWorkspaceToADS("dummy"); });
+    other.join();
+    TS_ASSERT(m_mockInheritingClass->m_addHandleCalled)
+  }
+
+  void test_batched_deletions_do_not_keep_the_workspace_alive() {
+    addWorkspaceToADS("dummy");
+    m_mockInheritingClass->observeAll();
+    m_mockInheritingClass->batchNotifications();
+    {
+      AnalysisDataServiceImpl::NotificationBatch batch(ads);
+      // The replacement is held back, then the workspace is deleted
+      addWorkspaceToADS("dummy");
+      boost::weak_ptr<Workspace> deleted = ads.retrieve("dummy");
+      ads.remove("dummy");
+      TS_ASSERT(deleted.expired())
+    }
+    TS_ASSERT(m_mockInheritingClass->m_deleteHandleCalled)
+  }
+
+  void test_turning_off_batching_delivers_the_held_back_changes() {
+    m_mockInheritingClass->observeAdd();
+    m_mockInheritingClass->batchNotifications();
+    AnalysisDataServiceImpl::NotificationBatch batch(ads);
+    addWorkspaceToADS("dummy");
+    TS_ASSERT(!m_mockInheritingClass->m_addHandleCalled)
+
+    m_mockInheritingClass->batchNotifications(false);
+    TS_ASSERT(m_mockInheritingClass->m_addHandleCalled)
+    addWorkspaceToADS("dummy2");
+    TS_ASSERT_EQUALS(m_mockInheritingClass->m_addedNames.size(), 2)
+  }
 };
 
 #endif /* ANALYSISDATASERVICEOBSERVERTEST_H_ */
\ No newline at end of file
@@ -435,6 +435,23 @@ public:
     TS_ASSERT_EQUALS(runInfo.getPropertyValueAsType<int>(intProp), 99);
   }
 
+  void test_copy_shares_time_series_data_until_changed() {
+    LogManager runInfo;
+    addTestTimeSeries<double>(runInfo, "tsp");
+    LogManager copy(runInfo);
+
+    auto original = runInfo.getTimeSeriesProperty<double>("tsp");
+    auto copied = copy.getTimeSeriesProperty<double>("tsp");
+    TS_ASSERT_DIFFERS(original, copied);
+    TS_ASSERT_EQUALS(&original->valueColumn(), &copied->valueColumn());
+
+    copy.clearTimeSeriesLogs();
+    TS_ASSERT_EQUALS(copied->realSize(), 0);
+    TS_ASSERT_EQUALS(original->realSize(), 10);
+    TS_ASSERT_EQUALS(runInfo.getPropertyAsSingleValue("tsp", Math::LastValue),
+                     24.);
+  }
+
   void clearOutdatedTimeSeriesLogValues() {
     // Set up a Run object with 3 properties in it (1 time series, 2 single
     // value)
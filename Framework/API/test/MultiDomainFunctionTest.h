@@ -14,8 +14,11 @@
 #include "MantidAPI/JointDomain.h"
 #include "MantidAPI/MultiDomainFunction.h"
 #include "MantidAPI/ParamFunction.h"
+#include "MantidKernel/MultiThreaded.h"
 
 #include <algorithm>
+#include <cmath>
+#include <memory>
 #include <boost/make_shared.hpp>
 #include <cxxtest/TestSuite.h>
 
@@ -56,6 +59,28 @@ protected:
 
 DECLARE_FUNCTION(MultiDomainFunctionTest_Function)
 
+class MultiDomainFunctionTest_Peak : public IFunction1D, public ParamFunction {
+public:
+  MultiDomainFunctionTest_Peak() {
+    this->declareParameter("Height", 1);
+    this->declareParameter("Sigma", 1);
+  }
+  std::string name() const override { return "MultiDomainFunctionTest_Peak"; }
+
+protected:
+  void function1D(double *out, const double *xValues,
+                  const size_t nData) const override {
+    const double height = getParameter(0);
+    const double sigma = getParameter(1);
+    for (size_t i = 0; i < nData; ++i) {
+      const double x = xValues[i] / sigma;
+      out[i] = height * std::exp(-0.5 * x * x) / (1.0 + x * x);
+    }
+  }
+};
+
+DECLARE_FUNCTION(MultiDomainFunctionTest_Peak)
+
 namespace {
 
 class JacobianToTestNumDeriv : public Jacobian {
@@ -89,6 +114,22 @@ public:
   double get(size_t, size_t) override { return 0.0; }
   void zero() override {}
 };
+
+class JacobianToTestParallel : public Jacobian {
+public:
+  JacobianToTestParallel(size_t ny, size_t np)
+      : m_np(np), m_values(ny * np, 0.0) {}
+  void set(size_t iY, size_t iP, double value) override {
+    m_values[iY * m_np + iP] = value;
+  }
+  double get(size_t iY, size_t iP) override { return m_values[iY * m_np + iP]; }
+  void zero() override { std::fill(m_values.begin(), m_values.end(), 0.0); }
+  const std::vector<double> &values() const { return m_values; }
+
+private:
+  size_t m_np;
+  std::vector<double> m_values;
+};
 } // namespace
 
 class MultiDomainFunctionTest : public CxxTest::TestSuite {
@@ -284,6 +325,43 @@ public:
     }
   }
 
+  void test_parallel_calc_matches_serial() {
+    multi.setDomainIndex(0, 0);
+    multi.setDomainIndices(1, {0, 1});
+    multi.setDomainIndices(2, {0, 2});
+
+    FunctionValues serial(domain);
+    multi.function(domain, serial);
+
+    multi.setParallel(true);
+    TS_ASSERT(multi.isParallel());
+    FunctionValues parallel(domain);
+    multi.function(domain, parallel);
+    multi.setParallel(false);
+
+    for (size_t i = 0; i < serial.size(); ++i) {
+      TS_ASSERT_EQUALS(parallel.getCalculated(i), serial.getCalculated(i));
+    }
+  }
+
+  void test_parallel_deriv_matches_serial() {
+    multi.setDomainIndex(0, 0);
+    multi.setDomainIndices(1, {0, 1});
+    multi.setDomainIndices(2, {0, 2});
+    multi.setAttributeValue("NumDeriv", false);
+
+    JacobianToTestParallel serial(domain.size(), multi.nParams());
+    multi.functionDeriv(domain, serial);
+
+    multi.setParallel(true);
+    JacobianToTestParallel parallel(domain.size(), multi.nParams());
+    multi.functionDeriv(domain, parallel);
+    multi.setParallel(false);
+    multi.setAttributeValue("NumDeriv", true);
+
+    TS_ASSERT_EQUALS(parallel.values(), serial.values());
+  }
+
   void test_attribute() {
     multi.clearDomainIndices();
     multi.setLocalAttributeValue(0, "domains", "i");
@@ -505,4 +583,61 @@ private:
   JointDomain domain;
 };
 
+class MultiDomainFunctionTestPerformance : public CxxTest::TestSuite {
+public:
+  static MultiDomainFunctionTestPerformance *createSuite() {
+    return new MultiDomainFunctionTestPerformance();
+  }
+  static void destroySuite(MultiDomainFunctionTestPerformance *suite) {
+    delete suite;
+  }
+
+  MultiDomainFunctionTestPerformance() : m_maxThreads(PARALLEL_GET_MAX_THREADS) {
+    // A simultaneous fit of 50 spectra with one peak per spectrum
+    std::string ini = "composite=MultiDomainFunction";
+    for (size_t i = 0; i < nDomains; ++i) {
+      ini += ";name=MultiDomainFunctionTest_Peak,Height=1,Sigma=1,$domains=i";
+      m_domain.addDomain(
+          boost::make_shared<FunctionDomain1DVector>(-10.0, 10.0, domainSize));
+    }
+    m_function = boost::dynamic_pointer_cast<MultiDomainFunction>(
+        FunctionFactory::Instance().createInitialized(ini));
+    m_function->setParallel(true);
+    m_values = std::make_unique<FunctionValues>(m_domain);
+  }
+
+  ~MultiDomainFunctionTestPerformance() override {
+    PARALLEL_SET_NUM_THREADS(m_maxThreads);
+  }
+
+  void test_50_domains_serial() {
+    m_function->setParallel(false);
+    evaluate();
+    m_function->setParallel(true);
+  }
+  void test_50_domains_1_thread() { evaluate(1); }
+  void test_50_domains_2_threads() { evaluate(2); }
+  void test_50_domains_4_threads() { evaluate(4); }
+  void test_50_domains_8_threads() { evaluate(8); }
+  void test_50_domains_16_threads() { evaluate(16); }
+  void test_50_domains_32_threads() { evaluate(32); }
+
+private:
+  void evaluate(int nThreads = 1) {
+    PARALLEL_SET_NUM_THREADS(nThreads);
+    for (size_t i = 0; i < nEvaluations; ++i) {
+      m_function->function(m_domain, *m_values);
+    }
+    PARALLEL_SET_NUM_THREADS(m_maxThreads);
+  }
+
+  static constexpr size_t nDomains = 50;
+  static constexpr size_t domainSize = 10000;
+  static constexpr size_t nEvaluations = 100;
+  int m_maxThreads;
+  JointDomain m_domain;
+  boost::shared_ptr<MultiDomainFunction> m_function;
+  std::unique_ptr<FunctionValues> m_values;
+};
+
 #endif /*MULTIDOMAINFUNCTIONTEST_H_*/
@@ -93,6 +93,35 @@ public:
     TS_ASSERT_EQUALS((*algs.begin())->name(), "FirstAlgorithm");
   }
 
+  void test_Merging_Histories_Keeps_Execution_Order_Without_Repeats() {
+    auto record = [](const std::string &name, const size_t execCount) {
+      return boost::make_shared<AlgorithmHistory>(
+          name, 1, "uuid-" + name, Mantid::Types::Core::DateAndTime(), -1.0,
+          execCount);
+    };
+    const auto a = record("A", 1);
+    const auto b = record("B", 2);
+    const auto c = record("C", 3);
+    const auto d = record("D", 4);
+    WorkspaceHistory first;
+    first.addHistory(a);
+    first.addHistory(c);
+    WorkspaceHistory second;
+    second.addHistory(b);
+    second.addHistory(c);
+    second.addHistory(d);
+
+    first.addHistory(second);
+
+    TS_ASSERT_EQUALS(first.size(), 4);
+    const std::vector<std::string> expected{"A", "B", "C", "D"};
+    for (size_t i = 0; i < expected.size(); ++i)
+      TS_ASSERT_EQUALS(first.getAlgorithmHistory(i)->name(), expected[i]);
+    // Adding a history that is already contained changes nothing
+    first.addHistory(second);
+    TS_ASSERT_EQUALS(first.size(), 4);
+  }
+
   void test_Asking_For_A_Given_Algorithm_Returns_The_Correct_One() {
     Mantid::API::AlgorithmFactory::Instance().subscribe<SimpleSum>();
     Mantid::API::AlgorithmFactory::Instance().subscribe<SimpleSum2>();
@@ -12,6 +12,7 @@
 #include "MantidAPI/SpectrumInfo.h"
 #include "MantidAPI/WorkspaceGroup_fwd.h"
 #include "MantidAPI/Workspace_fwd.h"
+#include "MantidDataObjects/ContiguousWorkspace2D.h"
 #include "MantidDataObjects/EventList.h"
 #include "MantidDataObjects/EventWorkspace.h"
 #include "MantidHistogramData/Histogram.h"
@@ -127,6 +128,44 @@ protected:
                                       HistogramData::HistogramY &YOut,
                                       HistogramData::HistogramE &EOut) = 0;
 
+  /// Whether the operation implements performRowBinaryOperation()
+  virtual bool hasRowBinaryOperation() const { return false; }
+
+  /** Carries out the binary operation on the Y and E values of a spectrum,
+   *with another spectrum as the right-hand operand. Used when an operand or
+   *the output stores its data in contiguous blocks, which are then read and
+   *written in place. The output may be one of the inputs.
+   *
+   *  @param lhsY :: Lhs data values
+   *  @param lhsE :: Lhs error values
+   *  @param rhsY :: Rhs data values
+   *  @param rhsE :: Rhs error values
+   *  @param YOut :: Data values resulting from the operation
+   *  @param EOut :: Error values resulting from the operation
+   *  @param bins :: The number of values of each
+   */
+  virtual void performRowBinaryOperation(const double *lhsY,
+                                         const double *lhsE,
+                                         const double *rhsY,
+                                         const double *rhsE, double *YOut,
+                                         double *EOut, const size_t bins);
+
+  /** Carries out the binary operation on the Y and E values of a spectrum,
+   *when the right hand operand is a single number.
+   *
+   *  @param lhsY :: Lhs data values
+   *  @param lhsE :: Lhs error values
+   *  @param rhsY :: The rhs data value
+   *  @param rhsE :: The rhs error value
+   *  @param YOut :: Data values resulting from the operation
+   *  @param EOut :: Error values resulting from the operation
+   *  @param bins :: The number of values of each
+   */
+  virtual void performRowBinaryOperation(const double *lhsY,
+                                         const double *lhsE, const double rhsY,
+                                         const double rhsE, double *YOut,
+                                         double *EOut, const size_t bins);
+
   // ===================================== EVENT LIST BINARY OPERATIONS
   // ==========================================
 
@@ -214,6 +253,15 @@ protected:
   /// Output EventWorkspace
   DataObjects::EventWorkspace_sptr m_eout;
 
+  /// Left-hand side workspace, if it stores its data in contiguous blocks
+  DataObjects::ContiguousWorkspace2D_const_sptr m_clhs;
+  /// Right-hand side workspace, if it stores its data in contiguous blocks
+  DataObjects::ContiguousWorkspace2D_const_sptr m_crhs;
+  /// Output workspace, if it stores its data in contiguous blocks
+  DataObjects::ContiguousWorkspace2D_sptr m_cout;
+  /// Set if the histograms are operated on with performRowBinaryOperation()
+  bool m_useRows{false};
+
   /// The property value
   bool m_AllowDifferentNumberSpectra{false};
   /// Flag to clear RHS workspace in binary operation
@@ -255,6 +303,8 @@ private:
   void doSingleSpectrum();
   void doSingleColumn();
   void do2D(bool mismatchedSpectra);
+  void operateOnRows(const size_t index, const size_t rhsIndex);
+  void operateOnRows(const size_t index, const double rhsY, const double rhsE);
 
   void propagateBinMasks(const API::MatrixWorkspace_const_sptr rhs,
                          API::MatrixWorkspace_sptr out);
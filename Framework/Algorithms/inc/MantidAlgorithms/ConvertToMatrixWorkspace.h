@@ -13,6 +13,9 @@
 #include "MantidAPI/Algorithm.h"
 
 namespace Mantid {
+namespace DataObjects {
+class EventWorkspace;
+}
 namespace Algorithms {
 /** Creates a copy of the matrix workspace representation of the input
  workspace. At the moment, this
@@ -51,6 +54,7 @@ private:
   void init() override;
   /// Execution code
   void exec() override;
+  bool hasCommonBinCount(const DataObjects::EventWorkspace &workspace) const;
 };
 
 } // namespace Algorithms
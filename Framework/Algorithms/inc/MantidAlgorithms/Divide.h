@@ -55,6 +55,16 @@ private:
                               const double rhsY, const double rhsE,
                               HistogramData::HistogramY &YOut,
                               HistogramData::HistogramE &EOut) override;
+  bool hasRowBinaryOperation() const override { return true; }
+  void performRowBinaryOperation(const double *lhsY, const double *lhsE,
+                                 const double *rhsY, const double *rhsE,
+                                 double *YOut, double *EOut,
+                                 const size_t bins) override;
+  void performRowBinaryOperation(const double *lhsY, const double *lhsE,
+                                 const double rhsY, const double rhsE,
+                                 double *YOut, double *EOut,
+                                 const size_t bins) override;
+  void warnIfZero(const double rhsY);
   void setOutputUnits(const API::MatrixWorkspace_const_sptr lhs,
                       const API::MatrixWorkspace_const_sptr rhs,
                       API::MatrixWorkspace_sptr out) override;
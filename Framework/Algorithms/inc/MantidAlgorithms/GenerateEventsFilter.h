@@ -93,8 +93,8 @@ private:
                                Types::Core::DateAndTime stopTime, int wsindex);
 
   /// Make multiple-log-value filters in serial
-  void makeMultipleFiltersByValues(std::map<size_t, int> indexwsindexmap,
-                                   std::vector<double> logvalueranges,
+  void makeMultipleFiltersByValues(const std::vector<int> &rangeGroups,
+                                   const std::vector<double> &logvalueranges,
                                    bool centre, bool filterIncrease,
                                    bool filterDecrease,
                                    Types::Core::DateAndTime startTime,
@@ -102,14 +102,15 @@ private:
 
   /// Make multiple-log-value filters in serial in parallel
   void makeMultipleFiltersByValuesParallel(
-      std::map<size_t, int> indexwsindexmap, std::vector<double> logvalueranges,
-      bool centre, bool filterIncrease, bool filterDecrease,
+      const std::vector<int> &rangeGroups,
+      const std::vector<double> &logvalueranges, bool centre,
+      bool filterIncrease, bool filterDecrease,
       Types::Core::DateAndTime startTime, Types::Core::DateAndTime stopTime);
 
   /// Generate event splitters for partial sample log (serial)
   void makeMultipleFiltersByValuesPartialLog(
       int istart, int iend, std::vector<Types::Core::DateAndTime> &vecSplitTime,
-      std::vector<int> &vecSplitGroup, std::map<size_t, int> indexwsindexmap,
+      std::vector<int> &vecSplitGroup, const std::vector<int> &rangeGroups,
       const std::vector<double> &logvalueranges, Types::Core::time_duration tol,
       bool filterIncrease, bool filterDecrease,
       Types::Core::DateAndTime startTime, Types::Core::DateAndTime stopTime);
@@ -144,13 +145,16 @@ private:
   /// Generate a SplittersWorkspace for filtering by log values
   void generateSplittersInSplitterWS();
 
+  /// Whether a log entry is selected by a single value filter
+  enum class LogEntryStatus : char { Bad, Good, Unchanged };
+
   /// Identify the a sample log entry is within intended value and time region
-  bool identifyLogEntry(const int &index, const Types::Core::DateAndTime &currT,
-                        const bool &lastgood, const double &minvalue,
-                        const double &maxvalue,
-                        const Types::Core::DateAndTime &startT,
-                        const Types::Core::DateAndTime &stopT,
-                        const bool &filterIncrease, const bool &filterDecrease);
+  static LogEntryStatus
+  identifyLogEntry(const std::vector<int64_t> &times,
+                   const std::vector<double> &values, const size_t index,
+                   const double minvalue, const double maxvalue,
+                   const int64_t startT, const int64_t stopT,
+                   const bool filterIncrease, const bool filterDecrease);
 
   /// Determine the chaning direction of log value
   int determineChangingDirection(int startindex);
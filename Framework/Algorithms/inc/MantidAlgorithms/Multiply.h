@@ -53,6 +53,15 @@ private:
                               const double rhsY, const double rhsE,
                               HistogramData::HistogramY &YOut,
                               HistogramData::HistogramE &EOut) override;
+  bool hasRowBinaryOperation() const override { return true; }
+  void performRowBinaryOperation(const double *lhsY, const double *lhsE,
+                                 const double *rhsY, const double *rhsE,
+                                 double *YOut, double *EOut,
+                                 const size_t bins) override;
+  void performRowBinaryOperation(const double *lhsY, const double *lhsE,
+                                 const double rhsY, const double rhsE,
+                                 double *YOut, double *EOut,
+                                 const size_t bins) override;
 
   void setOutputUnits(const API::MatrixWorkspace_const_sptr lhs,
                       const API::MatrixWorkspace_const_sptr rhs,
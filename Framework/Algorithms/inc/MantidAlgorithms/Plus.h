@@ -56,6 +56,15 @@ private:
                               const double rhsY, const double rhsE,
                               HistogramData::HistogramY &YOut,
                               HistogramData::HistogramE &EOut) override;
+  bool hasRowBinaryOperation() const override { return true; }
+  void performRowBinaryOperation(const double *lhsY, const double *lhsE,
+                                 const double *rhsY, const double *rhsE,
+                                 double *YOut, double *EOut,
+                                 const size_t bins) override;
+  void performRowBinaryOperation(const double *lhsY, const double *lhsE,
+                                 const double rhsY, const double rhsE,
+                                 double *YOut, double *EOut,
+                                 const size_t bins) override;
   void performEventBinaryOperation(DataObjects::EventList &lhs,
                                    const DataObjects::EventList &rhs) override;
   void performEventBinaryOperation(DataObjects::EventList &lhs,
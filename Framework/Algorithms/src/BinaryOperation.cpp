@@ -32,6 +32,29 @@ using std::size_t;
 
 namespace Mantid {
 namespace Algorithms {
+namespace {
+/// The values of a HistogramY or HistogramE, for writing
+template <class T> double *mutableValues(T &values) {
+  return values.empty() ? nullptr : &values[0];
+}
+
+/// The Y values of a spectrum, read in place if the workspace stores its data
+/// in contiguous blocks
+const double *rowY(const MatrixWorkspace &ws,
+                   const ContiguousWorkspace2D *contiguous,
+                   const size_t index) {
+  return contiguous ? contiguous->rowY(index) : ws.y(index).rawData().data();
+}
+
+/// The E values of a spectrum, read in place if the workspace stores its data
+/// in contiguous blocks
+const double *rowE(const MatrixWorkspace &ws,
+                   const ContiguousWorkspace2D *contiguous,
+                   const size_t index) {
+  return contiguous ? contiguous->rowE(index) : ws.e(index).rawData().data();
+}
+} // namespace
+
 /** Initialisation method.
  *  Defines input and output workspaces
  *
@@ -261,6 +284,14 @@ void BinaryOperation::exec() {
   m_progress =
       std::make_unique<Progress>(this, 0.0, 1.0, m_lhs->getNumberHistograms());
 
+  // Workspaces that store their data in contiguous blocks are read and written
+  // in place, if the operation supports it
+  m_clhs = boost::dynamic_pointer_cast<const ContiguousWorkspace2D>(m_lhs);
+  m_crhs = boost::dynamic_pointer_cast<const ContiguousWorkspace2D>(m_rhs);
+  m_cout = boost::dynamic_pointer_cast<ContiguousWorkspace2D>(m_out);
+  m_useRows = hasRowBinaryOperation() && !m_eout && !m_elhs && !m_erhs &&
+              (m_clhs || m_crhs || m_cout);
+
   // There are now 4 possible scenarios, shown schematically here:
   // xxx x   xxx xxx   xxx xxx   xxx x
   // xxx   , xxx xxx , xxx     , xxx x
@@ -496,13 +527,17 @@ void BinaryOperation::doSingleValue() {
     for (int64_t i = 0; i < numHists; ++i) {
       PARALLEL_START_INTERUPT_REGION
       m_out->setSharedX(i, m_lhs->sharedX(i));
-      // Get reference to output vectors here to break any sharing outside the
-      // function call below
-      // where the order of argument evaluation is not guaranteed (if it's L->R
-      // there would be a data race)
-      HistogramData::HistogramY &outY = m_out->mutableY(i);
-      HistogramData::HistogramE &outE = m_out->mutableE(i);
-      performBinaryOperation(m_lhs->histogram(i), rhsY, rhsE, outY, outE);
+      if (m_useRows) {
+        operateOnRows(i, rhsY, rhsE);
+      } else {
+        // Get reference to output vectors here to break any sharing outside
+        // the function call below
+        // where the order of argument evaluation is not guaranteed (if it's
+        // L->R there would be a data race)
+        HistogramData::HistogramY &outY = m_out->mutableY(i);
+        HistogramData::HistogramE &outE = m_out->mutableE(i);
+        performBinaryOperation(m_lhs->histogram(i), rhsY, rhsE, outY, outE);
+      }
       m_progress->report(this->name());
       PARALLEL_END_INTERUPT_REGION
     }
@@ -545,19 +580,23 @@ void BinaryOperation::doSingleColumn() {
     PARALLEL_FOR_IF(Kernel::threadSafe(*m_lhs, *m_rhs, *m_out))
     for (int64_t i = 0; i < numHists; ++i) {
       PARALLEL_START_INTERUPT_REGION
-      const double rhsY = m_rhs->y(i)[0];
-      const double rhsE = m_rhs->e(i)[0];
+      const double rhsY = rowY(*m_rhs, m_crhs.get(), i)[0];
+      const double rhsE = rowE(*m_rhs, m_crhs.get(), i)[0];
 
       m_out->setSharedX(i, m_lhs->sharedX(i));
       if (propagateSpectraMask(lhsSpectrumInfo, rhsSpectrumInfo, i, *m_out,
                                outSpectrumInfo)) {
-        // Get reference to output vectors here to break any sharing outside the
-        // function call below
-        // where the order of argument evaluation is not guaranteed (if it's
-        // L->R there would be a data race)
-        HistogramData::HistogramY &outY = m_out->mutableY(i);
-        HistogramData::HistogramE &outE = m_out->mutableE(i);
-        performBinaryOperation(m_lhs->histogram(i), rhsY, rhsE, outY, outE);
+        if (m_useRows) {
+          operateOnRows(i, rhsY, rhsE);
+        } else {
+          // Get reference to output vectors here to break any sharing outside
+          // the function call below
+          // where the order of argument evaluation is not guaranteed (if it's
+          // L->R there would be a data race)
+          HistogramData::HistogramY &outY = m_out->mutableY(i);
+          HistogramData::HistogramE &outE = m_out->mutableE(i);
+          performBinaryOperation(m_lhs->histogram(i), rhsY, rhsE, outY, outE);
+        }
       }
       m_progress->report(this->name());
       PARALLEL_END_INTERUPT_REGION
@@ -634,13 +673,17 @@ void BinaryOperation::doSingleSpectrum() {
     for (int64_t i = 0; i < numHists; ++i) {
       PARALLEL_START_INTERUPT_REGION
       m_out->setSharedX(i, m_lhs->sharedX(i));
-      // Get reference to output vectors here to break any sharing outside the
-      // function call below
-      // where the order of argument evaluation is not guaranteed (if it's L->R
-      // there would be a data race)
-      HistogramData::HistogramY &outY = m_out->mutableY(i);
-      HistogramData::HistogramE &outE = m_out->mutableE(i);
-      performBinaryOperation(m_lhs->histogram(i), rhs, outY, outE);
+      if (m_useRows) {
+        operateOnRows(i, 0);
+      } else {
+        // Get reference to output vectors here to break any sharing outside
+        // the function call below
+        // where the order of argument evaluation is not guaranteed (if it's
+        // L->R there would be a data race)
+        HistogramData::HistogramY &outY = m_out->mutableY(i);
+        HistogramData::HistogramE &outE = m_out->mutableE(i);
+        performBinaryOperation(m_lhs->histogram(i), rhs, outY, outE);
+      }
       m_progress->report(this->name());
       PARALLEL_END_INTERUPT_REGION
     }
@@ -770,10 +813,14 @@ void BinaryOperation::do2D(bool mismatchedSpectra) {
       // function call below
       // where the order of argument evaluation is not guaranteed (if it's L->R
       // there would be a data race)
-      HistogramData::HistogramY &outY = m_out->mutableY(i);
-      HistogramData::HistogramE &outE = m_out->mutableE(i);
-      performBinaryOperation(m_lhs->histogram(i), m_rhs->histogram(rhs_wi),
-                             outY, outE);
+      if (m_useRows) {
+        operateOnRows(i, rhs_wi);
+      } else {
+        HistogramData::HistogramY &outY = m_out->mutableY(i);
+        HistogramData::HistogramE &outE = m_out->mutableE(i);
+        performBinaryOperation(m_lhs->histogram(i), m_rhs->histogram(rhs_wi),
+                               outY, outE);
+      }
 
       // Free up memory on the RHS if that is possible
       if (m_ClearRHSWorkspace)
@@ -788,6 +835,60 @@ void BinaryOperation::do2D(bool mismatchedSpectra) {
     m_erhs->clearMRU();
 }
 
+/** Carries out the binary operation on a spectrum with
+ * performRowBinaryOperation(), with another spectrum as the right-hand
+ * operand. Workspaces that store their data in contiguous blocks are read and
+ * written in place.
+ * @param index :: The workspace index of the lhs and output spectrum
+ * @param rhsIndex :: The workspace index of the rhs spectrum
+ */
+void BinaryOperation::operateOnRows(const size_t index, const size_t rhsIndex) {
+  // Get the output first, to break any sharing before the inputs are read
+  double *outY = m_cout ? m_cout->mutableRowY(index)
+                        : mutableValues(m_out->mutableY(index));
+  double *outE = m_cout ? m_cout->mutableRowE(index)
+                        : mutableValues(m_out->mutableE(index));
+  performRowBinaryOperation(
+      rowY(*m_lhs, m_clhs.get(), index), rowE(*m_lhs, m_clhs.get(), index),
+      rowY(*m_rhs, m_crhs.get(), rhsIndex),
+      rowE(*m_rhs, m_crhs.get(), rhsIndex), outY, outE, m_lhsBlocksize);
+}
+
+/** Carries out the binary operation on a spectrum with
+ * performRowBinaryOperation(), with a single number as the right-hand operand.
+ * Workspaces that store their data in contiguous blocks are read and written
+ * in place.
+ * @param index :: The workspace index of the lhs and output spectrum
+ * @param rhsY :: The rhs data value
+ * @param rhsE :: The rhs error value
+ */
+void BinaryOperation::operateOnRows(const size_t index, const double rhsY,
+                                    const double rhsE) {
+  double *outY = m_cout ? m_cout->mutableRowY(index)
+                        : mutableValues(m_out->mutableY(index));
+  double *outE = m_cout ? m_cout->mutableRowE(index)
+                        : mutableValues(m_out->mutableE(index));
+  performRowBinaryOperation(rowY(*m_lhs, m_clhs.get(), index),
+                            rowE(*m_lhs, m_clhs.get(), index), rhsY, rhsE,
+                            outY, outE, m_lhsBlocksize);
+}
+
+/// Operations with hasRowBinaryOperation() true must override this
+void BinaryOperation::performRowBinaryOperation(const double *, const double *,
+                                                const double *, const double *,
+                                                double *, double *,
+                                                const size_t) {
+  throw std::logic_error(name() + " does not operate on rows");
+}
+
+/// Operations with hasRowBinaryOperation() true must override this
+void BinaryOperation::performRowBinaryOperation(const double *, const double *,
+                                                const double, const double,
+                                                double *, double *,
+                                                const size_t) {
+  throw std::logic_error(name() + " does not operate on rows");
+}
+
 /** Copies any bin masking from the smaller/rhs input workspace to the output.
  *  Masks on the other input workspace are copied automatically by the workspace
  * factory.
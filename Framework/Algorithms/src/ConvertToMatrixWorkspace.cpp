@@ -8,10 +8,13 @@
 // Includes
 //----------------------------------------------------------------------
 #include "MantidAlgorithms/ConvertToMatrixWorkspace.h"
+#include "MantidDataObjects/ContiguousWorkspace2D.h"
 #include "MantidDataObjects/EventWorkspace.h"
 #include "MantidDataObjects/Workspace2D.h"
 #include "MantidDataObjects/WorkspaceCreation.h"
 
+#include <algorithm>
+
 namespace Mantid {
 namespace Algorithms {
 
@@ -51,8 +54,15 @@ void ConvertToMatrixWorkspace::exec() {
     eventW->sortAll(TOF_SORT, &prog);
 
     // Create the output workspace. This will copy many aspects fron the input
-    // one.
-    outputWorkspace = create<Workspace2D>(*inputWorkspace);
+    // one. If all spectra have the same number of bins their counts are
+    // stored in contiguous blocks rather than allocated spectrum by spectrum.
+    ContiguousWorkspace2D_sptr contiguousOutput;
+    if (hasCommonBinCount(*eventW)) {
+      contiguousOutput = create<ContiguousWorkspace2D>(*inputWorkspace);
+      outputWorkspace = contiguousOutput;
+    } else {
+      outputWorkspace = create<Workspace2D>(*inputWorkspace);
+    }
 
     // ...but not the data, so do that here.
     PARALLEL_FOR_IF(Kernel::threadSafe(*inputWorkspace, *outputWorkspace))
@@ -62,7 +72,18 @@ void ConvertToMatrixWorkspace::exec() {
       auto &outSpec = outputWorkspace->getSpectrum(i);
 
       outSpec.copyInfoFrom(inSpec);
-      outSpec.setHistogram(inSpec.histogram());
+      if (contiguousOutput) {
+        const auto histogram = inSpec.histogram();
+        outSpec.setSharedX(histogram.sharedX());
+        const auto &y = histogram.y();
+        const auto &e = histogram.e();
+        std::copy(y.cbegin(), y.cend(), contiguousOutput->mutableRowY(i));
+        std::copy(e.cbegin(), e.cend(), contiguousOutput->mutableRowE(i));
+        if (histogram.sharedDx())
+          outSpec.setSharedDx(histogram.sharedDx());
+      } else {
+        outSpec.setHistogram(inSpec.histogram());
+      }
 
       prog.report("Binning");
 
@@ -86,5 +107,20 @@ void ConvertToMatrixWorkspace::exec() {
   setProperty("OutputWorkspace", outputWorkspace);
 }
 
+/// Whether all event lists of the workspace are binned into the same number
+/// of bins
+bool ConvertToMatrixWorkspace::hasCommonBinCount(
+    const DataObjects::EventWorkspace &workspace) const {
+  const size_t numHists = workspace.getNumberHistograms();
+  if (numHists == 0)
+    return false;
+  const size_t xLength = workspace.x(0).size();
+  for (size_t i = 1; i < numHists; ++i) {
+    if (workspace.x(i).size() != xLength)
+      return false;
+  }
+  return true;
+}
+
 } // namespace Algorithms
 } // namespace Mantid
@@ -21,6 +21,7 @@
 #include "MantidIndexing/IndexInfo.h"
 #include "MantidKernel/VectorHelper.h"
 
+#include <algorithm>
 #include <cfloat>
 #include <iterator>
 #include <numeric>
@@ -35,6 +36,72 @@ namespace Mantid {
 
 namespace Algorithms {
 
+namespace {
+/// Where the events of an input spectrum go in the focussed workspace
+struct FocusTask {
+  size_t groupIndex;
+  size_t inputIndex;
+  size_t offset;
+};
+
+/**
+ * Copy the events of a spectrum into a slice of the events of a group
+ * @param spectrum :: The input spectrum
+ * @param events :: The events of the group, already of the full size
+ * @param offset :: The position of the first event of the spectrum in events
+ */
+void copyEvents(const EventList &spectrum,
+                std::vector<Types::Event::TofEvent> &events,
+                const size_t offset) {
+  const auto &in = spectrum.getEvents();
+  std::copy(in.cbegin(), in.cend(), events.begin() + offset);
+}
+
+/// @copydoc copyEvents
+void copyEvents(const EventList &spectrum, std::vector<WeightedEvent> &events,
+                const size_t offset) {
+  auto out = events.begin() + offset;
+  if (spectrum.getEventType() == TOF) {
+    const auto &in = spectrum.getEvents();
+    std::transform(in.cbegin(), in.cend(), out,
+                   [](const Types::Event::TofEvent &event) {
+                     return WeightedEvent(event);
+                   });
+  } else {
+    const auto &in = spectrum.getWeightedEvents();
+    std::copy(in.cbegin(), in.cend(), out);
+  }
+}
+
+/// @copydoc copyEvents
+void copyEvents(const EventList &spectrum,
+                std::vector<WeightedEventNoTime> &events, const size_t offset) {
+  auto out = events.begin() + offset;
+  switch (spectrum.getEventType()) {
+  case TOF: {
+    const auto &in = spectrum.getEvents();
+    std::transform(in.cbegin(), in.cend(), out,
+                   [](const Types::Event::TofEvent &event) {
+                     return WeightedEventNoTime(event);
+                   });
+    break;
+  }
+  case WEIGHTED: {
+    const auto &in = spectrum.getWeightedEvents();
+    std::transform(
+        in.cbegin(), in.cend(), out,
+        [](const WeightedEvent &event) { return WeightedEventNoTime(event); });
+    break;
+  }
+  case WEIGHTED_NOTIME: {
+    const auto &in = spectrum.getWeightedEventsNoTime();
+    std::copy(in.cbegin(), in.cend(), out);
+    break;
+  }
+  }
+}
+} // namespace
+
 // Register the class into the algorithm factory
 DECLARE_ALGORITHM(DiffractionFocussing2)
 
@@ -353,103 +420,119 @@ void DiffractionFocussing2::execEvent() {
   std::unique_ptr<Progress> prog =
       std::make_unique<Progress>(this, 0.2, 0.25, nGroups);
 
-  // determine precount size
-  vector<size_t> size_required(this->m_validGroups.size(), 0);
-  int totalHistProcess = 0;
-  for (size_t iGroup = 0; iGroup < this->m_validGroups.size(); iGroup++) {
+  // Determine the number of events of each group and where the events of
+  // each contributing spectrum start in the events of its group
+  const size_t nValidGroups = this->m_validGroups.size();
+  vector<size_t> size_required(nValidGroups, 0);
+  std::vector<FocusTask> tasks;
+  for (size_t iGroup = 0; iGroup < nValidGroups; iGroup++) {
     const vector<size_t> &indices = this->m_wsIndices[iGroup];
-
-    totalHistProcess += static_cast<int>(indices.size());
     for (auto index : indices) {
+      tasks.push_back({iGroup, index, size_required[iGroup]});
       size_required[iGroup] += m_eventW->getSpectrum(index).getNumberEvents();
     }
     prog->report(1, "Pre-counting");
   }
+  const auto totalHistProcess = static_cast<int>(tasks.size());
 
   // ------------- Pre-allocate Event Lists ----------------------------
   prog.reset();
-  prog = std::make_unique<Progress>(this, 0.25, 0.3, totalHistProcess);
+  prog = std::make_unique<Progress>(this, 0.25, 0.3, nValidGroups);
+
+  // The non-const getSpectrum() updates the workspace, so the spectra are
+  // looked up before the parallel loops, which only touch the lists
+  std::vector<EventList *> groupLists(nValidGroups);
+  for (size_t iGroup = 0; iGroup < nValidGroups; iGroup++)
+    groupLists[iGroup] = &out->getSpectrum(iGroup);
+  std::vector<EventList *> inputLists;
+  if (inPlace) {
+    auto input = boost::const_pointer_cast<EventWorkspace>(m_eventW);
+    inputLists.resize(input->getNumberHistograms());
+    for (const auto &task : tasks)
+      inputLists[task.inputIndex] = &input->getSpectrum(task.inputIndex);
+  }
 
-  // This creates and reserves the space required
-  for (size_t iGroup = 0; iGroup < this->m_validGroups.size(); iGroup++) {
+  // This creates the events of each group at their final size, so that every
+  // spectrum can be copied into its own slice of them
+  PARALLEL_FOR_IF(Kernel::threadSafe(*out))
+  for (int iGroup = 0; iGroup < static_cast<int>(nValidGroups); iGroup++) {
+    PARALLEL_START_INTERUPT_REGION
     const auto group = static_cast<int>(m_validGroups[iGroup]);
-    EventList &groupEL = out->getSpectrum(iGroup);
+    EventList &groupEL = *groupLists[iGroup];
     groupEL.switchTo(eventWtype);
-    groupEL.reserve(size_required[iGroup]);
+    switch (eventWtype) {
+    case TOF:
+      groupEL.getEvents().resize(size_required[iGroup]);
+      break;
+    case WEIGHTED:
+      groupEL.getWeightedEvents().resize(size_required[iGroup]);
+      break;
+    case WEIGHTED_NOTIME:
+      groupEL.getWeightedEventsNoTime().resize(size_required[iGroup]);
+      break;
+    }
     groupEL.clearDetectorIDs();
     groupEL.setSpectrumNo(group);
+    // Each input spectrum belongs to one group only
+    for (auto wi : this->m_wsIndices[iGroup])
+      groupEL.addDetectorIDs(m_eventW->getSpectrum(wi).getDetectorIDs());
     prog->reportIncrement(1, "Allocating");
+    PARALLEL_END_INTERUPT_REGION
   }
+  PARALLEL_CHECK_INTERUPT_REGION
 
   // ----------- Focus ---------------
   prog.reset();
   prog = std::make_unique<Progress>(this, 0.3, 0.9, totalHistProcess);
 
-  if (this->m_validGroups.size() == 1) {
-    g_log.information() << "Performing focussing on a single group\n";
-    // Special case of a single group - parallelize differently
-    EventList &groupEL = out->getSpectrum(0);
-    const std::vector<size_t> &indices = this->m_wsIndices[0];
-
-    int chunkSize = 200;
-
-    int end = (totalHistProcess / chunkSize) + 1;
-    // cppcheck-suppress syntaxError
-    PRAGMA_OMP(parallel for schedule(dynamic, 1) )
-    for (int wiChunk = 0; wiChunk < end; wiChunk++) {
-      PARALLEL_START_INTERUPT_REGION
-
-      // Perform in chunks for more efficiency
-      int max = (wiChunk + 1) * chunkSize;
-      if (max > totalHistProcess)
-        max = totalHistProcess;
-
-      // Make a blank EventList that will accumulate the chunk.
-      EventList chunkEL;
-      chunkEL.switchTo(eventWtype);
-      // chunkEL.reserve(numEventsInChunk);
-
-      // process the chunk
-      for (int i = wiChunk * chunkSize; i < max; i++) {
-        // Accumulate the chunk
-        size_t wi = indices[i];
-        chunkEL += m_eventW->getSpectrum(wi);
-      }
-
-      // Rejoin the chunk with the rest.
-      PARALLEL_CRITICAL(DiffractionFocussing2_JoinChunks) {
-        groupEL += chunkEL;
-      }
-
-      PARALLEL_END_INTERUPT_REGION
+  // The events of each group, of which every task fills its own slice
+  std::vector<std::vector<Types::Event::TofEvent> *> tofEvents(nValidGroups);
+  std::vector<std::vector<WeightedEvent> *> weightedEvents(nValidGroups);
+  std::vector<std::vector<WeightedEventNoTime> *> noTimeEvents(nValidGroups);
+  for (size_t iGroup = 0; iGroup < nValidGroups; iGroup++) {
+    switch (eventWtype) {
+    case TOF:
+      tofEvents[iGroup] = &groupLists[iGroup]->getEvents();
+      break;
+    case WEIGHTED:
+      weightedEvents[iGroup] = &groupLists[iGroup]->getWeightedEvents();
+      break;
+    case WEIGHTED_NOTIME:
+      noTimeEvents[iGroup] = &groupLists[iGroup]->getWeightedEventsNoTime();
+      break;
     }
-    PARALLEL_CHECK_INTERUPT_REGION
-  } else {
-    // ------ PARALLELIZE BY GROUPS -------------------------
-
-    auto nValidGroups = static_cast<int>(this->m_validGroups.size());
-    PARALLEL_FOR_IF(Kernel::threadSafe(*m_eventW))
-    for (int iGroup = 0; iGroup < nValidGroups; iGroup++) {
-      PARALLEL_START_INTERUPT_REGION
-      const std::vector<size_t> &indices = this->m_wsIndices[iGroup];
-      for (auto wi : indices) {
-        // In workspace index iGroup, put what was in the OLD workspace index wi
-        out->getSpectrum(iGroup) += m_eventW->getSpectrum(wi);
-
-        prog->reportIncrement(1, "Appending Lists");
-
-        // When focussing in place, you can clear out old memory from the input
-        // one!
-        if (inPlace) {
-          boost::const_pointer_cast<EventWorkspace>(m_eventW)
-              ->getSpectrum(wi)
-              .clear();
-        }
-      }
-      PARALLEL_END_INTERUPT_REGION
+  }
+
+  // The slices are disjoint, so the spectra are copied in parallel across all
+  // groups without locking. This keeps every thread busy even when there are
+  // only a few groups.
+  const bool runParallel = Kernel::threadSafe(*m_eventW);
+  PRAGMA_OMP(parallel for schedule(dynamic, 16) if (runParallel))
+  for (int iTask = 0; iTask < totalHistProcess; iTask++) {
+    PARALLEL_START_INTERUPT_REGION
+    const auto &task = tasks[iTask];
+    const EventList &inputEL = m_eventW->getSpectrum(task.inputIndex);
+    switch (eventWtype) {
+    case TOF:
+      copyEvents(inputEL, *tofEvents[task.groupIndex], task.offset);
+      break;
+    case WEIGHTED:
+      copyEvents(inputEL, *weightedEvents[task.groupIndex], task.offset);
+      break;
+    case WEIGHTED_NOTIME:
+      copyEvents(inputEL, *noTimeEvents[task.groupIndex], task.offset);
+      break;
     }
-    PARALLEL_CHECK_INTERUPT_REGION
-  } // (done with parallel by groups)
+
+    prog->reportIncrement(1, "Appending Lists");
+
+    // When focussing in place, you can clear out old memory from the input
+    // one!
+    if (inPlace)
+      inputLists[task.inputIndex]->clear();
+    PARALLEL_END_INTERUPT_REGION
+  }
+  PARALLEL_CHECK_INTERUPT_REGION
 
   // Now that the data is cleaned up, go through it and set the X vectors to the
   // input workspace we first talked about.
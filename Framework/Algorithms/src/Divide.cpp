@@ -29,16 +29,16 @@ void Divide::exec() {
   BinaryOperation::exec();
 }
 
-void Divide::performBinaryOperation(const HistogramData::Histogram &lhs,
-                                    const HistogramData::Histogram &rhs,
-                                    HistogramData::HistogramY &YOut,
-                                    HistogramData::HistogramE &EOut) {
-  const auto bins = static_cast<int>(lhs.e().size());
-
-  for (int j = 0; j < bins; ++j) {
+namespace {
+// Raw pointers let the compiler vectorise the loops. OutIt is a pointer or an
+// iterator of a HistogramY or HistogramE.
+template <class OutIt>
+void divide(const double *leftYs, const double *leftEs, const double *rightYs,
+            const double *rightEs, OutIt outY, OutIt outE, const size_t bins) {
+  for (size_t j = 0; j < bins; ++j) {
     // Get references to the input Y's
-    const double leftY = lhs.y()[j];
-    const double rightY = rhs.y()[j];
+    const double leftY = leftYs[j];
+    const double rightY = rightYs[j];
 
     //  error dividing two uncorrelated numbers, re-arrange so that you don't
     //  get infinity if leftY==0 (when rightY=0 the Y value and the result will
@@ -47,38 +47,77 @@ void Divide::performBinaryOperation(const HistogramData::Histogram &lhs,
     // (Sa c/a)2 + (Sb c/b)2 = (Sc)2
     // = (Sa 1/b)2 + (Sb (a/b2))2
     // (Sc)2 = (1/b)2( (Sa)2 + (Sb a/b)2 )
-    EOut[j] = sqrt(pow(lhs.e()[j], 2) + pow(leftY * rhs.e()[j] / rightY, 2)) /
-              fabs(rightY);
+    const double leftE = leftEs[j];
+    const double rightTerm = leftY * rightEs[j] / rightY;
+    outE[j] = std::sqrt(leftE * leftE + rightTerm * rightTerm) /
+              std::abs(rightY);
 
     // Copy the result last in case one of the input workspaces is also any
     // output
-    YOut[j] = leftY / rightY;
+    outY[j] = leftY / rightY;
   }
 }
 
-void Divide::performBinaryOperation(const HistogramData::Histogram &lhs,
-                                    const double rhsY, const double rhsE,
-                                    HistogramData::HistogramY &YOut,
-                                    HistogramData::HistogramE &EOut) {
-  if (rhsY == 0 && m_warnOnZeroDivide)
-    g_log.warning() << "Division by zero: the RHS is a single-valued vector "
-                       "with value zero."
-                    << "\n";
-
+template <class OutIt>
+void divide(const double *leftYs, const double *leftEs, const double rhsY,
+            const double rhsE, OutIt outY, OutIt outE, const size_t bins) {
   // Do the right-hand part of the error calculation just once
   const double rhsFactor = pow(rhsE / rhsY, 2);
-  const auto bins = static_cast<int>(lhs.e().size());
-  for (int j = 0; j < bins; ++j) {
+  const double absRhsY = std::abs(rhsY);
+  for (size_t j = 0; j < bins; ++j) {
     // Get reference to input Y
-    const double leftY = lhs.y()[j];
+    const double leftY = leftYs[j];
+    const double leftE = leftEs[j];
 
     // see comment in the function above for the error formula
-    EOut[j] = sqrt(pow(lhs.e()[j], 2) + pow(leftY, 2) * rhsFactor) / fabs(rhsY);
+    outE[j] = std::sqrt(leftE * leftE + leftY * leftY * rhsFactor) / absRhsY;
     // Copy the result last in case one of the input workspaces is also any
     // output
-    YOut[j] = leftY / rhsY;
+    outY[j] = leftY / rhsY;
   }
 }
+} // namespace
+
+void Divide::performBinaryOperation(const HistogramData::Histogram &lhs,
+                                    const HistogramData::Histogram &rhs,
+                                    HistogramData::HistogramY &YOut,
+                                    HistogramData::HistogramE &EOut) {
+  divide(lhs.y().rawData().data(), lhs.e().rawData().data(),
+         rhs.y().rawData().data(), rhs.e().rawData().data(), YOut.begin(),
+         EOut.begin(), lhs.e().size());
+}
+
+void Divide::performBinaryOperation(const HistogramData::Histogram &lhs,
+                                    const double rhsY, const double rhsE,
+                                    HistogramData::HistogramY &YOut,
+                                    HistogramData::HistogramE &EOut) {
+  warnIfZero(rhsY);
+  divide(lhs.y().rawData().data(), lhs.e().rawData().data(), rhsY, rhsE,
+         YOut.begin(), EOut.begin(), lhs.e().size());
+}
+
+void Divide::performRowBinaryOperation(const double *lhsY, const double *lhsE,
+                                       const double *rhsY, const double *rhsE,
+                                       double *YOut, double *EOut,
+                                       const size_t bins) {
+  divide(lhsY, lhsE, rhsY, rhsE, YOut, EOut, bins);
+}
+
+void Divide::performRowBinaryOperation(const double *lhsY, const double *lhsE,
+                                       const double rhsY, const double rhsE,
+                                       double *YOut, double *EOut,
+                                       const size_t bins) {
+  warnIfZero(rhsY);
+  divide(lhsY, lhsE, rhsY, rhsE, YOut, EOut, bins);
+}
+
+/// Warn about a division by a single value of zero, unless this is disabled
+void Divide::warnIfZero(const double rhsY) {
+  if (rhsY == 0 && m_warnOnZeroDivide)
+    g_log.warning() << "Division by zero: the RHS is a single-valued vector "
+                       "with value zero."
+                    << "\n";
+}
 
 void Divide::setOutputUnits(const API::MatrixWorkspace_const_sptr lhs,
                             const API::MatrixWorkspace_const_sptr rhs,
@@ -707,14 +707,13 @@ void GenerateEventsFilter::processMultipleValueFilters(double minvalue,
 
   // Create log value interval (low/up boundary) list and split information
   // workspace
-  std::map<size_t, int> indexwsindexmap;
+  std::vector<int> rangeGroups;
   std::vector<double> logvalueranges;
   int wsindex = 0;
-  size_t index = 0;
 
   double curvalue = minvalue;
   while (curvalue - valuetolerance < maxvalue) {
-    indexwsindexmap.emplace(index, wsindex);
+    rangeGroups.push_back(wsindex);
 
     // Log interval/value boundary
     double lowbound = curvalue - valuetolerance;
@@ -738,16 +737,15 @@ void GenerateEventsFilter::processMultipleValueFilters(double minvalue,
 
     curvalue += valueinterval;
     wsindex++;
-    ++index;
   } // ENDWHILE
 
   // Debug print
   stringstream dbsplitss;
-  dbsplitss << "Index map size = " << indexwsindexmap.size() << "\n";
-  for (auto &mit : indexwsindexmap) {
-    dbsplitss << "Index " << mit.first << ":  WS-group = " << mit.second
-              << ". Log value range: [" << logvalueranges[mit.first * 2] << ", "
-              << logvalueranges[mit.first * 2 + 1] << ").\n";
+  dbsplitss << "Index map size = " << rangeGroups.size() << "\n";
+  for (size_t i = 0; i < rangeGroups.size(); ++i) {
+    dbsplitss << "Index " << i << ":  WS-group = " << rangeGroups[i]
+              << ". Log value range: [" << logvalueranges[i * 2] << ", "
+              << logvalueranges[i * 2 + 1] << ").\n";
   }
   g_log.information(dbsplitss.str());
 
@@ -783,11 +781,11 @@ void GenerateEventsFilter::processMultipleValueFilters(double minvalue,
   if (m_useParallel) {
     // Make filters in parallel
     makeMultipleFiltersByValuesParallel(
-        indexwsindexmap, logvalueranges, logboundary == "centre",
+        rangeGroups, logvalueranges, logboundary == "centre",
         filterincrease, filterdecrease, m_startTime, m_stopTime);
   } else {
     // Make filters in serial
-    makeMultipleFiltersByValues(indexwsindexmap, logvalueranges,
+    makeMultipleFiltersByValues(rangeGroups, logvalueranges,
                                 logboundary == "centre", filterincrease,
                                 filterdecrease, m_startTime, m_stopTime);
   }
@@ -828,75 +826,54 @@ void GenerateEventsFilter::makeFilterBySingleValue(
   m_vecSplitterGroup.clear();
   m_vecSplitterTime.clear();
 
-  // Initialize control parameters
+  const auto &times = m_dblLog->timeColumn();
+  const auto &values = m_dblLog->valueColumn();
+  const auto numEntries = static_cast<int64_t>(times.size());
+  const int64_t start_ns = startTime.totalNanoseconds();
+  const int64_t stop_ns = stopTime.totalNanoseconds();
+
+  // Classify the entries, independently of each other
+  std::vector<LogEntryStatus> status(times.size());
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int64_t i = 0; i < numEntries; ++i) {
+    const auto index = static_cast<size_t>(i);
+    status[index] = identifyLogEntry(times, values, index, min, max, start_ns,
+                                     stop_ns, filterIncrease, filterDecrease);
+  }
+  progress(0.5);
+
+  // Join the good entries into splitters. An entry whose value does not
+  // change keeps the status of the one before it.
+  const int64_t tol_ns =
+      centre ? DateAndTime::durationFromSeconds(TimeTolerance)
+                   .total_nanoseconds()
+             : 0;
   bool lastGood = false;
-  bool isGood = false;
-  time_duration tol = DateAndTime::durationFromSeconds(TimeTolerance);
-  int numgood = 0;
-  DateAndTime lastTime, currT;
-  DateAndTime start, stop;
-
-  size_t progslot = 0;
-  for (int i = 0; i < m_dblLog->size(); i++) {
-    lastTime = currT;
-    // The new entry
-    currT = m_dblLog->nthTime(i);
-
-    // A good value?
-    isGood = identifyLogEntry(i, currT, lastGood, min, max, startTime, stopTime,
-                              filterIncrease, filterDecrease);
-    if (isGood)
-      numgood++;
-
-    // Log status (time/value/value changing direciton) is changed
-    if (isGood != lastGood) {
-      // We switched from bad to good or good to bad
-      if (isGood) {
-        // Start of a good section
-        if (centre)
-          start = currT - tol;
-        else
-          start = currT;
-      } else {
-        // End of the good section
-        if (centre) {
-          stop = currT - tol;
-        } else {
-          stop = currT;
-        }
-
-        std::string empty("");
-        addNewTimeFilterSplitter(start, stop, wsindex, empty);
-
-        // Reset the number of good ones, for next time
-        numgood = 0;
-      }
-      lastGood = isGood;
-    }
-
-    // Progress bar..
-    size_t tmpslot = i * 90 / m_dblLog->size();
-    if (tmpslot > progslot) {
-      progslot = tmpslot;
-      double prog = double(progslot) / 100.0 + 0.1;
-      progress(prog);
+  int64_t goodStart = 0;
+  for (size_t i = 0; i < times.size(); ++i) {
+    const bool isGood = status[i] == LogEntryStatus::Unchanged
+                            ? lastGood
+                            : status[i] == LogEntryStatus::Good;
+    if (isGood == lastGood)
+      continue;
+    if (isGood) {
+      // Start of a good section
+      goodStart = times[i];
+    } else {
+      // End of the good section
+      addNewTimeFilterSplitter(DateAndTime(goodStart - tol_ns),
+                               DateAndTime(times[i] - tol_ns), wsindex, "");
     }
+    lastGood = isGood;
+  }
 
-  } // ENDFOR
-
-  if (numgood > 0) {
+  if (lastGood) {
     // The log ended on "good" so we need to close it using the last time we
     // found
-    if (centre)
-      stop = currT - tol;
-    else
-      stop = currT;
-
-    std::string empty("");
-    addNewTimeFilterSplitter(start, stop, wsindex, empty);
+    addNewTimeFilterSplitter(DateAndTime(goodStart - tol_ns),
+                             DateAndTime(times.back() - tol_ns), wsindex, "");
   }
-
-  return;
+  progress(1.0);
 }
 
 //----------------------------------------------------------------------------------------------
@@ -907,14 +884,16 @@ void GenerateEventsFilter::makeFilterBySingleValue(
  *              because the boundary should be set at the first value with new
  * direction (as well as last value
  *              with the old direction)
+ * @return Unchanged if the entry is selected only by its direction and the
+ * value does not change, so that the status of the previous entry applies
  */
-bool GenerateEventsFilter::identifyLogEntry(
-    const int &index, const Types::Core::DateAndTime &currT,
-    const bool &lastgood, const double &minvalue, const double &maxvalue,
-    const Types::Core::DateAndTime &startT,
-    const Types::Core::DateAndTime &stopT, const bool &filterIncrease,
-    const bool &filterDecrease) {
-  double val = m_dblLog->nthValue(index);
+GenerateEventsFilter::LogEntryStatus GenerateEventsFilter::identifyLogEntry(
+    const std::vector<int64_t> &times, const std::vector<double> &values,
+    const size_t index, const double minvalue, const double maxvalue,
+    const int64_t startT, const int64_t stopT, const bool filterIncrease,
+    const bool filterDecrease) {
+  const double val = values[index];
+  const int64_t currT = times[index];
 
   // Identify by time and value
   bool isgood =
@@ -922,14 +901,15 @@ bool GenerateEventsFilter::identifyLogEntry(
 
   // Consider direction: not both (i.e., not increase or not decrease)
   if (isgood && (!filterIncrease || !filterDecrease)) {
-    int numlogentries = m_dblLog->size();
     double diff;
-    if (index < numlogentries - 1) {
+    if (index + 1 < values.size()) {
       // For a non-last log entry
-      diff = m_dblLog->nthValue(index + 1) - val;
-    } else {
+      diff = values[index + 1] - val;
+    } else if (index > 0) {
       // Last log entry: follow the last direction
-      diff = val - m_dblLog->nthValue(index - 1);
+      diff = val - values[index - 1];
+    } else {
+      diff = 0.;
     }
 
     if (diff > 0 && filterIncrease)
@@ -937,19 +917,19 @@ bool GenerateEventsFilter::identifyLogEntry(
     else if (diff < 0 && filterDecrease)
       isgood = true;
     else if (diff == 0)
-      isgood = lastgood;
+      return LogEntryStatus::Unchanged;
     else
       isgood = false;
   }
 
-  return isgood;
+  return isgood ? LogEntryStatus::Good : LogEntryStatus::Bad;
 }
 
 //-----------------------------------------------------------------------------------------------
 /** Fill a TimeSplitterType that will filter the events by matching
  * SINGLE log values >= min and < max. Creates SplittingInterval's where
  * times match the log values, and going to index==0.
- * @param indexwsindexmap :: Index.
+ * @param rangeGroups :: The workspace group of each log value range.
  * @param logvalueranges ::  A vector of double. Each 2i and 2i+1 pair is one
  * individual log value range.
  * @param centre :: Whether the log value time is considered centred or at the
@@ -962,7 +942,7 @@ bool GenerateEventsFilter::identifyLogEntry(
  * @param stopTime :: Stop time.
  */
 void GenerateEventsFilter::makeMultipleFiltersByValues(
-    map<size_t, int> indexwsindexmap, vector<double> logvalueranges,
+    const vector<int> &rangeGroups, const vector<double> &logvalueranges,
     bool centre, bool filterIncrease, bool filterDecrease,
     DateAndTime startTime, DateAndTime stopTime) {
   g_log.notice("Starting method 'makeMultipleFiltersByValues'. ");
@@ -994,7 +974,7 @@ void GenerateEventsFilter::makeMultipleFiltersByValues(
   auto iend = static_cast<int>(logsize - 1);
 
   makeMultipleFiltersByValuesPartialLog(
-      istart, iend, m_vecSplitterTime, m_vecSplitterGroup, indexwsindexmap,
+      istart, iend, m_vecSplitterTime, m_vecSplitterGroup, rangeGroups,
       logvalueranges, tol, filterIncrease, filterDecrease, startTime, stopTime);
 
   progress(1.0);
@@ -1005,7 +985,7 @@ void GenerateEventsFilter::makeMultipleFiltersByValues(
  * SINGLE log values >= min and < max. Creates SplittingInterval's where
  * times match the log values, and going to index==0.
  *
- * @param indexwsindexmap :: Index.
+ * @param rangeGroups :: The workspace group of each log value range.
  * @param logvalueranges ::  A vector of double. Each 2i and 2i+1 pair is one
  *individual log value range.
  * @param centre :: Whether the log value time is considered centred or at the
@@ -1018,7 +998,7 @@ void GenerateEventsFilter::makeMultipleFiltersByValues(
  * @param stopTime :: Stop time.
  */
 void GenerateEventsFilter::makeMultipleFiltersByValuesParallel(
-    map<size_t, int> indexwsindexmap, vector<double> logvalueranges,
+    const vector<int> &rangeGroups, const vector<double> &logvalueranges,
     bool centre, bool filterIncrease, bool filterDecrease,
     DateAndTime startTime, DateAndTime stopTime) {
   // Return if the log is empty.
@@ -1042,7 +1022,7 @@ void GenerateEventsFilter::makeMultipleFiltersByValuesParallel(
     numThreads = static_cast<int>(PARALLEL_GET_MAX_THREADS);
 
   // Limit the number of threads.
-  numThreads = std::min(numThreads, logsize / 8);
+  numThreads = std::max(1, std::min(numThreads, logsize / 8));
 
   // Determine the istart and iend
   // For split, log should be [0, n], [n, 2n], [2n, 3n], ... as to look into n
@@ -1081,10 +1061,12 @@ void GenerateEventsFilter::makeMultipleFiltersByValuesParallel(
   m_vecSplitterTimeSet.clear();
   m_vecGroupIndexSet.clear();
   for (int i = 0; i < numThreads; ++i) {
+    // A segment has at most two splitter times per log entry
+    const auto segmentSize = static_cast<size_t>(vecEnd[i] - vecStart[i] + 1);
     vector<DateAndTime> tempvectimes;
-    tempvectimes.reserve(m_dblLog->size());
+    tempvectimes.reserve(2 * segmentSize);
     vector<int> tempvecgroup;
-    tempvecgroup.reserve(m_dblLog->size());
+    tempvecgroup.reserve(2 * segmentSize);
     m_vecSplitterTimeSet.push_back(tempvectimes);
     m_vecGroupIndexSet.push_back(tempvecgroup);
   }
@@ -1100,7 +1082,7 @@ void GenerateEventsFilter::makeMultipleFiltersByValuesParallel(
 
       makeMultipleFiltersByValuesPartialLog(
           istart, iend, m_vecSplitterTimeSet[i], m_vecGroupIndexSet[i],
-          indexwsindexmap, logvalueranges, tol, filterIncrease, filterDecrease,
+          rangeGroups, logvalueranges, tol, filterIncrease, filterDecrease,
           startTime, stopTime);
       PARALLEL_END_INTERUPT_REGION
     }
@@ -1177,12 +1159,14 @@ void GenerateEventsFilter::makeMultipleFiltersByValuesParallel(
  */
 void GenerateEventsFilter::makeMultipleFiltersByValuesPartialLog(
     int istart, int iend, std::vector<Types::Core::DateAndTime> &vecSplitTime,
-    std::vector<int> &vecSplitGroup, map<size_t, int> indexwsindexmap,
+    std::vector<int> &vecSplitGroup, const vector<int> &rangeGroups,
     const vector<double> &logvalueranges, time_duration tol,
     bool filterIncrease, bool filterDecrease, DateAndTime startTime,
     DateAndTime stopTime) {
   // Check
-  int logsize = m_dblLog->size();
+  const auto &times = m_dblLog->timeColumn();
+  const auto &values = m_dblLog->valueColumn();
+  const auto logsize = static_cast<int>(times.size());
   if (istart < 0 || iend >= logsize)
     throw runtime_error("Input index of makeMultipleFiltersByValuesPartialLog "
                         "is out of boundary. ");
@@ -1199,11 +1183,14 @@ void GenerateEventsFilter::makeMultipleFiltersByValuesPartialLog(
   // size_t progslot = 0;
 
   g_log.information() << "Log time coverage (index: " << istart << ", " << iend
-                      << ") from " << m_dblLog->nthTime(istart) << ", "
-                      << m_dblLog->nthTime(iend) << "\n";
+                      << ") from " << DateAndTime(times[istart]) << ", "
+                      << DateAndTime(times[iend]) << "\n";
 
   DateAndTime laststoptime(0);
-  int lastlogindex = m_dblLog->size() - 1;
+  int lastlogindex = logsize - 1;
+  const int64_t startTime_ns = startTime.totalNanoseconds();
+  const int64_t stopTime_ns = stopTime.totalNanoseconds();
+  const bool debug = g_log.is(Logger::Priority::PRIO_DEBUG);
 
   int prevDirection = determineChangingDirection(istart);
 
@@ -1213,15 +1200,16 @@ void GenerateEventsFilter::makeMultipleFiltersByValuesPartialLog(
     bool createsplitter = false;
 
     lastTime = currTime;
-    currTime = m_dblLog->nthTime(i);
-    double currValue = m_dblLog->nthValue(i);
+    const int64_t currTime_ns = times[i];
+    currTime = DateAndTime(currTime_ns);
+    double currValue = values[i];
 
     // Filter out by time and direction (optional)
     bool intime = true;
-    if (currTime < startTime) {
+    if (currTime_ns < startTime_ns) {
       // case i.  Too early, do nothing
       createsplitter = false;
-    } else if (currTime > stopTime) {
+    } else if (currTime_ns > stopTime_ns) {
       // case ii. Too late.  Put to splitter if half of splitter is done.  But
       // still within range
       breakloop = true;
@@ -1238,7 +1226,7 @@ void GenerateEventsFilter::makeMultipleFiltersByValuesPartialLog(
     int direction = 0;
     if (i < lastlogindex) {
       // Not the last log entry
-      double diff = m_dblLog->nthValue(i + 1) - m_dblLog->nthValue(i);
+      double diff = values[i + 1] - values[i];
       if (diff > 0)
         direction = 1;
       else if (diff < 0)
@@ -1281,12 +1269,13 @@ void GenerateEventsFilter::makeMultipleFiltersByValuesPartialLog(
           valueWithinMinMax = false;
         }
 
-        if (g_log.is(Logger::Priority::PRIO_DEBUG)) {
+        if (debug) {
           stringstream dbss;
           dbss << "[DBx257] Examine Log Index " << i
                << ", Value = " << currValue << ", Data Range Index = " << index
                << "; "
-               << "Group Index = " << indexwsindexmap[index / 2]
+               << "Group Index = "
+               << (valueWithinMinMax ? rangeGroups[index / 2] : -1)
                << " (log value range vector size = " << logvalueranges.size()
                << "): ";
           if (index == 0)
@@ -1302,7 +1291,7 @@ void GenerateEventsFilter::makeMultipleFiltersByValuesPartialLog(
         if (valueWithinMinMax) {
           if (index % 2 == 0) {
             // [Situation] Falls in the interval
-            currindex = indexwsindexmap[index / 2];
+            currindex = rangeGroups[index / 2];
 
             if (currindex != lastindex && start.totalNanoseconds() == 0) {
               // Group index is different from last and start is not set up: new
@@ -1329,7 +1318,7 @@ void GenerateEventsFilter::makeMultipleFiltersByValuesPartialLog(
             } else {
               // An impossible situation
               std::stringstream errmsg;
-              double lastvalue = m_dblLog->nthValue(i - 1);
+              double lastvalue = values[i > 0 ? i - 1 : 0];
               errmsg << "Impossible to have currindex == lastindex == "
                      << currindex
                      << ", while start is not init.  Log Index = " << i
@@ -1405,8 +1394,8 @@ void GenerateEventsFilter::makeMultipleFiltersByValuesPartialLog(
   // time
   // To make it non-empty
   if (vecSplitTime.empty()) {
-    start = m_dblLog->nthTime(istart);
-    stop = m_dblLog->nthTime(iend);
+    start = DateAndTime(times[istart]);
+    stop = DateAndTime(times[iend]);
     lastindex = -1;
     makeSplitterInVector(vecSplitTime, vecSplitGroup, start, stop, lastindex,
                          tol_ns, laststoptime);
@@ -1451,9 +1440,9 @@ void GenerateEventsFilter::processIntegerValueFilter(int minvalue, int maxvalue,
   }
 
   // Search along log to generate splitters
-  size_t numlogentries = m_intLog->size();
-  vector<DateAndTime> vecTimes = m_intLog->timesAsVector();
-  vector<int> vecValue = m_intLog->valuesAsVector();
+  const auto &vecTimes = m_intLog->timeColumn();
+  const auto &vecValue = m_intLog->valueColumn();
+  size_t numlogentries = vecTimes.size();
 
   time_duration timetol = DateAndTime::durationFromSeconds(
       m_logTimeTolerance * m_timeUnitConvertFactorToNS * 1.0E-9);
@@ -1467,6 +1456,7 @@ void GenerateEventsFilter::processIntegerValueFilter(int minvalue, int maxvalue,
 
   for (size_t i = 0; i < numlogentries; ++i) {
     int currvalue = vecValue[i];
+    const DateAndTime currtime(vecTimes[i]);
     int currgroup = -1;
 
     // Determine whether this log value is allowed and then the ws group it
@@ -1495,27 +1485,27 @@ void GenerateEventsFilter::processIntegerValueFilter(int minvalue, int maxvalue,
         throw runtime_error("Programming logic error.");
 
       makeSplitterInVector(m_vecSplitterTime, m_vecSplitterGroup,
-                           splitstarttime, vecTimes[i], pregroup, timetolns,
+                           splitstarttime, currtime, pregroup, timetolns,
                            laststoptime);
-      laststoptime = vecTimes[i];
+      laststoptime = currtime;
 
       splitstarttime = DateAndTime(0);
       statuschanged = true;
     } else if (pregroup < 0 && currgroup >= 0) {
       // previous log is not allowed, but this one is.  this is the start of a
       // new splitter
-      splitstarttime = vecTimes[i];
+      splitstarttime = currtime;
       statuschanged = true;
     } else if (currgroup >= 0 && pregroup != currgroup) {
       // migrated to a new region
       if (splitstarttime.totalNanoseconds() == 0)
         throw runtime_error("Programming logic error (1).");
       makeSplitterInVector(m_vecSplitterTime, m_vecSplitterGroup,
-                           splitstarttime, vecTimes[i], pregroup, timetolns,
+                           splitstarttime, currtime, pregroup, timetolns,
                            laststoptime);
-      laststoptime = vecTimes[i];
+      laststoptime = currtime;
 
-      splitstarttime = vecTimes[i];
+      splitstarttime = currtime;
       statuschanged = true;
     } else {
       // no need to do anything: status is not changed
@@ -1621,12 +1611,13 @@ size_t GenerateEventsFilter::searchValue(const std::vector<double> &sorteddata,
 /** Determine starting value changing direction
  */
 int GenerateEventsFilter::determineChangingDirection(int startindex) {
+  const auto &values = m_dblLog->valueColumn();
   int direction = 0;
 
   // Search to earlier entries
   int index = startindex;
   while (direction == 0 && index > 0) {
-    double diff = m_dblLog->nthValue(index) - m_dblLog->nthValue(index - 1);
+    double diff = values[index] - values[index - 1];
     if (diff > 0)
       direction = 1;
     else if (diff < 0)
@@ -1640,9 +1631,9 @@ int GenerateEventsFilter::determineChangingDirection(int startindex) {
 
   // Search to later entries
   index = startindex;
-  int maxindex = m_dblLog->size() - 1;
+  const auto maxindex = static_cast<int>(values.size()) - 1;
   while (direction == 0 && index < maxindex) {
-    double diff = m_dblLog->nthValue(index + 1) - m_dblLog->nthValue(index);
+    double diff = values[index + 1] - values[index];
     if (diff > 0)
       direction = 1;
     else if (diff < 0)
@@ -10,6 +10,7 @@
 #include "MantidAlgorithms/Integration.h"
 #include "MantidAPI/NumericAxis.h"
 #include "MantidAPI/TextAxis.h"
+#include "MantidDataObjects/ContiguousWorkspace2D.h"
 #include "MantidDataObjects/EventWorkspace.h"
 #include "MantidDataObjects/RebinnedOutput.h"
 #include "MantidDataObjects/TableWorkspace.h"
@@ -159,17 +160,36 @@ void Integration::exec() {
     minRange = std::numeric_limits<double>::lowest();
   }
 
-  // Create the 2D workspace (with 1 bin) for the output
-
-  MatrixWorkspace_sptr outputWorkspace = create<Workspace2D>(
-      *localworkspace, maxWsIndex - minWsIndex + 1, BinEdges(2));
+  // Create the 2D workspace (with 1 bin) for the output. Unless fractional
+  // areas have to be kept the output holds its values in contiguous blocks,
+  // rather than allocating a single bin for each spectrum.
   auto rebinned_input =
       boost::dynamic_pointer_cast<const RebinnedOutput>(localworkspace);
+  const auto numberOfOutputSpectra = maxWsIndex - minWsIndex + 1;
+  MatrixWorkspace_sptr outputWorkspace;
+  if (rebinned_input)
+    outputWorkspace = create<Workspace2D>(*localworkspace,
+                                          numberOfOutputSpectra, BinEdges(2));
+  else
+    outputWorkspace = create<ContiguousWorkspace2D>(
+        *localworkspace, numberOfOutputSpectra, BinEdges(2));
+  auto contiguous_input =
+      boost::dynamic_pointer_cast<const ContiguousWorkspace2D>(localworkspace);
+  auto contiguous_output =
+      boost::dynamic_pointer_cast<ContiguousWorkspace2D>(outputWorkspace);
   auto rebinned_output =
       boost::dynamic_pointer_cast<RebinnedOutput>(outputWorkspace);
 
   bool is_distrib = outputWorkspace->isDistribution();
-  Progress progress(this, progressStart, 1.0, maxWsIndex - minWsIndex + 1);
+  Progress progress(this, progressStart, 1.0, numberOfOutputSpectra);
+
+  // With partial bins and no per-spectrum limits all of the output spectra
+  // have the same bin edges, so they share a single X rather than each
+  // allocating their own
+  Kernel::cow_ptr<HistogramData::HistogramX> commonX(nullptr);
+  if (incPartBins && minRanges.empty() && maxRanges.empty())
+    commonX = Kernel::make_cow<HistogramData::HistogramX>(
+        std::initializer_list<double>{minRange, maxRange});
 
   const bool axisIsText = localworkspace->getAxis(1)->isText();
   const bool axisIsNumeric = localworkspace->getAxis(1)->isNumeric();
@@ -201,10 +221,13 @@ void Integration::exec() {
     // Copy spectrum number, detector IDs
     outSpec.copyInfoFrom(inSpec);
 
-    // Retrieve the spectrum into a vector (Histogram)
+    // Retrieve the spectrum. The rows of a contiguous input are read in
+    // place, which leaves them in its blocks.
     const auto &X = inSpec.x();
-    const auto &Y = inSpec.y();
-    const auto &E = inSpec.e();
+    const double *Y = contiguous_input ? contiguous_input->rowY(i)
+                                       : inSpec.y().rawData().data();
+    const double *E = contiguous_input ? contiguous_input->rowE(i)
+                                       : inSpec.e().rawData().data();
 
     // Find the range [min,max]
     MantidVec::const_iterator lowit, highit;
@@ -216,7 +239,9 @@ void Integration::exec() {
     // If doing partial bins, we want to set the bin boundaries to the specified
     // values regardless of whether they're 'in range' for this spectrum
     // Have to do this here, ahead of the 'continue' a bit down from here.
-    if (incPartBins) {
+    if (commonX) {
+      outSpec.setSharedX(commonX);
+    } else if (incPartBins) {
       outSpec.dataX()[0] = lowerLimit;
       outSpec.dataX()[1] = upperLimit;
     }
@@ -274,8 +299,8 @@ void Integration::exec() {
       if (!is_distrib) {
         // Sum the Y, and sum the E in quadrature
         {
-          sumY = std::accumulate(Y.begin() + distmin, Y.begin() + distmax, 0.0);
-          sumE = std::accumulate(E.begin() + distmin, E.begin() + distmax, 0.0,
+          sumY = std::accumulate(Y + distmin, Y + distmax, 0.0);
+          sumE = std::accumulate(E + distmin, E + distmax, 0.0,
                                  VectorHelper::SumSquares<double>());
         }
       } else {
@@ -283,10 +308,10 @@ void Integration::exec() {
         std::vector<double> widths(X.size());
         // highit+1 is safe while input workspace guaranteed to be histogram
         std::adjacent_difference(lowit, highit + 1, widths.begin());
-        sumY = std::inner_product(Y.begin() + distmin, Y.begin() + distmax,
-                                  widths.begin() + 1, 0.0);
-        sumE = std::inner_product(E.begin() + distmin, E.begin() + distmax,
-                                  widths.begin() + 1, 0.0, std::plus<double>(),
+        sumY = std::inner_product(Y + distmin, Y + distmax, widths.begin() + 1,
+                                  0.0);
+        sumE = std::inner_product(E + distmin, E + distmax, widths.begin() + 1,
+                                  0.0, std::plus<double>(),
                                   VectorHelper::TimesSquares<double>());
       }
     }
@@ -327,8 +352,13 @@ void Integration::exec() {
       outSpec.mutableX()[1] = *highit;
     }
 
-    outSpec.mutableY()[0] = sumY;
-    outSpec.mutableE()[0] = sqrt(sumE); // Propagate Gaussian error
+    if (contiguous_output) {
+      contiguous_output->mutableRowY(outWI)[0] = sumY;
+      contiguous_output->mutableRowE(outWI)[0] = sqrt(sumE);
+    } else {
+      outSpec.mutableY()[0] = sumY;
+      outSpec.mutableE()[0] = sqrt(sumE); // Propagate Gaussian error
+    }
     if (rebinned_output) {
       rebinned_output->dataF(outWI)[0] = sumF;
     }
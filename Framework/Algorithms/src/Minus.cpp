@@ -5,7 +5,8 @@
 //     & Institut Laue - Langevin
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "MantidAlgorithms/Minus.h"
-#include "MantidKernel/VectorHelper.h"
+
+#include <cmath>
 
 using namespace Mantid::API;
 using namespace Mantid::Kernel;
@@ -17,29 +18,63 @@ DECLARE_ALGORITHM(Minus)
 
 const std::string Minus::alias() const { return "Subtract"; }
 
+namespace {
+// See Plus for the layout of the loops
+template <class OutIt>
+void minus(const double *leftY, const double *leftE, const double *rightY,
+           const double *rightE, OutIt outY, OutIt outE, const size_t bins) {
+  for (size_t j = 0; j < bins; ++j)
+    outY[j] = leftY[j] - rightY[j];
+  for (size_t j = 0; j < bins; ++j)
+    outE[j] = std::sqrt(leftE[j] * leftE[j] + rightE[j] * rightE[j]);
+}
+
+template <class OutIt>
+void minus(const double *leftY, const double *leftE, const double rhsY,
+           const double rhsE, OutIt outY, OutIt outE, const size_t bins) {
+  for (size_t j = 0; j < bins; ++j)
+    outY[j] = leftY[j] - rhsY;
+  // Only do E if non-zero, otherwise just copy
+  if (rhsE != 0) {
+    const double rhsE2 = rhsE * rhsE;
+    for (size_t j = 0; j < bins; ++j)
+      outE[j] = std::sqrt(leftE[j] * leftE[j] + rhsE2);
+  } else {
+    for (size_t j = 0; j < bins; ++j)
+      outE[j] = leftE[j];
+  }
+}
+} // namespace
+
 void Minus::performBinaryOperation(const HistogramData::Histogram &lhs,
                                    const HistogramData::Histogram &rhs,
                                    HistogramData::HistogramY &YOut,
                                    HistogramData::HistogramE &EOut) {
-  std::transform(lhs.y().begin(), lhs.y().end(), rhs.y().begin(), YOut.begin(),
-                 std::minus<double>());
-  std::transform(lhs.e().begin(), lhs.e().end(), rhs.e().begin(), EOut.begin(),
-                 VectorHelper::SumGaussError<double>());
+  minus(lhs.y().rawData().data(), lhs.e().rawData().data(),
+        rhs.y().rawData().data(), rhs.e().rawData().data(), YOut.begin(),
+        EOut.begin(), YOut.size());
 }
 
 void Minus::performBinaryOperation(const HistogramData::Histogram &lhs,
                                    const double rhsY, const double rhsE,
                                    HistogramData::HistogramY &YOut,
                                    HistogramData::HistogramE &EOut) {
-  using std::placeholders::_1;
-  std::transform(lhs.y().begin(), lhs.y().end(), YOut.begin(),
-                 std::bind(std::minus<double>(), _1, rhsY));
-  // Only do E if non-zero, otherwise just copy
-  if (rhsE != 0)
-    std::transform(lhs.e().begin(), lhs.e().end(), EOut.begin(),
-                   std::bind(VectorHelper::SumGaussError<double>(), _1, rhsE));
-  else
-    EOut = lhs.e();
+  minus(lhs.y().rawData().data(), lhs.e().rawData().data(), rhsY, rhsE,
+        YOut.begin(), EOut.begin(), YOut.size());
+}
+
+void Minus::performRowBinaryOperation(const double *lhsY, const double *lhsE,
+                                      const double *rhsY, const double *rhsE,
+                                      double *YOut, double *EOut,
+                                      const size_t bins) {
+  minus(lhsY, lhsE, rhsY, rhsE, YOut, EOut, bins);
+}
+
+void Minus::performRowBinaryOperation(const double *lhsY, const double *lhsE,
+                                      const double rhsY, const double rhsE,
+                                      double *YOut, double *EOut,
+                                      const size_t bins) {
+  minus(lhsY, lhsE, rhsY, rhsE, YOut, EOut, bins);
 }
 
 // ===================================== EVENT LIST BINARY OPERATIONS
@@ -16,46 +16,83 @@ namespace Algorithms {
 // Register the class into the algorithm factory
 DECLARE_ALGORITHM(Multiply)
 
-void Multiply::performBinaryOperation(const HistogramData::Histogram &lhs,
-                                      const HistogramData::Histogram &rhs,
-                                      HistogramData::HistogramY &YOut,
-                                      HistogramData::HistogramE &EOut) {
-  const size_t bins = lhs.e().size();
+namespace {
+// Raw pointers let the compiler vectorise the loops. OutIt is a pointer or an
+// iterator of a HistogramY or HistogramE.
+template <class OutIt>
+void multiply(const double *leftYs, const double *leftEs,
+              const double *rightYs, const double *rightEs, OutIt outY,
+              OutIt outE, const size_t bins) {
   for (size_t j = 0; j < bins; ++j) {
     // Get references to the input Y's
-    const double leftY = lhs.y()[j];
-    const double rightY = rhs.y()[j];
+    const double leftY = leftYs[j];
+    const double rightY = rightYs[j];
 
     // error multiplying two uncorrelated numbers, re-arrange so that you don't
     // get infinity if leftY or rightY == 0
     // (Sa/a)2 + (Sb/b)2 = (Sc/c)2
     // (Sc)2 = (Sa c/a)2 + (Sb c/b)2
     //       = (Sa b)2 + (Sb a)2
-    EOut[j] = sqrt(pow(lhs.e()[j] * rightY, 2) + pow(rhs.e()[j] * leftY, 2));
+    const double leftTerm = leftEs[j] * rightY;
+    const double rightTerm = rightEs[j] * leftY;
+    outE[j] = std::sqrt(leftTerm * leftTerm + rightTerm * rightTerm);
 
     // Copy the result last in case one of the input workspaces is also any
     // output
-    YOut[j] = leftY * rightY;
+    outY[j] = leftY * rightY;
   }
 }
 
-void Multiply::performBinaryOperation(const HistogramData::Histogram &lhs,
-                                      const double rhsY, const double rhsE,
-                                      HistogramData::HistogramY &YOut,
-                                      HistogramData::HistogramE &EOut) {
-  const size_t bins = lhs.e().size();
+template <class OutIt>
+void multiply(const double *leftYs, const double *leftEs, const double rhsY,
+              const double rhsE, OutIt outY, OutIt outE, const size_t bins) {
   for (size_t j = 0; j < bins; ++j) {
     // Get reference to input Y
-    const double leftY = lhs.y()[j];
+    const double leftY = leftYs[j];
 
     // see comment in the function above for the error formula
-    EOut[j] = sqrt(pow(lhs.e()[j] * rhsY, 2) + pow(rhsE * leftY, 2));
+    const double leftTerm = leftEs[j] * rhsY;
+    const double rightTerm = rhsE * leftY;
+    outE[j] = std::sqrt(leftTerm * leftTerm + rightTerm * rightTerm);
 
     // Copy the result last in case one of the input workspaces is also any
     // output
-    YOut[j] = leftY * rhsY;
+    outY[j] = leftY * rhsY;
   }
 }
+} // namespace
+
+void Multiply::performBinaryOperation(const HistogramData::Histogram &lhs,
+                                      const HistogramData::Histogram &rhs,
+                                      HistogramData::HistogramY &YOut,
+                                      HistogramData::HistogramE &EOut) {
+  multiply(lhs.y().rawData().data(), lhs.e().rawData().data(),
+           rhs.y().rawData().data(), rhs.e().rawData().data(), YOut.begin(),
+           EOut.begin(), lhs.e().size());
+}
+
+void Multiply::performBinaryOperation(const HistogramData::Histogram &lhs,
+                                      const double rhsY, const double rhsE,
+                                      HistogramData::HistogramY &YOut,
+                                      HistogramData::HistogramE &EOut) {
+  multiply(lhs.y().rawData().data(), lhs.e().rawData().data(), rhsY, rhsE,
+           YOut.begin(), EOut.begin(), lhs.e().size());
+}
+
+void Multiply::performRowBinaryOperation(const double *lhsY,
+                                         const double *lhsE,
+                                         const double *rhsY,
+                                         const double *rhsE, double *YOut,
+                                         double *EOut, const size_t bins) {
+  multiply(lhsY, lhsE, rhsY, rhsE, YOut, EOut, bins);
+}
+
+void Multiply::performRowBinaryOperation(const double *lhsY,
+                                         const double *lhsE, const double rhsY,
+                                         const double rhsE, double *YOut,
+                                         double *EOut, const size_t bins) {
+  multiply(lhsY, lhsE, rhsY, rhsE, YOut, EOut, bins);
+}
 
 void Multiply::setOutputUnits(const API::MatrixWorkspace_const_sptr lhs,
                               const API::MatrixWorkspace_const_sptr rhs,
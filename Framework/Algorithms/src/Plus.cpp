@@ -5,7 +5,8 @@
 //     & Institut Laue - Langevin
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "MantidAlgorithms/Plus.h"
-#include "MantidKernel/VectorHelper.h"
+
+#include <cmath>
 
 using namespace Mantid::API;
 using namespace Mantid::Kernel;
@@ -18,15 +19,44 @@ DECLARE_ALGORITHM(Plus)
 
 // ===================================== HISTOGRAM BINARY OPERATIONS
 // ==========================================
+namespace {
+// Plain loops over the raw arrays, which the compiler can vectorise. The
+// output may be the lhs, which is safe as every element is read before it is
+// written. OutIt is a pointer or an iterator of a HistogramY or HistogramE.
+template <class OutIt>
+void plus(const double *leftY, const double *leftE, const double *rightY,
+          const double *rightE, OutIt outY, OutIt outE, const size_t bins) {
+  for (size_t j = 0; j < bins; ++j)
+    outY[j] = leftY[j] + rightY[j];
+  for (size_t j = 0; j < bins; ++j)
+    outE[j] = std::sqrt(leftE[j] * leftE[j] + rightE[j] * rightE[j]);
+}
+
+template <class OutIt>
+void plus(const double *leftY, const double *leftE, const double rhsY,
+          const double rhsE, OutIt outY, OutIt outE, const size_t bins) {
+  for (size_t j = 0; j < bins; ++j)
+    outY[j] = leftY[j] + rhsY;
+  // Only do E if non-zero, otherwise just copy
+  if (rhsE != 0) {
+    const double rhsE2 = rhsE * rhsE;
+    for (size_t j = 0; j < bins; ++j)
+      outE[j] = std::sqrt(leftE[j] * leftE[j] + rhsE2);
+  } else {
+    for (size_t j = 0; j < bins; ++j)
+      outE[j] = leftE[j];
+  }
+}
+} // namespace
+
 //---------------------------------------------------------------------------------------------
 void Plus::performBinaryOperation(const HistogramData::Histogram &lhs,
                                   const HistogramData::Histogram &rhs,
                                   HistogramData::HistogramY &YOut,
                                   HistogramData::HistogramE &EOut) {
-  std::transform(lhs.y().begin(), lhs.y().end(), rhs.y().begin(), YOut.begin(),
-                 std::plus<double>());
-  std::transform(lhs.e().begin(), lhs.e().end(), rhs.e().begin(), EOut.begin(),
-                 VectorHelper::SumGaussError<double>());
+  plus(lhs.y().rawData().data(), lhs.e().rawData().data(),
+       rhs.y().rawData().data(), rhs.e().rawData().data(), YOut.begin(),
+       EOut.begin(), YOut.size());
 }
 
 //---------------------------------------------------------------------------------------------
@@ -34,15 +64,24 @@ void Plus::performBinaryOperation(const HistogramData::Histogram &lhs,
                                   const double rhsY, const double rhsE,
                                   HistogramData::HistogramY &YOut,
                                   HistogramData::HistogramE &EOut) {
-  using std::placeholders::_1;
-  std::transform(lhs.y().begin(), lhs.y().end(), YOut.begin(),
-                 std::bind(std::plus<double>(), _1, rhsY));
-  // Only do E if non-zero, otherwise just copy
-  if (rhsE != 0)
-    std::transform(lhs.e().begin(), lhs.e().end(), EOut.begin(),
-                   std::bind(VectorHelper::SumGaussError<double>(), _1, rhsE));
-  else
-    EOut = lhs.e();
+  plus(lhs.y().rawData().data(), lhs.e().rawData().data(), rhsY, rhsE,
+       YOut.begin(), EOut.begin(), YOut.size());
+}
+
+//---------------------------------------------------------------------------------------------
+void Plus::performRowBinaryOperation(const double *lhsY, const double *lhsE,
+                                     const double *rhsY, const double *rhsE,
+                                     double *YOut, double *EOut,
+                                     const size_t bins) {
+  plus(lhsY, lhsE, rhsY, rhsE, YOut, EOut, bins);
+}
+
+//---------------------------------------------------------------------------------------------
+void Plus::performRowBinaryOperation(const double *lhsY, const double *lhsE,
+                                     const double rhsY, const double rhsE,
+                                     double *YOut, double *EOut,
+                                     const size_t bins) {
+  plus(lhsY, lhsE, rhsY, rhsE, YOut, EOut, bins);
 }
 
 // ===================================== EVENT LIST BINARY OPERATIONS
@@ -41,6 +41,30 @@ using namespace API;
 using namespace Geometry;
 using namespace DataObjects;
 
+namespace {
+/// The sums into the output Q bins of the spectra handled by one thread
+struct QBinSums {
+  explicit QBinSums(const size_t numBins)
+      : counts(numBins, 0.0), countErrorsTo2(numBins, 0.0),
+        norms(numBins, 0.0), normErrorsTo2(numBins, 0.0),
+        qResolution(numBins, 0.0) {}
+  std::vector<double> counts;
+  std::vector<double> countErrorsTo2;
+  std::vector<double> norms;
+  std::vector<double> normErrorsTo2;
+  std::vector<double> qResolution;
+  /// The workspace indices of the spectra that were added
+  std::vector<size_t> spectra;
+};
+
+/// Add the sums of one thread to a total
+template <typename Total>
+void addSums(const std::vector<double> &sums, Total &total) {
+  for (size_t bin = 0; bin < sums.size(); ++bin)
+    total[bin] += sums[bin];
+}
+} // namespace
+
 Q1D2::Q1D2() : API::Algorithm(), m_dataWS(), m_doSolidAngle(false) {}
 
 void Q1D2::init() {
@@ -167,10 +191,22 @@ void Q1D2::exec() {
   const auto numSpec = static_cast<int>(m_dataWS->getNumberHistograms());
   Progress progress(this, 0.05, 1.0, numSpec + 1);
 
+  const double radiusCut = getProperty("RadiusCut");
+  const double waveCut = getProperty("WaveCut");
+  const double extraLength = getProperty("ExtraLength");
+
+  // Every thread sums into its own output bins, which are added up at the end
+  const bool runParallel =
+      Kernel::threadSafe(*m_dataWS, *outputWS, pixelAdj.get());
+  const int numThreads = runParallel ? PARALLEL_GET_MAX_THREADS : 1;
+  std::vector<QBinSums> threadSums(static_cast<size_t>(numThreads),
+                                   QBinSums(YOut.size()));
+
   const auto &spectrumInfo = m_dataWS->spectrumInfo();
-  PARALLEL_FOR_IF(Kernel::threadSafe(*m_dataWS, *outputWS, pixelAdj.get()))
+  PARALLEL_FOR_IF(runParallel)
   for (int i = 0; i < numSpec; ++i) {
     PARALLEL_START_INTERUPT_REGION
+    auto &sums = threadSums[static_cast<size_t>(PARALLEL_THREAD_NUMBER)];
     if (!spectrumInfo.hasDetectors(i)) {
       g_log.warning() << "Workspace index " << i << " (SpectrumIndex = "
                       << m_dataWS->getSpectrum(i).getSpectrumNo()
@@ -185,8 +221,7 @@ void Q1D2::exec() {
     // to calculate for
     // const size_t wavStart = waveLengthCutOff(i);
     const size_t wavStart = helper.waveLengthCutOff(m_dataWS, spectrumInfo,
-                                                    getProperty("RadiusCut"),
-                                                    getProperty("WaveCut"), i);
+                                                    radiusCut, waveCut, i);
     if (wavStart >= m_dataWS->y(i).size()) {
       // all the spectra in this detector are out of range
       continue;
@@ -210,8 +245,7 @@ void Q1D2::exec() {
                            binNormEs, norms, normETo2s);
 
     // now read the data from the input workspace, calculate Q for each bin
-    convertWavetoQ(spectrumInfo, i, doGravity, wavStart, QIn,
-                   getProperty("ExtraLength"));
+    convertWavetoQ(spectrumInfo, i, doGravity, wavStart, QIn, extraLength);
 
     // Pointers to the counts data and it's error
     auto YIn = m_dataWS->y(i).cbegin() + wavStart;
@@ -240,21 +274,19 @@ void Q1D2::exec() {
       if ((loc != QOut.begin()) && (loc != QOut.end())) {
         // the actual Q-bin to add something to
         const size_t bin = loc - QOut.begin() - 1;
-        PARALLEL_CRITICAL(q1d_counts_sum) {
-          YOut[bin] += *YIn;
-          normSum[bin] += *norms;
-          // these are the errors squared which will be summed and square rooted
-          // at the end
-          EOutTo2[bin] += (*EIn) * (*EIn);
-          normError2[bin] += *normETo2s;
-          if (useQResolution) {
-            auto QBin = (QOut[bin + 1] - QOut[bin]);
-            // Here we need to take into account the Bin width and the count
-            // weigthing. The
-            // formula should be YIN* sqrt(QResIn^2 + (QBin/sqrt(12))^2)
-            qResolutionOut[bin] +=
-                (*YIn) * std::sqrt((*QResIn) * (*QResIn) + QBin * QBin / 12.0);
-          }
+        sums.counts[bin] += *YIn;
+        sums.norms[bin] += *norms;
+        // these are the errors squared which will be summed and square rooted
+        // at the end
+        sums.countErrorsTo2[bin] += (*EIn) * (*EIn);
+        sums.normErrorsTo2[bin] += *normETo2s;
+        if (useQResolution) {
+          auto QBin = (QOut[bin + 1] - QOut[bin]);
+          // Here we need to take into account the Bin width and the count
+          // weigthing. The
+          // formula should be YIN* sqrt(QResIn^2 + (QBin/sqrt(12))^2)
+          sums.qResolution[bin] +=
+              (*YIn) * std::sqrt((*QResIn) * (*QResIn) + QBin * QBin / 12.0);
         }
       }
 
@@ -264,18 +296,27 @@ void Q1D2::exec() {
       }
     }
 
-    PARALLEL_CRITICAL(q1d_spectra_map) {
-      progress.report("Computing I(Q)");
-      // Add up the detector IDs in the output spectrum at workspace index 0
-      const auto &inSpec = m_dataWS->getSpectrum(i);
-      auto &outSpec = outputWS->getSpectrum(0);
-      outSpec.addDetectorIDs(inSpec.getDetectorIDs());
-    }
+    sums.spectra.push_back(static_cast<size_t>(i));
+    progress.report("Computing I(Q)");
 
     PARALLEL_END_INTERUPT_REGION
   }
   PARALLEL_CHECK_INTERUPT_REGION
 
+  // Add up the sums of the threads, always in the same order
+  auto &outSpec = outputWS->getSpectrum(0);
+  for (const auto &sums : threadSums) {
+    addSums(sums.counts, YOut);
+    addSums(sums.norms, normSum);
+    addSums(sums.countErrorsTo2, EOutTo2);
+    addSums(sums.normErrorsTo2, normError2);
+    if (useQResolution)
+      addSums(sums.qResolution, qResolutionOut);
+    // Add up the detector IDs in the output spectrum at workspace index 0
+    for (const auto i : sums.spectra)
+      outSpec.addDetectorIDs(m_dataWS->getSpectrum(i).getDetectorIDs());
+  }
+
   if (communicator().size() > 1) {
     int tag = 0;
     auto size = static_cast<int>(YOut.size());
@@ -35,6 +35,43 @@ using namespace Kernel;
 using namespace API;
 using namespace Geometry;
 
+namespace {
+/// The sums into the output Qx-Qy grid of the spectra handled by one thread.
+/// Bin (yIndex, xIndex) of the grid is element yIndex * width + xIndex.
+struct QxyGridSums {
+  /// Whether a bin has counts, and whether its sum was restarted after a NaN
+  enum BinState : unsigned char { Empty, Summed, Restarted };
+
+  QxyGridSums(const size_t height, const size_t width)
+      : width(width), counts(height * width, 0.0),
+        countErrorsTo2(height * width, 0.0), weights(height * width, 0.0),
+        weightErrorsTo2(height * width, 0.0), states(height * width, Empty) {}
+
+  /// Add a count and its squared error to a bin. A bin whose sum is NaN is
+  /// reset to zero by the next count, so a NaN count only stays in the output
+  /// if it is the last one added to its bin.
+  void addCount(const size_t bin, const double count,
+                const double errorTo2) {
+    if (std::isnan(counts[bin])) {
+      counts[bin] = 0.0;
+      countErrorsTo2[bin] = 0.0;
+      states[bin] = Restarted;
+    } else if (states[bin] == Empty) {
+      states[bin] = Summed;
+    }
+    counts[bin] += count;
+    countErrorsTo2[bin] += errorTo2;
+  }
+
+  size_t width;
+  std::vector<double> counts;
+  std::vector<double> countErrorsTo2;
+  std::vector<double> weights;
+  std::vector<double> weightErrorsTo2;
+  std::vector<BinState> states;
+};
+} // namespace
+
 void Qxy::init() {
   auto wsValidator = boost::make_shared<CompositeValidator>();
   wsValidator->add<WorkspaceUnitValidator>("Wavelength");
@@ -138,7 +175,26 @@ void Qxy::exec() {
   // moved to account for the beam centre
   const V3D samplePos = spectrumInfo.samplePosition();
 
+  const double radiusCut = getProperty("RadiusCut");
+  const double waveCut = getProperty("WaveCut");
+  const double extraLength = getProperty("ExtraLength");
+  const auto &axis = outputWorkspace->x(0);
+
+  // Every thread sums into its own grid, which are added up at the end
+  const bool runParallel =
+      Kernel::threadSafe(*inputWorkspace, pixelAdj.get(), waveAdj.get());
+  const int numThreads = runParallel ? PARALLEL_GET_MAX_THREADS : 1;
+  std::vector<QxyGridSums> threadSums(
+      static_cast<size_t>(numThreads),
+      QxyGridSums(outputWorkspace->getNumberHistograms(),
+                  outputWorkspace->blocksize()));
+
+  // The static schedule gives each thread a block of consecutive spectra, so
+  // the counts are added to each bin in the same order as by a serial loop
+  PRAGMA_OMP(parallel for schedule(static) if (runParallel))
   for (int64_t i = 0; i < int64_t(numSpec); ++i) {
+    PARALLEL_START_INTERUPT_REGION
+    auto &sums = threadSums[static_cast<size_t>(PARALLEL_THREAD_NUMBER)];
     if (!spectrumInfo.hasDetectors(i)) {
       g_log.warning() << "Workspace index " << i
                       << " has no detector assigned to it - discarding\n";
@@ -152,8 +208,7 @@ void Qxy::exec() {
     // get the bins that are included inside the RadiusCut/WaveCutcut off, those
     // to calculate for
     const size_t wavStart = helper.waveLengthCutOff(
-        inputWorkspace, spectrumInfo, getProperty("RadiusCut"),
-        getProperty("WaveCut"), i);
+        inputWorkspace, spectrumInfo, radiusCut, waveCut, i);
     if (wavStart >= inputWorkspace->y(i).size()) {
       // all the spectra in this detector are out of range
       continue;
@@ -173,8 +228,6 @@ void Qxy::exec() {
     const auto &Y = inputWorkspace->y(i);
     const auto &E = inputWorkspace->e(i);
 
-    const auto &axis = outputWorkspace->x(0);
-
     // the solid angle of the detector as seen by the sample is used for
     // normalisation later on
     double angle = 0.0;
@@ -204,7 +257,7 @@ void Qxy::exec() {
     // constructed once per spectrum
     GravitySANSHelper grav;
     if (doGravity) {
-      grav = GravitySANSHelper(spectrumInfo, i, getProperty("ExtraLength"));
+      grav = GravitySANSHelper(spectrumInfo, i, extraLength);
     }
 
     for (int j = static_cast<int>(numBins) - 1; j >= static_cast<int>(wavStart);
@@ -239,89 +292,110 @@ void Qxy::exec() {
           std::upper_bound(axis.begin(), axis.end(), Qx) - axis.begin() - 1;
       const int yIndex = static_cast<int>(
           std::upper_bound(axis.begin(), axis.end(), Qy) - axis.begin() - 1);
-      //      PARALLEL_CRITICAL(qxy)    /* Write to shared memory - must protect
-      //      */
-      {
-        // the data will be copied to this bin in the output array
-        double &outputBinY = outputWorkspace->mutableY(yIndex)[xIndex];
-        double &outputBinE = outputWorkspace->mutableE(yIndex)[xIndex];
-
-        if (std::isnan(outputBinY)) {
-          outputBinY = outputBinE = 0;
-        }
-        // Add the contents of the current bin to the 2D array.
-        outputBinY += Y[j];
-        // add the errors in quadranture
-        outputBinE = std::sqrt((outputBinE * outputBinE) + (E[j] * E[j]));
-
-        // account for masked bins
-        if (!maskFractions.empty()) {
-          maskFraction = maskFractions[j];
-        }
-        // add the total weight for this bin in the weights workspace,
-        // in an equivalent bin to where the data was stored
-
-        // first take into account the product of contributions to the weight
-        // which have no errors
-        double weight = 0.0;
-        if (doSolidAngle)
-          weight = maskFraction * angle;
-        else
-          weight = maskFraction;
-
-        // then the product of contributions which have errors, i.e. optional
-        // pixelAdj and waveAdj contributions
-        auto &outWeightsY = weights->mutableY(yIndex);
-        auto &outWeightsE = weights->mutableE(yIndex);
-
-        if (pixelAdj && waveAdj) {
-          auto pixelY = pixelAdj->y(i)[0];
-          auto pixelE = pixelAdj->e(i)[0];
-
-          auto waveY = waveAdj->y(0)[j];
-          auto waveE = waveAdj->e(0)[j];
-
-          outWeightsY[xIndex] += weight * pixelY * waveY;
-          const double pixelYSq = pixelY * pixelY;
-          const double pixelESq = pixelE * pixelE;
-          const double waveYSq = waveY * waveY;
-          const double waveESq = waveE * waveE;
-          // add product of errors from pixelAdj and waveAdj (note no error on
-          // weight is assumed)
-          outWeightsE[xIndex] +=
-              weight * weight * (waveESq * pixelYSq + pixelESq * waveYSq);
-        } else if (pixelAdj) {
-          auto pixelY = pixelAdj->y(i)[0];
-          auto pixelE = pixelAdj->e(i)[0];
-
-          outWeightsY[xIndex] += weight * pixelY;
-          const double pixelESq = weight * pixelE;
-          // add error from pixelAdj
-          outWeightsE[xIndex] += pixelESq * pixelESq;
-        } else if (waveAdj) {
-          auto waveY = waveAdj->y(0)[j];
-          auto waveE = waveAdj->e(0)[j];
-
-          outWeightsY[xIndex] += weight * waveY;
-          const double waveESq = weight * waveE;
-          // add error from waveAdj
-          outWeightsE[xIndex] += waveESq * waveESq;
-        } else
-          outWeightsY[xIndex] += weight;
+      // the data will be added to this bin of the grid
+      const size_t bin = static_cast<size_t>(yIndex) * sums.width +
+                         static_cast<size_t>(xIndex);
+
+      // Add the contents of the current bin to the 2D array, with the errors
+      // in quadrature
+      sums.addCount(bin, Y[j], E[j] * E[j]);
+
+      // account for masked bins
+      if (!maskFractions.empty()) {
+        maskFraction = maskFractions[j];
       }
+      // add the total weight for this bin in the weights workspace,
+      // in an equivalent bin to where the data was stored
+
+      // first take into account the product of contributions to the weight
+      // which have no errors
+      double weight = 0.0;
+      if (doSolidAngle)
+        weight = maskFraction * angle;
+      else
+        weight = maskFraction;
+
+      // then the product of contributions which have errors, i.e. optional
+      // pixelAdj and waveAdj contributions
+      if (pixelAdj && waveAdj) {
+        auto pixelY = pixelAdj->y(i)[0];
+        auto pixelE = pixelAdj->e(i)[0];
+
+        auto waveY = waveAdj->y(0)[j];
+        auto waveE = waveAdj->e(0)[j];
+
+        sums.weights[bin] += weight * pixelY * waveY;
+        const double pixelYSq = pixelY * pixelY;
+        const double pixelESq = pixelE * pixelE;
+        const double waveYSq = waveY * waveY;
+        const double waveESq = waveE * waveE;
+        // add product of errors from pixelAdj and waveAdj (note no error on
+        // weight is assumed)
+        sums.weightErrorsTo2[bin] +=
+            weight * weight * (waveESq * pixelYSq + pixelESq * waveYSq);
+      } else if (pixelAdj) {
+        auto pixelY = pixelAdj->y(i)[0];
+        auto pixelE = pixelAdj->e(i)[0];
+
+        sums.weights[bin] += weight * pixelY;
+        const double pixelESq = weight * pixelE;
+        // add error from pixelAdj
+        sums.weightErrorsTo2[bin] += pixelESq * pixelESq;
+      } else if (waveAdj) {
+        auto waveY = waveAdj->y(0)[j];
+        auto waveE = waveAdj->e(0)[j];
+
+        sums.weights[bin] += weight * waveY;
+        const double waveESq = weight * waveE;
+        // add error from waveAdj
+        sums.weightErrorsTo2[bin] += waveESq * waveESq;
+      } else
+        sums.weights[bin] += weight;
     } // loop over single spectrum
 
     prog.report("Calculating Q");
 
+    PARALLEL_END_INTERUPT_REGION
   } // loop over all spectra
-
-  // take sqrt of error weight values
-  // left to be executed here for computational efficiency
-  size_t numHist = weights->getNumberHistograms();
-  for (size_t i = 0; i < numHist; i++) {
-    auto &weightsE = weights->mutableE(i);
-    std::transform(weightsE.cbegin(), weightsE.cend(), weightsE.begin(),
-                   [&](double val) { return sqrt(val); });
+  PARALLEL_CHECK_INTERUPT_REGION
+
+  // Add up the grids of the threads, always in the same order, and take the
+  // sqrt of the summed squares of the errors
+  const size_t numHist = weights->getNumberHistograms();
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int64_t row = 0; row < static_cast<int64_t>(numHist); ++row) {
+    const auto yIndex = static_cast<size_t>(row);
+    auto &outputY = outputWorkspace->mutableY(yIndex);
+    auto &outputE = outputWorkspace->mutableE(yIndex);
+    auto &weightsY = weights->mutableY(yIndex);
+    auto &weightsE = weights->mutableE(yIndex);
+    for (size_t xIndex = 0; xIndex < outputY.size(); ++xIndex) {
+      double counts = 0.;
+      double countErrorsTo2 = 0.;
+      double weight = 0.;
+      double weightErrorsTo2 = 0.;
+      for (const auto &sums : threadSums) {
+        const size_t bin = yIndex * sums.width + xIndex;
+        if (sums.states[bin] == QxyGridSums::Restarted) {
+          // A NaN within the spectra of this thread reset the sum
+          counts = sums.counts[bin];
+          countErrorsTo2 = sums.countErrorsTo2[bin];
+        } else if (sums.states[bin] == QxyGridSums::Summed) {
+          if (std::isnan(counts)) {
+            counts = 0.;
+            countErrorsTo2 = 0.;
+          }
+          counts += sums.counts[bin];
+          countErrorsTo2 += sums.countErrorsTo2[bin];
+        }
+        weight += sums.weights[bin];
+        weightErrorsTo2 += sums.weightErrorsTo2[bin];
+      }
+      outputY[xIndex] = counts;
+      outputE[xIndex] = std::sqrt(countErrorsTo2);
+      weightsY[xIndex] = weight;
+      weightsE[xIndex] = std::sqrt(weightErrorsTo2);
+    }
   }
 
   bool doOutputParts = getProperty("OutputParts");
@@ -128,11 +128,26 @@ void Rebin2D::exec() {
   const auto nreports(static_cast<size_t>(numYBins));
   m_progress = std::make_unique<API::Progress>(this, 0.0, 1.0, nreports);
 
-  PARALLEL_FOR_IF(Kernel::threadSafe(*inputWS, *outputWS))
+  // Each thread sums into its own copy of the output grid, so no locking is
+  // needed while the polygons are rebinned
+  const auto &outputX = outputWS->x(0).rawData();
+  // Fewer threads are used if the copies would take too much memory
+  const int numThreads = Kernel::threadSafe(*inputWS, *outputWS)
+                             ? FractionalRebinning::numberOfPartialSums(
+                                   *outputWS, useFractionalArea)
+                             : 1;
+  const bool runParallel = numThreads > 1;
+  using FractionalRebinning::PartialSums;
+  std::vector<PartialSums> threadSums(
+      numThreads, PartialSums(outputWS->getNumberHistograms(),
+                              outputWS->blocksize(), useFractionalArea));
+
+  PRAGMA_OMP(parallel for num_threads(numThreads) if (runParallel))
   for (int64_t i = 0; i < static_cast<int64_t>(numYBins); ++i) {
     PARALLEL_START_INTERUPT_REGION
 
     m_progress->report("Computing polygon intersections");
+    auto &sums = threadSums[PARALLEL_THREAD_NUMBER];
     const double vlo = oldYEdges[i];
     const double vhi = oldYEdges[i + 1];
     for (size_t j = 0; j < numXBins; ++j) {
@@ -142,11 +157,11 @@ void Rebin2D::exec() {
       const double x_jp1 = oldXEdges[j + 1];
       Quadrilateral inputQ(x_j, x_jp1, vlo, vhi);
       if (!useFractionalArea) {
-        FractionalRebinning::rebinToOutput(std::move(inputQ), inputWS, i, j,
-                                           *outputWS, newYBins.rawData());
+        FractionalRebinning::rebinToOutput(inputQ, inputWS, i, j, sums,
+                                           outputX, newYBins.rawData());
       } else {
         FractionalRebinning::rebinToFractionalOutput(
-            std::move(inputQ), inputWS, i, j, *outputRB, newYBins.rawData(),
+            inputQ, inputWS, i, j, sums, outputX, newYBins.rawData(),
             inputHasFA);
       }
     }
@@ -154,6 +169,8 @@ void Rebin2D::exec() {
     PARALLEL_END_INTERUPT_REGION
   }
   PARALLEL_CHECK_INTERUPT_REGION
+  FractionalRebinning::addToOutput(threadSums, *outputWS);
+  threadSums.clear();
   if (useFractionalArea) {
     outputRB->finalize(true, true);
   }
@@ -398,7 +398,23 @@ void SofQWNormalisedPolygon::exec() {
   const auto &inputIndices = inputWS->indexInfo();
   const auto &spectrumInfo = inputWS->spectrumInfo();
 
-  PARALLEL_FOR_IF(Kernel::threadSafe(*inputWS, *outputWS))
+  // Each thread sums into its own copy of the output grid and detector
+  // mapping, so no locking is needed while the polygons are rebinned
+  const auto &outputX = outputWS->x(0).rawData();
+  // Fewer threads are used if the copies would take too much memory
+  const int numThreads =
+      Kernel::threadSafe(*inputWS, *outputWS)
+          ? FractionalRebinning::numberOfPartialSums(*outputWS, true)
+          : 1;
+  const bool runParallel = numThreads > 1;
+  using FractionalRebinning::PartialSums;
+  std::vector<PartialSums> threadSums(
+      numThreads, PartialSums(outputWS->getNumberHistograms(),
+                              outputWS->blocksize(), true));
+  std::vector<std::vector<SpectrumDefinition>> threadMappings(
+      numThreads, std::vector<SpectrumDefinition>(detIDMapping.size()));
+
+  PRAGMA_OMP(parallel for num_threads(numThreads) if (runParallel))
   for (int64_t i = 0; i < static_cast<int64_t>(nHistos); ++i) {
     PARALLEL_START_INTERUPT_REGION
 
@@ -407,9 +423,19 @@ void SofQWNormalisedPolygon::exec() {
     }
     const auto *det =
         m_EmodeProperties.m_emode == 1 ? nullptr : &spectrumInfo.detector(i);
+    auto &sums = threadSums[PARALLEL_THREAD_NUMBER];
+    auto &mapping = threadMappings[PARALLEL_THREAD_NUMBER];
 
     const double thetaLower = m_twoThetaLowers[i];
     const double thetaUpper = m_twoThetaUppers[i];
+    // Neighbouring polygons share their corners, so Q is computed once for
+    // each energy bin edge
+    std::vector<double> qLower(nEnergyBins + 1);
+    std::vector<double> qUpper(nEnergyBins + 1);
+    for (size_t j = 0; j <= nEnergyBins; ++j) {
+      qLower[j] = m_EmodeProperties.q(X[j], thetaLower, det);
+      qUpper[j] = m_EmodeProperties.q(X[j], thetaUpper, det);
+    }
 
     const auto specNo = static_cast<specnum_t>(inputIndices.spectrumNumber(i));
     std::stringstream logStream;
@@ -420,12 +446,12 @@ void SofQWNormalisedPolygon::exec() {
       const double dE_j = X[j];
       const double dE_jp1 = X[j + 1];
 
-      const double lrQ = m_EmodeProperties.q(dE_jp1, thetaLower, det);
+      const double lrQ = qLower[j + 1];
 
-      const V2D ll(dE_j, m_EmodeProperties.q(dE_j, thetaLower, det));
+      const V2D ll(dE_j, qLower[j]);
       const V2D lr(dE_jp1, lrQ);
-      const V2D ur(dE_jp1, m_EmodeProperties.q(dE_jp1, thetaUpper, det));
-      const V2D ul(dE_j, m_EmodeProperties.q(dE_j, thetaUpper, det));
+      const V2D ur(dE_jp1, qUpper[j + 1]);
+      const V2D ul(dE_j, qUpper[j]);
       if (g_log.is(Logger::Priority::PRIO_DEBUG)) {
         logStream << "Spectrum=" << specNo
                   << ", lower theta=" << thetaLower * rad2deg
@@ -436,20 +462,17 @@ void SofQWNormalisedPolygon::exec() {
 
       using FractionalRebinning::rebinToFractionalOutput;
       rebinToFractionalOutput(Quadrilateral(ll, lr, ur, ul), inputWS, i, j,
-                              *outputWS, m_Qout);
+                              sums, outputX, m_Qout);
 
       // Find which q bin this point lies in
       const MantidVec::difference_type qIndex =
           std::upper_bound(m_Qout.begin(), m_Qout.end(), lrQ) - m_Qout.begin();
       if (qIndex != 0 && qIndex < static_cast<int>(m_Qout.size())) {
-        // Add this spectra-detector pair to the mapping
-        PARALLEL_CRITICAL(SofQWNormalisedPolygon_spectramap) {
-          // Could do a more complete merge of spectrum definitions here, but
-          // historically only the ID of the first detector in the spectrum is
-          // used, so I am keeping that for now.
-          detIDMapping[qIndex - 1].add(
-              spectrumInfo.spectrumDefinition(i)[0].first);
-        }
+        // Add this spectra-detector pair to the mapping.
+        // Could do a more complete merge of spectrum definitions here, but
+        // historically only the ID of the first detector in the spectrum is
+        // used, so I am keeping that for now.
+        mapping[qIndex - 1].add(spectrumInfo.spectrumDefinition(i)[0].first);
       }
     }
     if (g_log.is(Logger::Priority::PRIO_DEBUG)) {
@@ -460,6 +483,16 @@ void SofQWNormalisedPolygon::exec() {
   }
   PARALLEL_CHECK_INTERUPT_REGION
 
+  FractionalRebinning::addToOutput(threadSums, *outputWS);
+  threadSums.clear();
+  for (const auto &mapping : threadMappings) {
+    for (size_t qIndex = 0; qIndex < mapping.size(); ++qIndex) {
+      for (size_t k = 0; k < mapping[qIndex].size(); ++k)
+        detIDMapping[qIndex].add(mapping[qIndex][k].first,
+                                 mapping[qIndex][k].second);
+    }
+  }
+
   outputWS->finalize();
   FractionalRebinning::normaliseOutput(outputWS, inputWS, m_progress.get());
 
@@ -12,6 +12,7 @@
 #include "MantidAPI/MatrixWorkspace.h"
 #include "MantidAlgorithms/CompareWorkspaces.h"
 #include "MantidAlgorithms/ConvertToMatrixWorkspace.h"
+#include "MantidDataObjects/ContiguousWorkspace2D.h"
 #include "MantidDataObjects/EventWorkspace.h"
 #include "MantidGeometry/Instrument.h"
 #include "MantidTestHelpers/WorkspaceCreationHelper.h"
@@ -86,6 +87,10 @@ public:
     if (!out)
       return;
 
+    // All spectra have the same number of bins, so the counts are stored in
+    // contiguous blocks
+    TS_ASSERT(boost::dynamic_pointer_cast<
+              Mantid::DataObjects::ContiguousWorkspace2D>(out));
     TS_ASSERT_EQUALS(in->getNumberHistograms(), out->getNumberHistograms());
     TS_ASSERT_EQUALS(in->getInstrument()->getName(),
                      out->getInstrument()->getName());
@@ -100,4 +100,40 @@ private:
   Mantid::Algorithms::CreateSingleValuedWorkspace algNoErr, algWithErr;
 };
 
+/// Measures the fixed cost of running a trivial algorithm many times
+class CreateSingleValuedWorkspaceTestPerformance : public CxxTest::TestSuite {
+public:
+  static CreateSingleValuedWorkspaceTestPerformance *createSuite() {
+    return new CreateSingleValuedWorkspaceTestPerformance();
+  }
+  static void destroySuite(CreateSingleValuedWorkspaceTestPerformance *suite) {
+    Mantid::API::AnalysisDataService::Instance().clear();
+    delete suite;
+  }
+
+  void test_many_child_executions() {
+    for (int i = 0; i < NUMBER_OF_CALLS; ++i) {
+      Mantid::Algorithms::CreateSingleValuedWorkspace alg;
+      alg.setChild(true);
+      alg.initialize();
+      alg.setProperty("DataValue", static_cast<double>(i));
+      alg.setPropertyValue("OutputWorkspace", "dummy");
+      alg.execute();
+    }
+  }
+
+  void test_many_top_level_executions() {
+    for (int i = 0; i < NUMBER_OF_CALLS; ++i) {
+      Mantid::Algorithms::CreateSingleValuedWorkspace alg;
+      alg.initialize();
+      alg.setProperty("DataValue", static_cast<double>(i));
+      alg.setPropertyValue("OutputWorkspace", "single");
+      alg.execute();
+    }
+  }
+
+private:
+  static constexpr int NUMBER_OF_CALLS = 10000;
+};
+
 #endif // CREATESINGLEVALUEDWORKSPACETEST_H_
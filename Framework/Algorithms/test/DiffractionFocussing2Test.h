@@ -102,6 +102,67 @@ public:
     dotestEventWorkspace(false, 1, false);
   }
 
+  void test_EventWorkspace_mixedEventTypes() {
+    const int bankWidthInPixels = 4;
+    EventWorkspace_sptr inputW =
+        WorkspaceCreationHelper::createEventWorkspaceWithFullInstrument(
+            3, bankWidthInPixels);
+    inputW->getAxis(0)->unit() = UnitFactory::Instance().create("dSpacing");
+    // Every other pixel has a weighted event with a weight of 2
+    for (size_t pix = 0; pix < inputW->getNumberHistograms(); pix++) {
+      inputW->setHistogram(pix, BinEdges{1., 2., 1e6});
+      auto &spectrum = inputW->getSpectrum(pix);
+      if (pix % 2 == 0) {
+        spectrum.addEventQuickly(TofEvent(1000.0 + static_cast<double>(pix)));
+      } else {
+        spectrum.switchTo(WEIGHTED);
+        spectrum.addEventQuickly(WeightedEvent(
+            TofEvent(1000.0 + static_cast<double>(pix)), 2.0, 4.0));
+      }
+    }
+    const std::string groupWSName("DiffractionFocussing2Test_mixed_group");
+    AnalysisDataService::Instance().addOrReplace(
+        "DiffractionFocussing2Test_mixed", inputW);
+    FrameworkManager::Instance().exec("CreateGroupingWorkspace", 6,
+                                      "InputWorkspace",
+                                      "DiffractionFocussing2Test_mixed",
+                                      "GroupNames", "bank2,bank3",
+                                      "OutputWorkspace", groupWSName.c_str());
+
+    DiffractionFocussing2 alg;
+    alg.initialize();
+    alg.setChild(true);
+    alg.setProperty("InputWorkspace", inputW);
+    alg.setPropertyValue("OutputWorkspace", "unused");
+    alg.setPropertyValue("GroupingWorkspace", groupWSName);
+    TS_ASSERT_THROWS_NOTHING(alg.execute())
+    MatrixWorkspace_sptr output = alg.getProperty("OutputWorkspace");
+    auto outputEvent = boost::dynamic_pointer_cast<EventWorkspace>(output);
+    TS_ASSERT(outputEvent)
+    if (!outputEvent)
+      return;
+
+    TS_ASSERT_EQUALS(outputEvent->getNumberHistograms(), 2)
+    const size_t pixelsPerBank = bankWidthInPixels * bankWidthInPixels;
+    for (size_t wi = 0; wi < outputEvent->getNumberHistograms(); ++wi) {
+      const auto &spectrum = outputEvent->getSpectrum(wi);
+      TS_ASSERT_EQUALS(spectrum.getEventType(), WEIGHTED)
+      const auto &events = spectrum.getWeightedEvents();
+      TS_ASSERT_EQUALS(events.size(), pixelsPerBank)
+      TS_ASSERT_EQUALS(spectrum.getDetectorIDs().size(), pixelsPerBank)
+      // The events keep the order of the input spectra
+      double totalWeight = 0.;
+      for (size_t i = 0; i < events.size(); ++i) {
+        if (i > 0)
+          TS_ASSERT_LESS_THAN(events[i - 1].tof(), events[i].tof())
+        totalWeight += events[i].weight();
+      }
+      TS_ASSERT_DELTA(totalWeight, 1.5 * pixelsPerBank, 1e-12)
+    }
+    AnalysisDataService::Instance().remove("DiffractionFocussing2Test_mixed");
+    AnalysisDataService::Instance().remove(groupWSName);
+  }
+
   void dotestEventWorkspace(bool inplace, size_t numgroups,
                             bool preserveEvents = true,
                             int bankWidthInPixels = 16) {
@@ -32,6 +32,11 @@ using namespace Mantid::Kernel;
 using namespace std;
 
 namespace {
+/// The time a number of seconds after the epoch
+Types::Core::DateAndTime second(const size_t seconds) {
+  return Types::Core::DateAndTime(static_cast<int64_t>(seconds) * 1000000000);
+}
+
 //----------------------------------------------------------------------------------------------
 /** Create an EventWorkspace containing an integer log
  * 1. Run start  = 10  (s)
@@ -307,6 +312,52 @@ public:
     return;
   }
 
+  //----------------------------------------------------------------------------------------------
+  /** Generate filter by a single log value in increasing direction, where the
+   * log has entries that do not change its value. Such entries keep the
+   * status of the entry before them.
+   */
+  void test_genSingleLogValueFilterWithPlateaus() {
+    EventWorkspace_sptr eventWS = createEventWorkspaceIntLog();
+    const std::vector<double> values{0., 1., 2., 2., 2., 3.,
+                                     2., 1., 1., 0., 1., 2.};
+    auto steplog = std::make_unique<TimeSeriesProperty<double>>("StepLog");
+    for (size_t i = 0; i < values.size(); ++i)
+      steplog->addValue(second(10 + i), values[i]);
+    eventWS->mutableRun().addProperty(std::move(steplog), true);
+
+    GenerateEventsFilter alg;
+    alg.initialize();
+    TS_ASSERT_THROWS_NOTHING(alg.setProperty("InputWorkspace", eventWS));
+    TS_ASSERT_THROWS_NOTHING(alg.setProperty("OutputWorkspace", "Splitters"));
+    TS_ASSERT_THROWS_NOTHING(alg.setProperty("LogName", "StepLog"));
+    TS_ASSERT_THROWS_NOTHING(alg.setProperty("MinimumLogValue", "0.5"));
+    TS_ASSERT_THROWS_NOTHING(alg.setProperty("MaximumLogValue", "2.5"));
+    TS_ASSERT_THROWS_NOTHING(
+        alg.setProperty("FilterLogValueByChangingDirection", "Increase"));
+    TS_ASSERT_THROWS_NOTHING(alg.setProperty("LogBoundary", "Left"));
+    TS_ASSERT_THROWS_NOTHING(
+        alg.setProperty("InformationWorkspace", "Information"));
+    TS_ASSERT_THROWS_NOTHING(alg.execute());
+    TS_ASSERT(alg.isExecuted());
+
+    SplittersWorkspace_sptr splittersws =
+        boost::dynamic_pointer_cast<SplittersWorkspace>(
+            AnalysisDataService::Instance().retrieve("Splitters"));
+    TS_ASSERT(splittersws);
+    TS_ASSERT_EQUALS(splittersws->getNumberSplitters(), 2);
+    if (splittersws->getNumberSplitters() == 2) {
+      // The plateau at 2 is part of the rise, the one at 1 of the fall
+      TS_ASSERT_EQUALS(splittersws->getSplitter(0).start(), second(11));
+      TS_ASSERT_EQUALS(splittersws->getSplitter(0).stop(), second(15));
+      TS_ASSERT_EQUALS(splittersws->getSplitter(1).start(), second(20));
+      TS_ASSERT_EQUALS(splittersws->getSplitter(1).stop(), second(21));
+    }
+
+    AnalysisDataService::Instance().remove("Splitters");
+    AnalysisDataService::Instance().remove("Information");
+  }
+
   //----------------------------------------------------------------------------------------------
   /** Generate filter by log values in increasing
    * (1) No time tolerance
@@ -1214,7 +1265,58 @@ public:
     alg.isExecuted();
   }
 
+  void testPerformanceSingleValueFastLog() {
+    addFastLog();
+    GenerateEventsFilter alg;
+    alg.initialize();
+    alg.setProperty("InputWorkspace", inputEvent);
+    alg.setProperty("OutputWorkspace", "output");
+    alg.setProperty("InformationWorkspace", "infoOutput");
+    alg.setProperty("LogName", "FastLog");
+    alg.setProperty("MinimumLogValue", -0.5);
+    alg.setProperty("MaximumLogValue", 0.5);
+    alg.setProperty("FilterLogValueByChangingDirection", "Increase");
+    alg.setProperty("FastLog", true);
+    alg.execute();
+    TS_ASSERT(alg.isExecuted());
+  }
+
+  void testPerformanceMultipleValuesFastLogParallel() {
+    addFastLog();
+    GenerateEventsFilter alg;
+    alg.initialize();
+    alg.setProperty("InputWorkspace", inputEvent);
+    alg.setProperty("OutputWorkspace", "output");
+    alg.setProperty("InformationWorkspace", "infoOutput");
+    alg.setProperty("LogName", "FastLog");
+    alg.setProperty("MinimumLogValue", -1.);
+    alg.setProperty("MaximumLogValue", 1.);
+    alg.setProperty("LogValueInterval", 0.1);
+    alg.setProperty("FilterLogValueByChangingDirection", "Both");
+    alg.setProperty("UseParallelProcessing", "Parallel");
+    alg.execute();
+    TS_ASSERT(alg.isExecuted());
+  }
+
 private:
+  /// Add a sine log with an entry every 10 microseconds over the run
+  void addFastLog() {
+    const int64_t start = 10000000000;
+    const int64_t step = 10000;
+    const size_t numEntries = 1200000;
+    std::vector<Types::Core::DateAndTime> times;
+    std::vector<double> values;
+    times.reserve(numEntries);
+    values.reserve(numEntries);
+    for (size_t i = 0; i < numEntries; ++i) {
+      times.emplace_back(start + static_cast<int64_t>(i) * step);
+      values.push_back(std::sin(static_cast<double>(i) * 1.e-3));
+    }
+    inputEvent->mutableRun().addProperty(
+        std::make_unique<TimeSeriesProperty<double>>("FastLog", times, values),
+        true);
+  }
+
   Mantid::DataObjects::EventWorkspace_sptr inputEvent;
 };
 
@@ -12,6 +12,7 @@
 #include "MantidAPI/AnalysisDataService.h"
 #include "MantidAPI/WorkspaceFactory.h"
 #include "MantidAlgorithms/Integration.h"
+#include "MantidDataObjects/ContiguousWorkspace2D.h"
 #include "MantidDataObjects/EventWorkspace.h"
 #include "MantidDataObjects/RebinnedOutput.h"
 #include "MantidDataObjects/Workspace2D.h"
@@ -99,6 +100,11 @@ public:
 
     Workspace2D_sptr output2D =
         boost::dynamic_pointer_cast<Workspace2D>(output);
+    // The integrals are stored in contiguous blocks
+    auto contiguous =
+        boost::dynamic_pointer_cast<ContiguousWorkspace2D>(output);
+    TS_ASSERT(contiguous);
+    TS_ASSERT(contiguous->allInBlocks());
     size_t max = 0;
     TS_ASSERT_EQUALS(max = output2D->getNumberHistograms(), 3);
     double yy[3] = {36, 51, 66};
@@ -809,6 +815,9 @@ private:
     TS_ASSERT_EQUALS(max = output2D->getNumberHistograms(), 3);
     const double yy[3] = {52., 74., 96.};
     const double ee[3] = {6.899, 8.240, 9.391};
+    // The common integration range is stored only once
+    for (size_t i = 1; i < max; ++i)
+      TS_ASSERT_EQUALS(&output2D->x(i), &output2D->x(0));
     for (size_t i = 0; i < max; ++i) {
       Mantid::MantidVec &x = output2D->dataX(i);
       Mantid::MantidVec &y = output2D->dataY(i);
@@ -15,7 +15,9 @@
 #include "MantidAlgorithms/Plus.h"
 #include "MantidAlgorithms/Rebin.h"
 #include "MantidAPI/AnalysisDataService.h"
+#include "MantidDataObjects/ContiguousWorkspace2D.h"
 #include "MantidDataObjects/Workspace2D.h"
+#include "MantidDataObjects/WorkspaceCreation.h"
 #include "MantidAPI/WorkspaceProperty.h"
 #include "MantidAPI/WorkspaceOpOverloads.h"
 
@@ -185,6 +187,44 @@ public:
         DO_PLUS ? 4.0 : 0.0,   2.0);
   }
 
+  void test_2D_2D_Contiguous()
+  {
+    MatrixWorkspace_sptr work_in1 = createContiguous(histWS_5x10_bin);
+    MatrixWorkspace_sptr work_in2 = createContiguous(histWS_5x10_bin);
+    performTest(work_in1,work_in2, false /*not inplace*/, false /*not event*/,
+        DO_PLUS ? 4.0 : 0.0,   2.0);
+  }
+
+  void test_2D_2D_Contiguous_inplace()
+  {
+    MatrixWorkspace_sptr work_in1 = createContiguous(histWS_5x10_bin);
+    MatrixWorkspace_sptr work_in2 = histWS_5x10_bin;
+    performTest(work_in1,work_in2, true /*inplace*/, false /*not event*/,
+        DO_PLUS ? 4.0 : 0.0,   2.0);
+  }
+
+  void test_2D_Contiguous_SingleValue()
+  {
+    MatrixWorkspace_sptr work_in1 = createContiguous(histWS_5x10_bin);
+    MatrixWorkspace_sptr work_in2 = WorkspaceCreationHelper::createWorkspaceSingleValue(4.455);
+    performTest(work_in1,work_in2, false /*not inplace*/, false /*not event*/,
+        DO_PLUS ? 6.455 : -2.455,   2.5406);
+  }
+
+  void test_2D_2D_Contiguous_stays_in_blocks()
+  {
+    MatrixWorkspace_sptr work_in1 = createContiguous(histWS_5x10_bin);
+    MatrixWorkspace_sptr work_in2 = createContiguous(histWS_5x10_bin);
+    MatrixWorkspace_sptr out = DO_PLUS ? work_in1 + work_in2 : work_in1 - work_in2;
+    auto contiguous = boost::dynamic_pointer_cast<ContiguousWorkspace2D>(out);
+    TS_ASSERT(contiguous);
+    if (!contiguous)
+      return;
+    TS_ASSERT(contiguous->allInBlocks());
+    TS_ASSERT_EQUALS(contiguous->blockY()[12], DO_PLUS ? 4.0 : 0.0);
+    TS_ASSERT_DELTA(contiguous->blockE()[12], 2.0, 1e-12);
+  }
+
   void test_2D_2D_NotHistograms()
   {
     MatrixWorkspace_sptr work_in1 = histWS_5x10_123;
@@ -638,6 +678,12 @@ public:
    * @param allWorkspacesSameName :: do A = A + A
    * @return the created workspace
    */
+  /// A workspace with the data of ws, stored in contiguous blocks
+  MatrixWorkspace_sptr createContiguous(const MatrixWorkspace_sptr ws)
+  {
+    return DataObjects::create<ContiguousWorkspace2D>(*ws, ws->histogram(0));
+  }
+
   MatrixWorkspace_sptr performTest(const MatrixWorkspace_sptr work_in1, const MatrixWorkspace_sptr work_in2, bool doInPlace = false,
       bool outputIsEvent = false, double expectedValue=-1.0, double expectedError=-1.0,
       bool allWorkspacesSameName = false, bool algorithmWillCommute = false,
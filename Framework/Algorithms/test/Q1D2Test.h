@@ -15,11 +15,13 @@
 #include "MantidDataHandling/LoadRKH.h"
 #include "MantidDataHandling/LoadRaw3.h"
 #include "MantidDataHandling/MaskDetectors.h"
+#include "MantidKernel/MultiThreaded.h"
 #include <cxxtest/TestSuite.h>
 
 #include "MantidTestHelpers/WorkspaceCreationHelper.h"
 
 #include <algorithm>
+#include <cmath>
 
 using namespace Mantid::API;
 using namespace Mantid::Kernel;
@@ -53,6 +55,12 @@ void createQResolutionWorkspace(Mantid::API::MatrixWorkspace_sptr &qResolution,
                                 Mantid::API::MatrixWorkspace_sptr &alteredInput,
                                 Mantid::API::MatrixWorkspace_sptr &input,
                                 double value1, double value2);
+std::vector<Mantid::API::MatrixWorkspace_sptr>
+runQ1DWithGravityAndParts(const Mantid::API::MatrixWorkspace_sptr &input,
+                          const Mantid::API::MatrixWorkspace_sptr &wave,
+                          const Mantid::API::MatrixWorkspace_sptr &pixels);
+void assertSameValues(const std::vector<double> &expected,
+                      const std::vector<double> &actual);
 
 class Q1D2Test : public CxxTest::TestSuite {
 public:
@@ -496,6 +504,27 @@ public:
     Mantid::API::AnalysisDataService::Instance().remove(outputWS);
   }
 
+  void test_results_do_not_depend_on_the_number_of_threads() {
+    Mantid::API::MatrixWorkspace_sptr masked(m_inputWS->clone());
+    for (size_t i = 0; i < masked->getNumberHistograms(); i += 3) {
+      masked->flagMasked(i, 20, 0.5);
+      masked->flagMasked(i, 21);
+    }
+
+    const int maxThreads = PARALLEL_GET_MAX_THREADS;
+    PARALLEL_SET_NUM_THREADS(1);
+    const auto serial = runQ1DWithGravityAndParts(masked, m_wavNorm, m_pixel);
+    PARALLEL_SET_NUM_THREADS(maxThreads);
+    const auto parallel =
+        runQ1DWithGravityAndParts(masked, m_wavNorm, m_pixel);
+
+    TS_ASSERT_EQUALS(serial.size(), parallel.size())
+    for (size_t i = 0; i < serial.size(); ++i) {
+      assertSameValues(serial[i]->y(0).rawData(), parallel[i]->y(0).rawData());
+      assertSameValues(serial[i]->e(0).rawData(), parallel[i]->e(0).rawData());
+    }
+  }
+
   /// stop the constructor from being run every time algorithms test suite is
   /// initialised
   static Q1D2Test *createSuite() { return new Q1D2Test(); }
@@ -539,6 +568,40 @@ public:
   }
 };
 
+/// Run Q1D as a child with gravity and the output parts
+std::vector<Mantid::API::MatrixWorkspace_sptr>
+runQ1DWithGravityAndParts(const Mantid::API::MatrixWorkspace_sptr &input,
+                          const Mantid::API::MatrixWorkspace_sptr &wave,
+                          const Mantid::API::MatrixWorkspace_sptr &pixels) {
+  Mantid::Algorithms::Q1D2 Q1D;
+  Q1D.setChild(true);
+  Q1D.initialize();
+  Q1D.setProperty("DetBankWorkspace", input);
+  Q1D.setProperty("WavelengthAdj", wave);
+  Q1D.setProperty("PixelAdj", pixels);
+  Q1D.setPropertyValue("OutputWorkspace", "unused");
+  Q1D.setPropertyValue("OutputBinning", "0.1,-0.02,0.5");
+  Q1D.setProperty("AccountForGravity", true);
+  Q1D.setProperty("OutputParts", true);
+  Q1D.execute();
+  return {Q1D.getProperty("OutputWorkspace"), Q1D.getProperty("SumOfCounts"),
+          Q1D.getProperty("sumOfNormFactors")};
+}
+
+/// Values summed in a different order only differ by rounding
+void assertSameValues(const std::vector<double> &expected,
+                      const std::vector<double> &actual) {
+  TS_ASSERT_EQUALS(expected.size(), actual.size())
+  for (size_t i = 0; i < std::min(expected.size(), actual.size()); ++i) {
+    if (std::isnan(expected[i])) {
+      TS_ASSERT(std::isnan(actual[i]))
+    } else {
+      const double tolerance = 1e-10 * std::max(1., std::abs(expected[i]));
+      TS_ASSERT_DELTA(actual[i], expected[i], tolerance)
+    }
+  }
+}
+
 void createInputWorkspaces(int start, int end,
                            Mantid::API::MatrixWorkspace_sptr &input,
                            Mantid::API::MatrixWorkspace_sptr &wave,
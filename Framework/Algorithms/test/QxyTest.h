@@ -12,11 +12,47 @@
 #include "MantidAlgorithms/ConvertUnits.h"
 #include "MantidAlgorithms/Qxy.h"
 #include "MantidDataHandling/LoadRaw3.h"
+#include "MantidKernel/MultiThreaded.h"
 #include <cxxtest/TestSuite.h>
 
+#include <algorithm>
+#include <cmath>
+
 using namespace Mantid::API;
 using namespace Mantid::Kernel;
 
+namespace {
+/// Run Qxy as a child with gravity and the output parts on the given input
+std::vector<MatrixWorkspace_sptr> runQxy(const MatrixWorkspace_sptr &input) {
+  Mantid::Algorithms::Qxy qxy;
+  qxy.setChild(true);
+  qxy.initialize();
+  qxy.setProperty("InputWorkspace", input);
+  qxy.setPropertyValue("OutputWorkspace", "unused");
+  qxy.setPropertyValue("MaxQxy", "0.1");
+  qxy.setPropertyValue("DeltaQ", "0.002");
+  qxy.setProperty("AccountForGravity", true);
+  qxy.setProperty("OutputParts", true);
+  qxy.execute();
+  return {qxy.getProperty("OutputWorkspace"), qxy.getProperty("SumOfCounts"),
+          qxy.getProperty("sumOfNormFactors")};
+}
+
+/// Values summed in a different order only differ by rounding
+void assertSameValues(const std::vector<double> &expected,
+                      const std::vector<double> &actual) {
+  TS_ASSERT_EQUALS(expected.size(), actual.size())
+  for (size_t i = 0; i < std::min(expected.size(), actual.size()); ++i) {
+    if (std::isnan(expected[i])) {
+      TS_ASSERT(std::isnan(actual[i]))
+    } else {
+      const double tolerance = 1e-10 * std::max(1., std::abs(expected[i]));
+      TS_ASSERT_DELTA(actual[i], expected[i], tolerance)
+    }
+  }
+}
+} // namespace
+
 class QxyTest : public CxxTest::TestSuite {
 public:
   // This pair of boilerplate methods prevent the suite being created statically
@@ -120,6 +156,75 @@ public:
     Mantid::API::AnalysisDataService::Instance().remove(outputWS);
   }
 
+  void test_results_do_not_depend_on_the_number_of_threads() {
+    // inputWS was set up by testNoGravity
+    auto input = AnalysisDataService::Instance()
+                     .retrieveWS<MatrixWorkspace>(m_inputWS)
+                     ->clone();
+    for (size_t i = 0; i < input->getNumberHistograms(); i += 3) {
+      input->flagMasked(i, 40, 0.5);
+      input->flagMasked(i, 41);
+    }
+    const MatrixWorkspace_sptr masked(std::move(input));
+
+    const int maxThreads = PARALLEL_GET_MAX_THREADS;
+    PARALLEL_SET_NUM_THREADS(1);
+    const auto serial = runQxy(masked);
+    PARALLEL_SET_NUM_THREADS(maxThreads);
+    const auto parallel = runQxy(masked);
+
+    TS_ASSERT_EQUALS(serial.size(), parallel.size())
+    for (size_t i = 0; i < serial.size(); ++i) {
+      TS_ASSERT_EQUALS(serial[i]->getNumberHistograms(),
+                       parallel[i]->getNumberHistograms())
+      for (size_t j = 0; j < serial[i]->getNumberHistograms(); ++j) {
+        assertSameValues(serial[i]->y(j).rawData(),
+                         parallel[i]->y(j).rawData());
+        assertSameValues(serial[i]->e(j).rawData(),
+                         parallel[i]->e(j).rawData());
+      }
+    }
+  }
+
+  void test_a_NaN_count_is_reset_by_the_next_count_in_its_bin() {
+    // inputWS was set up by testNoGravity
+    const auto &input =
+        AnalysisDataService::Instance().retrieveWS<MatrixWorkspace>(m_inputWS);
+    // The first spectrum has the given counts and the others have 1 - counts
+    auto withCounts = [&input](const double first) {
+      MatrixWorkspace_sptr ws(input->clone());
+      for (size_t i = 0; i < ws->getNumberHistograms(); ++i) {
+        ws->mutableY(i) = i == 0 ? first : 1. - first;
+        ws->mutableE(i) = 0.;
+      }
+      return ws;
+    };
+    const auto firstOnly = runQxy(withCounts(1.))[1];
+    const auto othersOnly = runQxy(withCounts(0.))[1];
+    auto firstNaN = withCounts(0.);
+    firstNaN->mutableY(0) = std::nan("");
+
+    const int maxThreads = PARALLEL_GET_MAX_THREADS;
+    PARALLEL_SET_NUM_THREADS(1);
+    const auto serial = runQxy(firstNaN)[1];
+    PARALLEL_SET_NUM_THREADS(maxThreads);
+    const auto parallel = runQxy(firstNaN)[1];
+
+    // The first spectrum is summed first, so the counts of the other spectra
+    // replace its NaN in the bins they share
+    size_t shared = 0;
+    for (size_t i = 0; i < serial->getNumberHistograms(); ++i) {
+      assertSameValues(serial->y(i).rawData(), parallel->y(i).rawData());
+      for (size_t j = 0; j < serial->blocksize(); ++j) {
+        if (firstOnly->y(i)[j] > 0. && othersOnly->y(i)[j] > 0.) {
+          ++shared;
+          TS_ASSERT_EQUALS(serial->y(i)[j], othersOnly->y(i)[j])
+        }
+      }
+    }
+    TS_ASSERT_LESS_THAN(0, shared)
+  }
+
   void testGravity() {
     Mantid::Algorithms::Qxy qxy;
     qxy.initialize();
@@ -184,4 +184,34 @@ private:
   Mantid::Algorithms::Scale scale;
 };
 
+/// Measures the fixed cost of running Scale on a tiny workspace many times
+class ScaleTestPerformance : public CxxTest::TestSuite {
+public:
+  static ScaleTestPerformance *createSuite() {
+    return new ScaleTestPerformance();
+  }
+  static void destroySuite(ScaleTestPerformance *suite) { delete suite; }
+
+  ScaleTestPerformance()
+      : m_input(WorkspaceCreationHelper::create2DWorkspace(1, 1)) {}
+
+  void test_many_child_executions() {
+    Mantid::API::MatrixWorkspace_sptr ws = m_input;
+    for (int i = 0; i < NUMBER_OF_CALLS; ++i) {
+      Mantid::Algorithms::Scale alg;
+      alg.setChild(true);
+      alg.initialize();
+      alg.setProperty("InputWorkspace", ws);
+      alg.setPropertyValue("OutputWorkspace", "dummy");
+      alg.setProperty("Factor", 1.0001);
+      alg.execute();
+      ws = alg.getProperty("OutputWorkspace");
+    }
+  }
+
+private:
+  static constexpr int NUMBER_OF_CALLS = 10000;
+  Mantid::API::MatrixWorkspace_sptr m_input;
+};
+
 #endif /*SCALETEST_H_*/
@@ -13,6 +13,11 @@
 #include "MantidCurveFitting/GSLVector.h"
 #include "MantidKernel/System.h"
 
+#include <atomic>
+#include <future>
+#include <memory>
+#include <random>
+
 namespace Mantid {
 namespace CurveFitting {
 namespace CostFunctions {
@@ -34,6 +39,8 @@ class DLLExport FABADAMinimizer : public API::IFuncMinimizer {
 public:
   /// Constructor
   FABADAMinimizer();
+  /// Destructor
+  ~FABADAMinimizer() override;
   /// Name of the minimizer.
   std::string name() const override { return "FABADA"; }
   /// Initialize minimizer, i.e. pass a function to minimize.
@@ -54,6 +61,8 @@ public:
                         double &step);
 
 private:
+  /// Do one iteration of this chain
+  bool iterateChain();
   /// Returns the step from a Gaussian given sigma = Jump
   double gaussianStep(const double &jump);
   /// Applied to the other parameters first and sequentially, finally to the
@@ -99,7 +108,8 @@ private:
   /// Output parameter table
   void outputParameterTable(const std::vector<double> &bestParameters,
                             const std::vector<double> &errorsLeft,
-                            const std::vector<double> &errorsRight);
+                            const std::vector<double> &errorsRight,
+                            const std::vector<double> &gelmanRubin);
   /// Calculated converged chain and parameters
   void calculateConvChainAndBestParameters(
       size_t convLength, int nSteps,
@@ -110,6 +120,18 @@ private:
   void initChainsAndParameters();
   /// Initialize member variables related to simulated annealing
   void initSimulatedAnnealing();
+  /// Create and start the independent auxiliary chains
+  void initAuxiliaryChains(size_t nChains);
+  /// Run this chain until it stops iterating
+  void runChain(const std::atomic<bool> &stop);
+  /// Wait for the auxiliary chains and discard the ones that failed
+  void collectAuxiliaryChains();
+  /// The converged part of the chain taking one value each nSteps
+  std::vector<std::vector<double>> thinnedConvergedChain(size_t convLength,
+                                                         int nSteps) const;
+  /// Gelman-Rubin potential scale reduction factor for each parameter
+  std::vector<double> gelmanRubinStatistics(size_t convLength,
+                                            int nSteps) const;
 
   // Variables declarations
   /// Pointer to the cost function. Must be the least squares.
@@ -163,6 +185,14 @@ private:
   std::vector<size_t> m_numInactiveRegenerations;
   /// To track convergence through immobility
   std::vector<int> m_changesOld;
+  /// Random number generator used for the steps of this chain
+  std::mt19937 m_randomGenerator;
+  /// Independent chains run concurrently with this one
+  std::vector<std::unique_ptr<FABADAMinimizer>> m_auxiliaryChains;
+  /// Pending runs of the auxiliary chains (one per chain)
+  std::vector<std::future<void>> m_auxiliaryRuns;
+  /// Set to make the auxiliary chains stop early
+  std::atomic<bool> m_stopAuxiliaryChains;
 };
 
 /// Used to access the setDirty() protected member
@@ -12,7 +12,10 @@
 //----------------------------------------------------------------------
 #include "MantidAPI/CompositeFunction.h"
 #include <boost/shared_array.hpp>
+#include <boost/shared_ptr.hpp>
 #include <cmath>
+#include <map>
+#include <string>
 #include <vector>
 
 namespace Mantid {
@@ -134,10 +137,32 @@ protected:
   void init() override;
 
 private:
+  class FFTWorkspace;
+  /// What a cached resolution was calculated for: the evaluation mode, the
+  /// x values and the parameters of the resolution, and its attribute values
+  struct ResolutionKey {
+    std::vector<double> values;
+    std::string attributes;
+    bool operator==(const ResolutionKey &other) const {
+      return values == other.values && attributes == other.attributes;
+    }
+  };
+  /// Get the fft workspace and wavetables for a data size
+  FFTWorkspace &getFFTWorkspace(size_t nData) const;
+  /// Make the key identifying the cached resolution
+  ResolutionKey resolutionKey(const double *xValues, size_t nData,
+                              bool fftMode) const;
+  /// Check if the cached resolution can be reused, clear it if not
+  bool isResolutionCached(const ResolutionKey &key) const;
+
   /// Keep the Fourier transform of the resolution function (divided by the
   /// step in xValues) when in FFT mode, and the inverted resolution if in
   /// Direct mode
   mutable std::vector<double> m_resolution;
+  /// What m_resolution was calculated for
+  mutable ResolutionKey m_resolutionKey;
+  /// GSL fft workspaces and wavetables for each data size
+  mutable std::map<size_t, boost::shared_ptr<FFTWorkspace>> m_fftWorkspaces;
 };
 
 } // namespace Functions
@@ -7,6 +7,7 @@
 #include "MantidAPI/AlgorithmManager.h"
 #include "MantidAPI/AnalysisDataService.h"
 #include "MantidAPI/CostFunctionFactory.h"
+#include "MantidAPI/FunctionValues.h"
 #include "MantidAPI/FuncMinimizerFactory.h"
 #include "MantidAPI/IFunction.h"
 #include "MantidAPI/ITableWorkspace.h"
@@ -32,6 +33,9 @@
 #include <cstdio>
 #include <cstdlib>
 #include <ctime>
+#include <functional>
+#include <limits>
+#include <numeric>
 #include <random>
 
 namespace Mantid {
@@ -51,8 +55,50 @@ const size_t LOWER_CONVERGENCE_LIMIT = 350;
 const size_t JUMP_CHECKING_RATE = 200;
 // low jump limit
 const double LOW_JUMP_LIMIT = 1e-25;
-// random number generator
-std::mt19937 rng;
+// potential scale reduction factor above which chains are not considered
+// to sample the same distribution
+const double GELMAN_RUBIN_LIMIT = 1.1;
+
+/** Gelman-Rubin potential scale reduction factor of a parameter sampled by
+ * several chains of equal length.
+ *
+ * @param chains :: the samples of each chain
+ * @return :: sqrt of the ratio of the pooled to the within-chain variance
+ */
+double gelmanRubin(std::vector<std::vector<double>> const &chains) {
+  if (chains.size() < 2 || chains.front().size() < 2)
+    return std::numeric_limits<double>::quiet_NaN();
+  auto const nChains = static_cast<double>(chains.size());
+  auto const length = static_cast<double>(chains.front().size());
+
+  std::vector<double> means;
+  means.reserve(chains.size());
+  double withinVariance = 0.0;
+  for (auto const &chain : chains) {
+    double const mean =
+        std::accumulate(chain.begin(), chain.end(), 0.0) / length;
+    double variance = 0.0;
+    for (auto const value : chain)
+      variance += (value - mean) * (value - mean);
+    withinVariance += variance / (length - 1.0);
+    means.emplace_back(mean);
+  }
+  withinVariance /= nChains;
+
+  double const grandMean =
+      std::accumulate(means.begin(), means.end(), 0.0) / nChains;
+  double betweenVariance = 0.0;
+  for (auto const mean : means)
+    betweenVariance += (mean - grandMean) * (mean - grandMean);
+  betweenVariance *= length / (nChains - 1.0);
+
+  if (withinVariance == 0.0)
+    return betweenVariance == 0.0 ? 1.0
+                                  : std::numeric_limits<double>::infinity();
+  double const pooledVariance =
+      (length - 1.0) / length * withinVariance + betweenVariance / length;
+  return std::sqrt(pooledVariance / withinVariance);
+}
 
 API::MatrixWorkspace_sptr
 createWorkspace(std::vector<double> const &xValues,
@@ -85,7 +131,9 @@ FABADAMinimizer::FABADAMinimizer()
       m_parConverged(), m_criteria(), m_maxIter(0), m_parChanged(),
       m_temperature(0.), m_counterGlobal(0), m_simAnnealingItStep(0),
       m_leftRefrPoints(0), m_tempStep(0.), m_overexploration(false),
-      m_nParams(0), m_numInactiveRegenerations(), m_changesOld() {
+      m_nParams(0), m_numInactiveRegenerations(), m_changesOld(),
+      m_randomGenerator(), m_auxiliaryChains(), m_auxiliaryRuns(),
+      m_stopAuxiliaryChains(false) {
   declareProperty("ChainLength", static_cast<size_t>(10000),
                   "Length of the converged chain.");
   declareProperty("StepsBetweenValues", 10,
@@ -99,6 +147,14 @@ FABADAMinimizer::FABADAMinimizer()
                   " a certain parameter to be converged");
   declareProperty("JumpAcceptanceRate", 0.6666666,
                   "Desired jumping acceptance rate");
+  declareProperty("NumberOfChains", 1,
+                  "Number of independent Markov chains. Chains after the"
+                  " first start from perturbed parameter values and run"
+                  " concurrently; all of them are merged into the outputs.");
+  declareProperty("Seed", 0,
+                  "Seed of the random number generator. With 0 (default) a"
+                  " different seed is used for every fit; any other value"
+                  " makes the chains reproducible.");
   // Simulated Annealing properties
   declareProperty("SimAnnealingApplied", false,
                   "If minimization should be run with Simulated"
@@ -121,7 +177,7 @@ FABADAMinimizer::FABADAMinimizer()
   declareProperty(std::make_unique<API::WorkspaceProperty<>>(
                       "Chains", "", Kernel::Direction::Output),
                   "The name to give the output workspace for the"
-                  " complete chains.");
+                  " complete chains (concatenated if there are several).");
   declareProperty(std::make_unique<API::WorkspaceProperty<>>(
                       "ConvergedChain", "", Kernel::Direction::Output,
                       API::PropertyMode::Optional),
@@ -144,6 +200,15 @@ FABADAMinimizer::FABADAMinimizer()
       " landscape");*/
 }
 
+/// Destructor. Stops the auxiliary chains still running and waits for them.
+FABADAMinimizer::~FABADAMinimizer() {
+  m_stopAuxiliaryChains = true;
+  for (auto &run : m_auxiliaryRuns) {
+    if (run.valid())
+      run.wait();
+  }
+}
+
 /** Initialize minimizer. Set initial values for all private members
  *
  * @param function :: the fit function
@@ -166,6 +231,11 @@ void FABADAMinimizer::initialize(API::ICostFunction_sptr function,
   m_converged = false;
   m_maxIter = maxIterations;
 
+  int const seed = getProperty("Seed");
+  m_randomGenerator.seed(seed != 0
+                             ? static_cast<std::mt19937::result_type>(seed)
+                             : std::random_device()());
+
   // Initialize member variables related to fitting parameters, such as
   // m_chains, m_jump, etc
   initChainsAndParameters();
@@ -189,6 +259,10 @@ void FABADAMinimizer::initialize(API::ICostFunction_sptr function,
         " 350 iterations for the burn-in period. Increase"
         " MaxIterations property");
   }
+
+  int const nChains = getProperty("NumberOfChains");
+  if (nChains > 1)
+    initAuxiliaryChains(static_cast<size_t>(nChains));
 }
 
 /** Do one iteration.
@@ -196,6 +270,20 @@ void FABADAMinimizer::initialize(API::ICostFunction_sptr function,
  * @return :: true if iterations must be continued, false otherwise
  */
 bool FABADAMinimizer::iterate(size_t /*iteration*/) {
+  try {
+    return iterateChain();
+  } catch (...) {
+    // The fit is abandoned: the auxiliary chains need not run to the end
+    m_stopAuxiliaryChains = true;
+    throw;
+  }
+}
+
+/** Do one iteration of this chain.
+ *
+ * @return :: true if iterations must be continued, false otherwise
+ */
+bool FABADAMinimizer::iterateChain() {
 
   if (!m_leastSquares) {
     throw std::runtime_error("Cost function isn't set up.");
@@ -327,6 +415,8 @@ void FABADAMinimizer::finalize() {
   }
   auto convLength = size_t(double(chainLength) / double(nSteps));
 
+  collectAuxiliaryChains();
+
   // Reduced chain
   std::vector<std::vector<double>> reducedConvergedChain;
   // Declaring vectors for best values
@@ -336,9 +426,17 @@ void FABADAMinimizer::finalize() {
 
   calculateConvChainAndBestParameters(convLength, nSteps, reducedConvergedChain,
                                       bestParameters, errorLeft, errorRight);
+  // Length of the reduced chain merged over all the chains
+  size_t const mergedLength =
+      reducedConvergedChain.empty() ? 0 : reducedConvergedChain.front().size();
+
+  std::vector<double> gelmanRubinValues;
+  if (!m_auxiliaryChains.empty() && convLength > 0)
+    gelmanRubinValues = gelmanRubinStatistics(convLength, nSteps);
 
   if (!getPropertyValue("Parameters").empty()) {
-    outputParameterTable(bestParameters, errorLeft, errorRight);
+    outputParameterTable(bestParameters, errorLeft, errorRight,
+                         gelmanRubinValues);
   }
 
   // Set the best parameter values
@@ -361,14 +459,14 @@ void FABADAMinimizer::finalize() {
     outputChains();
   }
 
-  double mostPchi2 = outputPDF(convLength, reducedConvergedChain);
+  double mostPchi2 = outputPDF(mergedLength, reducedConvergedChain);
 
   if (!getPropertyValue("ConvergedChain").empty()) {
     outputConvergedChains(convLength, nSteps);
   }
 
   if (!getPropertyValue("CostFunctionTable").empty()) {
-    outputCostFunctionTable(convLength, mostPchi2);
+    outputCostFunctionTable(mergedLength, mostPchi2);
   }
 
   // Set the best parameter values
@@ -385,7 +483,8 @@ void FABADAMinimizer::finalize() {
  * @return :: the step
  */
 double FABADAMinimizer::gaussianStep(const double &jump) {
-  return Kernel::normal_distribution<double>(0.0, std::abs(jump))(rng);
+  return Kernel::normal_distribution<double>(0.0, std::abs(jump))(
+      m_randomGenerator);
 }
 
 /** If the new point is out of its bounds, it is changed to fit in the bound
@@ -507,7 +606,8 @@ void FABADAMinimizer::algorithmDisplacement(const size_t &parameterIndex,
     double prob = exp((m_chi2 - chi2New) / (2.0 * m_temperature));
 
     // Decide if changing or not
-    double p = std::uniform_real_distribution<double>(0.0, 1.0)(rng);
+    double p =
+        std::uniform_real_distribution<double>(0.0, 1.0)(m_randomGenerator);
     if (p <= prob) {
       for (size_t j = 0; j < m_nParams; j++) {
         m_chain[j].push_back(newParameters.get(j));
@@ -709,12 +809,15 @@ bool FABADAMinimizer::iterationContinuation() {
 }
 
 /** Create the workspace for the complete parameters chain (the last histogram
- *is for the Chi square).
+ *is for the Chi square). The auxiliary chains, if any, are appended one after
+ *the other.
  *
  */
 void FABADAMinimizer::outputChains() {
 
   size_t chainLength = m_chain[0].size();
+  for (auto const &chain : m_auxiliaryChains)
+    chainLength += chain->m_chain[0].size();
   API::MatrixWorkspace_sptr wsC = API::WorkspaceFactory::Instance().create(
       "Workspace2D", m_nParams + 1, chainLength, chainLength);
 
@@ -722,10 +825,11 @@ void FABADAMinimizer::outputChains() {
   for (size_t j = 0; j < m_nParams + 1; ++j) {
     auto &X = wsC->mutableX(j);
     auto &Y = wsC->mutableY(j);
-    for (size_t k = 0; k < chainLength; ++k) {
-      X[k] = double(k);
-      Y[k] = m_chain[j][k];
-    }
+    std::iota(X.begin(), X.end(), 0.0);
+    auto yEnd = std::copy(m_chain[j].begin(), m_chain[j].end(), Y.begin());
+    for (auto const &chain : m_auxiliaryChains)
+      yEnd = std::copy(chain->m_chain[j].begin(), chain->m_chain[j].end(),
+                       yEnd);
   }
 
   // Set and name the workspace for the complete chain
@@ -943,11 +1047,13 @@ void FABADAMinimizer::setParameterXAndYValuesForPDF(
  *left deviation
  * @param errorRight :: [output] vector containing the sqrt of the mean square
  *right deviation
+ * @param gelmanRubin :: Gelman-Rubin statistic of each parameter (empty if
+ *there is a single chain)
  */
 void FABADAMinimizer::outputParameterTable(
     const std::vector<double> &bestParameters,
-    const std::vector<double> &errorLeft,
-    const std::vector<double> &errorRight) {
+    const std::vector<double> &errorLeft, const std::vector<double> &errorRight,
+    const std::vector<double> &gelmanRubin) {
 
   // Create the workspace for the parameters' value and errors.
   API::ITableWorkspace_sptr wsPdfE =
@@ -956,11 +1062,15 @@ void FABADAMinimizer::outputParameterTable(
   wsPdfE->addColumn("double", "Value");
   wsPdfE->addColumn("double", "Left's error");
   wsPdfE->addColumn("double", "Right's error");
+  if (!gelmanRubin.empty())
+    wsPdfE->addColumn("double", "Gelman-Rubin");
 
   for (size_t j = 0; j < m_nParams; ++j) {
     API::TableRow row = wsPdfE->appendRow();
     row << m_fitFunction->parameterName(j) << bestParameters[j] << errorLeft[j]
         << errorRight[j];
+    if (!gelmanRubin.empty())
+      row << gelmanRubin[j];
   }
   // Set and name the Parameter Errors workspace.
   setProperty("Parameters", wsPdfE);
@@ -987,17 +1097,13 @@ void FABADAMinimizer::calculateConvChainAndBestParameters(
 
   // In case of reduced chain
   if (convLength > 0) {
-    // Write first element of the reduced chain
-    for (size_t e = 0; e <= m_nParams; ++e) {
-      std::vector<double> v;
-      v.emplace_back(m_chain[e][m_convPoint]);
-      reducedChain.emplace_back(std::move(v));
-    }
-
-    // Calculate the reducedConvergedChain for the cost fuction.
-    for (size_t k = 1; k < convLength; ++k) {
-      reducedChain[m_nParams].emplace_back(
-          m_chain[m_nParams][nSteps * k + m_convPoint]);
+    reducedChain = thinnedConvergedChain(convLength, nSteps);
+    // Merge the auxiliary chains into the posterior
+    for (auto const &chain : m_auxiliaryChains) {
+      auto const auxiliary = chain->thinnedConvergedChain(convLength, nSteps);
+      for (size_t e = 0; e <= m_nParams; ++e)
+        reducedChain[e].insert(reducedChain[e].end(), auxiliary[e].begin(),
+                               auxiliary[e].end());
     }
 
     // Calculate the position of the minimum Chi square value
@@ -1007,10 +1113,6 @@ void FABADAMinimizer::calculateConvChainAndBestParameters(
 
     // Calculate the parameter value and the errors
     for (size_t j = 0; j < m_nParams; ++j) {
-      // Obs: Starts at 1 (0 already added)
-      for (size_t k = 1; k < convLength; ++k) {
-        reducedChain[j].push_back(m_chain[j][m_convPoint + nSteps * k]);
-      }
       // best fit parameters taken
       bestParameters[j] =
           reducedChain[j][positionMinChi2 - reducedChain[m_nParams].begin()];
@@ -1170,6 +1272,134 @@ void FABADAMinimizer::initSimulatedAnnealing() {
   }
 }
 
+/** Create the auxiliary chains. Each one gets its own copy of the fitting
+ * function and of the calculated values, so that they can be evaluated
+ * concurrently, starts from randomly displaced parameter values and uses its
+ * own random number sequence.
+ *
+ * @param nChains :: the total number of chains, including this one
+ */
+void FABADAMinimizer::initAuxiliaryChains(size_t nChains) {
+  auto const domain = m_leastSquares->getDomain();
+  auto const values = m_leastSquares->getValues();
+
+  for (size_t c = 1; c < nChains; ++c) {
+    auto chain = std::make_unique<FABADAMinimizer>();
+    for (auto const property : getProperties()) {
+      if (property->direction() == Kernel::Direction::Input)
+        chain->setPropertyValue(property->name(), property->value());
+    }
+    chain->setProperty("NumberOfChains", 1);
+    // The seeds of the auxiliary chains are drawn from the sequence of this
+    // one, so that a fixed Seed reproduces all of them
+    chain->setProperty("Seed", std::uniform_int_distribution<int>(
+                                   1, std::numeric_limits<int>::max())(
+                                   m_randomGenerator));
+
+    // Multi-start: displace the free parameters by the initial jump
+    auto function = m_fitFunction->clone();
+    for (size_t i = 0; i < m_nParams; ++i) {
+      if (function->isFixed(i) || function->getTie(i))
+        continue;
+      double const param = function->getParameter(i);
+      double const jump = param != 0.0 ? std::abs(param / 10) : 0.01;
+      function->setParameter(i, param + gaussianStep(jump));
+    }
+    function->applyTies();
+
+    auto costFunction =
+        boost::make_shared<CostFunctions::CostFuncLeastSquares>();
+    costFunction->setFittingFunction(
+        function, domain, boost::make_shared<API::FunctionValues>(*values));
+    chain->initialize(costFunction, m_maxIter);
+    m_auxiliaryChains.emplace_back(std::move(chain));
+  }
+
+  for (auto &chain : m_auxiliaryChains) {
+    m_auxiliaryRuns.emplace_back(std::async(
+        std::launch::async, &FABADAMinimizer::runChain, chain.get(),
+        std::cref(m_stopAuxiliaryChains)));
+  }
+}
+
+/** Iterate until the chain has the required length. Used to run the
+ * auxiliary chains.
+ *
+ * @param stop :: set by the main chain when the fit is abandoned
+ */
+void FABADAMinimizer::runChain(const std::atomic<bool> &stop) {
+  while (!stop && iterateChain()) {
+  }
+  if (stop)
+    throw std::runtime_error("The fit was stopped.");
+}
+
+/** Wait for the auxiliary chains to finish. A chain which did not converge is
+ * reported and left out of the outputs.
+ */
+void FABADAMinimizer::collectAuxiliaryChains() {
+  std::vector<std::unique_ptr<FABADAMinimizer>> converged;
+  for (size_t c = 0; c < m_auxiliaryRuns.size(); ++c) {
+    try {
+      m_auxiliaryRuns[c].get();
+      converged.emplace_back(std::move(m_auxiliaryChains[c]));
+    } catch (std::exception &ex) {
+      g_log.warning() << "Chain " << c + 1
+                      << " is not used in the outputs: " << ex.what() << '\n';
+    }
+  }
+  m_auxiliaryRuns.clear();
+  m_auxiliaryChains = std::move(converged);
+}
+
+/** Take the converged part of the chain keeping one value each nSteps.
+ *
+ * @param convLength :: length of the reduced chain
+ * @param nSteps :: number of steps done between chain points
+ * @return :: the reduced chain for each parameter plus the cost function
+ */
+std::vector<std::vector<double>>
+FABADAMinimizer::thinnedConvergedChain(size_t convLength, int nSteps) const {
+  std::vector<std::vector<double>> reducedChain(m_nParams + 1);
+  for (size_t e = 0; e <= m_nParams; ++e) {
+    reducedChain[e].reserve(convLength);
+    for (size_t k = 0; k < convLength; ++k)
+      reducedChain[e].emplace_back(m_chain[e][m_convPoint + nSteps * k]);
+  }
+  return reducedChain;
+}
+
+/** Calculate the Gelman-Rubin potential scale reduction factor of each
+ * parameter over this chain and the auxiliary ones. Values close to 1 mean the
+ * chains sample the same distribution.
+ *
+ * @param convLength :: length of the reduced chains
+ * @param nSteps :: number of steps done between chain points
+ * @return :: the statistic for each parameter
+ */
+std::vector<double>
+FABADAMinimizer::gelmanRubinStatistics(size_t convLength, int nSteps) const {
+  std::vector<std::vector<std::vector<double>>> chains;
+  chains.emplace_back(thinnedConvergedChain(convLength, nSteps));
+  for (auto const &chain : m_auxiliaryChains)
+    chains.emplace_back(chain->thinnedConvergedChain(convLength, nSteps));
+
+  std::vector<double> statistics(m_nParams);
+  for (size_t j = 0; j < m_nParams; ++j) {
+    std::vector<std::vector<double>> parameterChains;
+    parameterChains.reserve(chains.size());
+    for (auto const &chain : chains)
+      parameterChains.emplace_back(chain[j]);
+    statistics[j] = gelmanRubin(parameterChains);
+    if (statistics[j] > GELMAN_RUBIN_LIMIT)
+      g_log.warning() << "The chains have not mixed for parameter "
+                      << m_fitFunction->parameterName(j)
+                      << " (Gelman-Rubin = " << statistics[j]
+                      << "). Try increasing ChainLength.\n";
+  }
+  return statistics;
+}
+
 } // namespace FuncMinimisers
 } // namespace CurveFitting
 } // namespace Mantid
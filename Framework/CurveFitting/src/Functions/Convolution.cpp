@@ -15,6 +15,7 @@
 #include "MantidCurveFitting/Functions/DeltaFunction.h"
 
 #include <algorithm>
+#include <boost/make_shared.hpp>
 #include <cmath>
 #include <functional>
 
@@ -40,6 +41,24 @@ using std::placeholders::_1;
 
 DECLARE_FUNCTION(Convolution)
 
+namespace {
+/// Append the values of the attributes of a function, and of its members if
+/// it is composite, to a string
+void appendAttributeValues(const IFunction &function, std::string &values) {
+  for (const auto &name : function.getAttributeNames()) {
+    values += name + '=' + function.getAttribute(name).value() + ';';
+  }
+  const auto *composite = dynamic_cast<const CompositeFunction *>(&function);
+  if (composite) {
+    for (size_t i = 0; i < composite->nFunctions(); ++i) {
+      values += '(';
+      appendAttributeValues(*composite->getFunction(i), values);
+      values += ')';
+    }
+  }
+}
+} // namespace
+
 /// Constructor
 Convolution::Convolution() {
   declareAttribute("FixResolution", Attribute(true));
@@ -69,24 +88,80 @@ void Convolution::setAttribute(const std::string &attName,
     }
   }
   CompositeFunction::setAttribute(attName, att);
+  refreshResolution();
 }
 
-namespace {
-// anonymous namespace for local definitions
-
-// A struct incapsulating workspaces for real fft
-struct RealFFTWorkspace {
-  explicit RealFFTWorkspace(size_t nData)
+/// A class incapsulating workspaces and wavetables for real fft of a given
+/// size. They are kept between calls to avoid recomputing the trigonometric
+/// tables at each evaluation.
+class Convolution::FFTWorkspace {
+public:
+  explicit FFTWorkspace(size_t nData)
       : workspace(gsl_fft_real_workspace_alloc(nData)),
-        wavetable(gsl_fft_real_wavetable_alloc(nData)) {}
-  ~RealFFTWorkspace() {
+        wavetable(gsl_fft_real_wavetable_alloc(nData)),
+        inverseWavetable(gsl_fft_halfcomplex_wavetable_alloc(nData)) {}
+  ~FFTWorkspace() {
+    gsl_fft_halfcomplex_wavetable_free(inverseWavetable);
     gsl_fft_real_wavetable_free(wavetable);
     gsl_fft_real_workspace_free(workspace);
   }
+  FFTWorkspace(const FFTWorkspace &) = delete;
+  FFTWorkspace &operator=(const FFTWorkspace &) = delete;
   gsl_fft_real_workspace *workspace;
   gsl_fft_real_wavetable *wavetable;
+  gsl_fft_halfcomplex_wavetable *inverseWavetable;
 };
-} // namespace
+
+/**
+ * Get the fft workspace and wavetables for a data size, creating them on the
+ * first request.
+ * @param nData :: The size of the data to transform
+ */
+Convolution::FFTWorkspace &Convolution::getFFTWorkspace(size_t nData) const {
+  auto &workspace = m_fftWorkspaces[nData];
+  if (!workspace) {
+    workspace = boost::make_shared<FFTWorkspace>(nData);
+  }
+  return *workspace;
+}
+
+/**
+ * Make the key identifying a cached resolution: the evaluation mode, the
+ * x values of the domain, and the parameters and attribute values of the
+ * resolution.
+ * @param xValues :: The x-values of the domain
+ * @param nData :: The size of the domain
+ * @param fftMode :: True for the FFT mode, false for the direct mode
+ */
+Convolution::ResolutionKey Convolution::resolutionKey(const double *xValues,
+                                                      size_t nData,
+                                                      bool fftMode) const {
+  const auto &res = *getFunction(0);
+  ResolutionKey key;
+  key.values.reserve(res.nParams() + nData + 1);
+  key.values.emplace_back(fftMode ? 1.0 : 0.0);
+  key.values.insert(key.values.end(), xValues, xValues + nData);
+  for (size_t i = 0; i < res.nParams(); ++i) {
+    key.values.emplace_back(res.getParameter(i));
+  }
+  appendAttributeValues(res, key.attributes);
+  return key;
+}
+
+/**
+ * Check if the resolution cached in m_resolution was calculated for the same
+ * key. If it wasn't the cache is cleared and the new key is stored.
+ * @param key :: The key made by resolutionKey()
+ * @return :: True if m_resolution can be reused
+ */
+bool Convolution::isResolutionCached(const ResolutionKey &key) const {
+  if (!m_resolution.empty() && key == m_resolutionKey) {
+    return true;
+  }
+  m_resolution.clear();
+  m_resolutionKey = key;
+  return false;
+}
 
 /**
  * Calculates convolution of the two member functions. Switches from FFT mode
@@ -133,11 +208,12 @@ void Convolution::functionFFTMode(const FunctionDomain &domain,
   const auto &d1d = dynamic_cast<const FunctionDomain1D &>(domain);
   size_t nData = domain.size();
   const double *xValues = d1d.getPointerAt(0);
-  refreshResolution();
-  RealFFTWorkspace workspace(nData);
+  auto &workspace = getFFTWorkspace(nData);
   int n2 = static_cast<int>(nData) / 2;
   bool odd = n2 * 2 != static_cast<int>(nData);
-  if (m_resolution.empty()) {
+  // The transform of the resolution is recalculated only if the domain or
+  // the resolution parameters have changed
+  if (!isResolutionCached(resolutionKey(xValues, nData, true))) {
     m_resolution.resize(nData);
     // the resolution must be defined on interval -L < xr < L, L ==
     // (xValues[nData-1] - xValues[0]) / 2
@@ -265,11 +341,8 @@ void Convolution::functionFFTMode(const FunctionDomain &domain,
     }
 
     // Inverse fourier transform of fun
-    gsl_fft_halfcomplex_wavetable *wavetable_r =
-        gsl_fft_halfcomplex_wavetable_alloc(nData);
-    gsl_fft_halfcomplex_inverse(out, 1, nData, wavetable_r,
+    gsl_fft_halfcomplex_inverse(out, 1, nData, workspace.inverseWavetable,
                                 workspace.workspace);
-    gsl_fft_halfcomplex_wavetable_free(wavetable_r);
 
     // Inverse fourier transform is integration - multiply by the step in the
     // integration variable
@@ -325,8 +398,6 @@ void Convolution::functionDirectMode(const FunctionDomain &domain,
                                                            // x-values
   auto ixN = nData - ixP - 1; // negative x-values (ixP+ixN=nData-1)
 
-  refreshResolution();
-
   // double the domain where to evaluate the convolution. Guarantees complete
   // overlap betwen convolution and signal in the original range.
   const size_t mData = nData + ixN + ixP; // equal to 2*nData-1
@@ -346,13 +417,12 @@ void Convolution::functionDirectMode(const FunctionDomain &domain,
   if (!resolution) {
     throw std::runtime_error("Convolution can work only with 1D functions");
   }
-  if (m_resolution.empty()) {
+  if (!isResolutionCached(resolutionKey(xValues, nData, false))) {
     m_resolution.resize(nData);
+    resolution->function1D(m_resolution.data(), xValues, nData);
+    // Reverse the axis of the resolution data
+    std::reverse(m_resolution.begin(), m_resolution.end());
   }
-  resolution->function1D(m_resolution.data(), xValues, nData);
-
-  // Reverse the axis of the resolution data
-  std::reverse(m_resolution.begin(), m_resolution.end());
 
   // check for delta functions
   std::vector<boost::shared_ptr<DeltaFunction>> dltFuns;
@@ -482,27 +552,14 @@ size_t Convolution::addFunction(IFunction_sptr f) {
  * Make sure that the resolution is updated if this function is reused in
  * several Fits.
  */
-void Convolution::setUpForFit() { m_resolution.clear(); }
+void Convolution::setUpForFit() { refreshResolution(); }
 
 /// Deletes and zeroes pointer m_resolution forsing function(...) to recalculate
 /// the resolution function
 void Convolution::refreshResolution() const {
-  // refresh when calculation for the first time
-  bool needRefreshing = m_resolution.empty();
-  if (!needRefreshing) {
-    // if resolution has active parameters always refresh
-    IFunction &res = *getFunction(0);
-    for (size_t i = 0; i < res.nParams(); ++i) {
-      if (res.isActive(i)) {
-        needRefreshing = true;
-        break;
-      }
-    }
-  }
-  if (!needRefreshing)
-    return;
   // delete fourier transform of the resolution to force its recalculation
   m_resolution.clear();
+  m_resolutionKey = ResolutionKey();
 }
 
 } // namespace Functions
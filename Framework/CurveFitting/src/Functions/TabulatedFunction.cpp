@@ -61,15 +61,15 @@ void TabulatedFunction::eval(double scaling, double xshift, double xscale,
   if (size() == 0)
     return;
 
-  // shift and scale the domain over which the function is defined
-  std::vector<double> xData(m_xData);
-  for (double &value : xData) {
-    value *= xscale;
-    value += xshift;
-  }
+  // shift and scale the domain over which the function is defined. The
+  // tabulated x values are transformed on the fly to avoid copying them at
+  // each call.
+  auto xData = [this, xscale, xshift](size_t k) {
+    return m_xData[k] * xscale + xshift;
+  };
 
-  const double xStart = xData.front();
-  const double xEnd = xData.back();
+  const double xStart = xData(0);
+  const double xEnd = xData(size() - 1);
 
   if (xStart >= xValues[nData - 1] || xEnd <= xValues[0])
     return;
@@ -79,21 +79,34 @@ void TabulatedFunction::eval(double scaling, double xshift, double xscale,
     out[i] = 0;
     i++;
   }
+  // Find the first tabulated point at or after xValues[i] by bisection; the
+  // following points are found by stepping forward as xValues are sorted
   size_t j = 0;
+  if (xscale > 0.0) {
+    const double x0 = (xValues[i] - xshift) / xscale;
+    j = static_cast<size_t>(
+        std::lower_bound(m_xData.begin(), m_xData.end(), x0) - m_xData.begin());
+    // step back in case of rounding in the inverse transformation
+    while (j > 0 && xData(j - 1) >= xValues[i])
+      --j;
+    if (j > size() - 1)
+      j = size() - 1;
+  }
   for (; i < nData; i++) {
     double xi = xValues[i];
-    while (j < size() - 1 && xi > xData[j])
+    while (j < size() - 1 && xi > xData(j))
       j++;
     if (j > size() - 1) {
       out[i] = 0;
     } else {
-      if (xi == xData[j]) {
+      const double xj = xData(j);
+      if (xi == xj) {
         out[i] = m_yData[j] * scaling;
-      } else if (xi > xData[j]) {
+      } else if (xi > xj) {
         out[i] = 0;
       } else if (j > 0) {
-        double x0 = xData[j - 1];
-        double x1 = xData[j];
+        double x0 = xData(j - 1);
+        double x1 = xj;
         double y0 = m_yData[j - 1];
         double y1 = m_yData[j];
         out[i] = y0 + (y1 - y0) * (xi - x0) / (x1 - x0);
@@ -63,9 +63,10 @@ void doTestExpDecay(MatrixWorkspace_sptr ws2) {
   fit.setProperty("CreateOutput", true);
   fit.setProperty("MaxIterations", 100000);
   fit.setProperty("Minimizer", "FABADA,ChainLength=5000,StepsBetweenValues="
-                               "10,ConvergenceCriteria=0.1,CostFunctionTable="
-                               "CostFunction,Chains=Chain,ConvergedChain"
-                               "=ConvergedChain,Parameters=Parameters");
+                               "10,ConvergenceCriteria=0.1,Seed=5489,"
+                               "CostFunctionTable=CostFunction,Chains=Chain,"
+                               "ConvergedChain=ConvergedChain,"
+                               "Parameters=Parameters");
 
   TS_ASSERT_THROWS_NOTHING(fit.execute());
 
@@ -184,9 +185,10 @@ public:
     fit.setProperty("CreateOutput", true);
     fit.setProperty("MaxIterations", 100000);
     fit.setProperty("Minimizer", "FABADA,ChainLength=10000,StepsBetweenValues="
-                                 "10,ConvergenceCriteria=0.1,CostFunctionTable="
-                                 "CostFunction,Chains=Chain,ConvergedChain"
-                                 "=ConvergedChain,Parameters=Parameters");
+                                 "10,ConvergenceCriteria=0.1,Seed=5489,"
+                                 "CostFunctionTable=CostFunction,Chains=Chain,"
+                                 "ConvergedChain=ConvergedChain,"
+                                 "Parameters=Parameters");
 
     TS_ASSERT_THROWS_NOTHING(fit.execute());
     TS_ASSERT(fit.isExecuted());
@@ -269,6 +271,97 @@ public:
     TS_ASSERT(param->Double(1, 1) == fun->getParameter("Lifetime"));
   }
 
+  void test_multiple_chains() {
+    auto ws2 = createExpDecayWorkspace();
+
+    Mantid::API::IFunction_sptr fun(new ExpDecay);
+    fun->setParameter("Height", 8.);
+    fun->setParameter("Lifetime", 1.0);
+
+    Fit fit;
+    fit.initialize();
+    fit.setChild(true);
+    fit.setProperty("Function", fun);
+    fit.setProperty("InputWorkspace", ws2);
+    fit.setProperty("WorkspaceIndex", 0);
+    fit.setProperty("CreateOutput", true);
+    fit.setProperty("MaxIterations", 100000);
+    fit.setProperty("Minimizer", "FABADA,ChainLength=10000,StepsBetweenValues="
+                                 "10,ConvergenceCriteria=0.1,NumberOfChains=3,"
+                                 "Seed=5489,"
+                                 "Chains=Chain,ConvergedChain=ConvergedChain,"
+                                 "Parameters=Parameters");
+
+    TS_ASSERT_THROWS_NOTHING(fit.execute());
+    TS_ASSERT(fit.isExecuted());
+
+    TS_ASSERT_DELTA(fun->getParameter("Height"), 10.0, 0.1);
+    TS_ASSERT_DELTA(fun->getParameter("Lifetime"), 0.5, 0.01);
+
+    size_t nParams = fun->nParams();
+
+    // The converged chain is the one of the first chain only
+    MatrixWorkspace_sptr convChain = fit.getProperty("ConvergedChain");
+    TS_ASSERT(convChain);
+    TS_ASSERT_EQUALS(convChain->x(0).size(), 1000);
+
+    // The complete chains are concatenated
+    MatrixWorkspace_sptr chain = fit.getProperty("Chains");
+    TS_ASSERT(chain);
+    TS_ASSERT_EQUALS(chain->getNumberHistograms(), nParams + 1);
+    TS_ASSERT_LESS_THAN(3 * 10000, chain->x(0).size());
+
+    // The PDF is built from the merged chains
+    auto const PDFGroup =
+        AnalysisDataService::Instance().retrieveWS<WorkspaceGroup>(
+            PDF_GROUP_NAME);
+    auto const PDF = boost::dynamic_pointer_cast<MatrixWorkspace>(
+        PDFGroup->getItem(PDFGroup->size() - 1));
+    TS_ASSERT_EQUALS(PDF->getNumberHistograms(), nParams + 1);
+    TS_ASSERT_EQUALS(PDF->y(0).size(), 20);
+
+    // Convergence diagnostics
+    ITableWorkspace_sptr param = fit.getProperty("Parameters");
+    TS_ASSERT(param);
+    TS_ASSERT_EQUALS(param->columnCount(), 5);
+    TS_ASSERT_EQUALS(param->rowCount(), nParams);
+    TS_ASSERT_EQUALS(param->getColumn(4)->type(), "double");
+    TS_ASSERT_EQUALS(param->getColumn(4)->name(), "Gelman-Rubin");
+    for (size_t i = 0; i < nParams; ++i) {
+      TS_ASSERT_DELTA(param->Double(i, 4), 1.0, 0.1);
+    }
+  }
+
+  void test_fixed_seed_is_reproducible() {
+    auto ws2 = createExpDecayWorkspace();
+    auto fitWithSeed = [&ws2](const std::string &seed) {
+      Mantid::API::IFunction_sptr fun(new ExpDecay);
+      fun->setParameter("Height", 8.);
+      fun->setParameter("Lifetime", 1.0);
+      Fit fit;
+      fit.initialize();
+      fit.setChild(true);
+      fit.setProperty("Function", fun);
+      fit.setProperty("InputWorkspace", ws2);
+      fit.setProperty("MaxIterations", 100000);
+      fit.setProperty("Minimizer", "FABADA,ChainLength=5000,"
+                                   "ConvergenceCriteria=0.1,NumberOfChains=2,"
+                                   "Seed=" +
+                                       seed);
+      fit.execute();
+      TS_ASSERT(fit.isExecuted());
+      return std::make_pair(fun->getParameter("Height"),
+                            fun->getParameter("Lifetime"));
+    };
+
+    auto const first = fitWithSeed("123");
+    auto const second = fitWithSeed("123");
+    TS_ASSERT_EQUALS(first.first, second.first);
+    TS_ASSERT_EQUALS(first.second, second.second);
+    auto const other = fitWithSeed("321");
+    TS_ASSERT_DIFFERS(first.first, other.first);
+  }
+
   void test_low_MaxIterations() {
     auto ws2 = createExpDecayWorkspace();
 
@@ -11,6 +11,7 @@
 
 #include "MantidCurveFitting/Functions/Convolution.h"
 #include "MantidCurveFitting/Functions/DeltaFunction.h"
+#include "MantidCurveFitting/Functions/TabulatedFunction.h"
 
 #include "MantidAPI/FunctionFactory.h"
 #include "MantidDataObjects/TableWorkspace.h"
@@ -402,6 +403,115 @@ public:
     }
   }
 
+  void testResolutionCacheIsRefreshed() {
+    auto makeConvolution = [](double resolutionWidth) {
+      auto conv = boost::make_shared<Convolution>();
+      auto res = boost::make_shared<ConvolutionTest_Gauss>();
+      res->setParameter("c", 0.0);
+      res->setParameter("h", 1.0);
+      res->setParameter("s", resolutionWidth);
+      conv->addFunction(res);
+      auto fun = boost::make_shared<ConvolutionTest_Gauss>();
+      fun->setParameter("c", 0.5);
+      fun->setParameter("h", 2.0);
+      fun->setParameter("s", 0.7);
+      conv->addFunction(fun);
+      return conv;
+    };
+    auto makeX = [](size_t n) {
+      std::vector<double> x(n);
+      const double dx = 10.0 / static_cast<double>(n - 1);
+      for (size_t i = 0; i < n; ++i) {
+        x[i] = -5.0 + dx * static_cast<double>(i);
+      }
+      return x;
+    };
+
+    auto conv = makeConvolution(1.0);
+    auto x1 = makeX(101);
+    auto x2 = makeX(64);
+    FunctionDomain1DView domain1(x1.data(), x1.size());
+    FunctionDomain1DView domain2(x2.data(), x2.size());
+    FunctionValues values1(domain1), values2(domain2);
+
+    // The cached transform must not be reused for a different domain
+    conv->function(domain1, values1);
+    conv->function(domain2, values2);
+    FunctionValues expected2(domain2);
+    makeConvolution(1.0)->function(domain2, expected2);
+    for (size_t i = 0; i < x2.size(); ++i) {
+      TS_ASSERT_DELTA(values2.getCalculated(i), expected2.getCalculated(i),
+                      1e-12);
+    }
+
+    // ... nor if the (fixed) resolution parameters change
+    conv->getFunction(0)->setParameter("s", 2.0);
+    conv->function(domain1, values1);
+    FunctionValues expected1(domain1);
+    makeConvolution(2.0)->function(domain1, expected1);
+    for (size_t i = 0; i < x1.size(); ++i) {
+      TS_ASSERT_DELTA(values1.getCalculated(i), expected1.getCalculated(i),
+                      1e-12);
+    }
+
+    // ... nor for a domain with the same ends and size but other points
+    auto x3 = x1;
+    for (size_t i = 1; i + 1 < x3.size(); ++i) {
+      x3[i] += 0.02 * std::sin(static_cast<double>(i));
+    }
+    FunctionDomain1DView domain3(x3.data(), x3.size());
+    FunctionValues values3(domain3), expected3(domain3);
+    conv->function(domain3, values3);
+    makeConvolution(2.0)->function(domain3, expected3);
+    for (size_t i = 0; i < x3.size(); ++i) {
+      TS_ASSERT_DELTA(values3.getCalculated(i), expected3.getCalculated(i),
+                      1e-12);
+    }
+  }
+
+  void testResolutionCacheIsRefreshedWhenResolutionAttributesChange() {
+    auto makeResolution = [](double width) {
+      auto res = boost::make_shared<TabulatedFunction>();
+      std::vector<double> x(201), y(201);
+      for (size_t i = 0; i < x.size(); ++i) {
+        x[i] = -10.0 + 0.1 * static_cast<double>(i);
+        y[i] = std::exp(-x[i] * x[i] / (width * width));
+      }
+      res->setAttributeValue("X", x);
+      res->setAttributeValue("Y", y);
+      return res;
+    };
+    auto makeConvolution = [](const IFunction_sptr &res) {
+      auto conv = boost::make_shared<Convolution>();
+      conv->addFunction(res);
+      auto fun = boost::make_shared<ConvolutionTest_Gauss>();
+      fun->setParameter("c", 0.5);
+      fun->setParameter("h", 2.0);
+      fun->setParameter("s", 0.7);
+      conv->addFunction(fun);
+      return conv;
+    };
+
+    std::vector<double> x(101);
+    for (size_t i = 0; i < x.size(); ++i) {
+      x[i] = -5.0 + 0.1 * static_cast<double>(i);
+    }
+    FunctionDomain1DView domain(x.data(), x.size());
+    FunctionValues values(domain), expected(domain);
+
+    auto conv = makeConvolution(makeResolution(1.0));
+    conv->function(domain, values);
+    // A resolution defined by its attributes has no parameters to change
+    const auto wider = makeResolution(2.0);
+    conv->getFunction(0)->setAttribute("Y", wider->getAttribute("Y"));
+    conv->function(domain, values);
+    makeConvolution(makeResolution(2.0))->function(domain, expected);
+    for (size_t i = 0; i < x.size(); ++i) {
+      TS_ASSERT_DELTA(values.getCalculated(i), expected.getCalculated(i),
+                      1e-12);
+    }
+  }
+
   void testForCategories() {
     Convolution forCat;
     const std::vector<std::string> categories = forCat.categories();
@@ -299,6 +299,38 @@ public:
     }
   }
 
+  void test_values_with_shift_and_scaling() {
+    TabulatedFunction fun;
+    const size_t n = 100;
+    std::vector<double> X(n);
+    std::vector<double> Y(n);
+    for (size_t i = 0; i < n; ++i) {
+      X[i] = double(i);
+      Y[i] = 2.0 * X[i] + 1.0;
+    }
+    fun.setAttributeValue("X", X);
+    fun.setAttributeValue("Y", Y);
+    fun.setParameter("Shift", 3.0);
+    fun.setParameter("XScaling", 0.5);
+    // The tabulated points are at 3, 3.5, ..., 52.5
+    auto expected = [](double xx) {
+      if (xx < 3.0 || xx > 52.5)
+        return 0.0;
+      return 2.0 * (xx - 3.0) / 0.5 + 1.0;
+    };
+
+    // The first tabulated point used is found by bisection, so check domains
+    // starting before, at, between and after tabulated points
+    for (const double start : {0.0, 3.0, 20.0, 20.25, 20.3, 52.0}) {
+      FunctionDomain1DVector x(start, start + 10.0, 41);
+      FunctionValues y(x);
+      fun.function(x, y);
+      for (size_t i = 0; i < x.size(); ++i) {
+        TS_ASSERT_DELTA(y[i], expected(x[i]), 1e-10);
+      }
+    }
+  }
+
   void test_set_X_Y_attributes_different_sizes() {
     TabulatedFunction fun;
     const size_t n = 10;
@@ -85,9 +85,15 @@ private:
   getOutputWorkspace(const std::string &propName,
                      const API::IAlgorithm_sptr &loader) const;
 
+  /// Load the runs of a sum and add them together.
+  API::Workspace_sptr loadAndSumRuns(const std::vector<std::string> &fileNames,
+                                     const std::string &wsName);
   /// Load a file to a given workspace name.
   API::Workspace_sptr loadFileToWs(const std::string &fileName,
                                    const std::string &wsName);
+  /// Load a file without adding it to the ADS.
+  API::Workspace_sptr loadFile(const std::string &fileName,
+                               const std::string &wsName);
   /// Plus two workspaces together, "in place".
   API::Workspace_sptr plusWs(API::Workspace_sptr ws1, API::Workspace_sptr ws2);
   /// Manually group workspaces.
@@ -24,6 +24,9 @@ class File;
 }
 
 namespace Mantid {
+namespace DataObjects {
+class FileBackedWorkspace2D;
+}
 
 namespace DataHandling {
 /**
@@ -188,6 +191,10 @@ private:
                  int &hist, int &wsIndex,
                  API::MatrixWorkspace_sptr local_workspace);
 
+  /// Set up a file backed workspace to read its spectra on demand
+  void loadSpectraOnDemand(DataObjects::FileBackedWorkspace2D &workspace,
+                           Mantid::NeXus::NXDouble &xbins, const int xlength);
+
   /// Load the data from a non-spectra axis (Numeric/Text) into the workspace
   void loadNonSpectraAxis(API::MatrixWorkspace_sptr local_workspace,
                           Mantid::NeXus::NXData &data);
@@ -227,6 +234,8 @@ private:
   /// list of spectra filtered by min/max/list, currently
   /// used only when loading data into event_workspace
   std::vector<int> m_filtered_spec_idxs;
+  /// Whether the workspace data is read from the file on demand
+  bool m_loadOnDemand;
 
   // C++ interface to the NXS file
   ::NeXus::File *m_cppFile;
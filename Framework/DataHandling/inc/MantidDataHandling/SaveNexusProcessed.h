@@ -79,9 +79,10 @@ private:
                       Mantid::API::MatrixWorkspace_const_sptr matrixWorkspace);
 
   template <class T>
-  static void appendEventListData(const std::vector<T> &events, size_t offset,
-                                  double *tofs, float *weights,
-                                  float *errorSquareds, int64_t *pulsetimes);
+  static void appendEventListData(const std::vector<T> &events, size_t first,
+                                  size_t last, size_t offset, double *tofs,
+                                  float *weights, float *errorSquareds,
+                                  int64_t *pulsetimes);
 
   void execEvent(Mantid::NeXus::NexusFileIO *nexusFile,
                  const bool uniformSpectra, const std::vector<int> &spec);
@@ -16,6 +16,8 @@
 #include "MantidAPI/WorkspaceGroup.h"
 #include "MantidKernel/ArrayProperty.h"
 #include "MantidKernel/FacilityInfo.h"
+#include "MantidKernel/Memory.h"
+#include "MantidKernel/MultiThreaded.h"
 
 #include <Poco/Path.h>
 
@@ -84,6 +86,52 @@ flattenVecOfVec(std::vector<std::vector<std::string>> vecOfVec) {
 
   return flattenedVec;
 }
+
+/**
+ * Reserve room in the event lists of a workspace, or of the members of a
+ * group, for the events of all the runs that will be summed into it. The runs
+ * are assumed to be of a similar size to the one already loaded, as when
+ * summing repeated runs.
+ * @param ws :: The first run of the sum
+ * @param numberOfRuns :: The number of runs in the sum
+ */
+void reserveEventsForRuns(const Mantid::API::Workspace_sptr &ws,
+                          const size_t numberOfRuns) {
+  using namespace Mantid::API;
+  if (auto group = boost::dynamic_pointer_cast<WorkspaceGroup>(ws)) {
+    for (const auto &member : *group)
+      reserveEventsForRuns(member, numberOfRuns);
+    return;
+  }
+  auto eventWS = boost::dynamic_pointer_cast<IEventWorkspace>(ws);
+  if (!eventWS || numberOfRuns < 2)
+    return;
+  const auto numberOfSpectra =
+      static_cast<int64_t>(eventWS->getNumberHistograms());
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int64_t i = 0; i < numberOfSpectra; ++i) {
+    auto &eventList = eventWS->getSpectrum(static_cast<size_t>(i));
+    eventList.reserve(eventList.getNumberEvents() * numberOfRuns);
+  }
+}
+
+/**
+ * The number of runs of a sum to load at the same time. There are no more of
+ * them than threads, and they fit in half of the available memory if they are
+ * the size of the run already loaded.
+ * @param run :: The first run of the sum
+ * @param numberOfRuns :: The number of runs left to load
+ */
+size_t runsPerBatch(const Mantid::API::Workspace &run,
+                    const size_t numberOfRuns) {
+  const size_t availableMemory =
+      Mantid::Kernel::MemoryStats().availMem() * size_t(1024) / 2;
+  const size_t runSize = std::max(run.getMemorySize(), size_t(1));
+  const auto numberOfThreads = static_cast<size_t>(PARALLEL_GET_MAX_THREADS);
+  const size_t batchSize = std::min(
+      {numberOfRuns, numberOfThreads, availableMemory / runSize});
+  return std::max(batchSize, size_t(1));
+}
 } // namespace
 
 namespace Mantid {
@@ -396,19 +444,10 @@ void Load::loadMultipleFiles() {
   std::vector<API::Workspace_sptr> loadedWsList;
   loadedWsList.reserve(allFilenames.size());
 
-  Workspace_sptr tempWs;
-
   // Cycle through the filenames and wsNames.
   for (auto filenames = allFilenames.cbegin(); filenames != allFilenames.cend();
        ++filenames, ++wsName) {
-    auto filename = filenames->cbegin();
-    Workspace_sptr sumWS = loadFileToWs(*filename, *wsName);
-
-    ++filename;
-    for (; filename != filenames->cend(); ++filename) {
-      tempWs = loadFileToWs(*filename, "__@loadsum_temp@");
-      sumWS = plusWs(sumWS, tempWs);
-    }
+    Workspace_sptr sumWS = loadAndSumRuns(*filenames, *wsName);
 
     API::WorkspaceGroup_sptr group =
         boost::dynamic_pointer_cast<WorkspaceGroup>(sumWS);
@@ -466,16 +505,56 @@ void Load::loadMultipleFiles() {
       setProperty(outWsPropName, childWs);
     }
   }
+}
 
-  // Clean up.
-  if (tempWs) {
-    Algorithm_sptr alg =
-        AlgorithmManager::Instance().createUnmanaged("DeleteWorkspace");
-    alg->initialize();
-    alg->setChild(true);
-    alg->setProperty("Workspace", tempWs);
-    alg->execute();
+/**
+ * Load the runs of a sum and add them together. The first run is loaded into
+ * the sum. The others are loaded in batches, in parallel and outside of the
+ * ADS, as many at a time as runsPerBatch allows. The runs of a batch are added
+ * pairwise, halving their number at each step, and the total of the batch is
+ * added to the sum.
+ * @param fileNames :: The files of the runs
+ * @param wsName :: The name of the sum in the ADS
+ * @returns The sum
+ */
+API::Workspace_sptr
+Load::loadAndSumRuns(const std::vector<std::string> &fileNames,
+                     const std::string &wsName) {
+  Workspace_sptr sumWS = loadFileToWs(fileNames.front(), wsName);
+  reserveEventsForRuns(sumWS, fileNames.size());
+
+  const size_t batchSize = runsPerBatch(*sumWS, fileNames.size() - 1);
+  std::vector<Workspace_sptr> runs;
+  for (size_t first = 1; first < fileNames.size(); first += batchSize) {
+    const size_t numberOfRuns = std::min(batchSize, fileNames.size() - first);
+    runs.assign(numberOfRuns, Workspace_sptr());
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int64_t i = 0; i < static_cast<int64_t>(numberOfRuns); ++i) {
+      PARALLEL_START_INTERUPT_REGION
+      const auto run = static_cast<size_t>(i);
+      runs[run] = loadFile(fileNames[first + run], "__@loadsum_temp@");
+      PARALLEL_END_INTERUPT_REGION
+    }
+    PARALLEL_CHECK_INTERUPT_REGION
+
+    // Each step adds the run at index + step to the run at index, for every
+    // index that is a multiple of twice the step
+    for (size_t step = 1; step < numberOfRuns; step *= 2) {
+      const auto numberOfPairs =
+          static_cast<int64_t>((numberOfRuns - 1 + step) / (2 * step));
+      PARALLEL_FOR_NO_WSP_CHECK()
+      for (int64_t pair = 0; pair < numberOfPairs; ++pair) {
+        PARALLEL_START_INTERUPT_REGION
+        const auto index = static_cast<size_t>(pair) * 2 * step;
+        plusWs(runs[index], runs[index + step]);
+        runs[index + step].reset();
+        PARALLEL_END_INTERUPT_REGION
+      }
+      PARALLEL_CHECK_INTERUPT_REGION
+    }
+    plusWs(sumWS, runs.front());
   }
+  return sumWS;
 }
 
 /**
@@ -642,6 +721,21 @@ void Load::cancel() {
  */
 API::Workspace_sptr Load::loadFileToWs(const std::string &fileName,
                                        const std::string &wsName) {
+  Workspace_sptr ws = loadFile(fileName, wsName);
+  AnalysisDataService::Instance().addOrReplace(wsName, ws);
+  return ws;
+}
+
+/**
+ * Loads a file into a workspace that is not added to the ADS.
+ *
+ * @param fileName :: file name to load.
+ * @param wsName   :: name to give the output workspace property of the loader
+ *
+ * @returns a pointer to the loaded workspace
+ */
+API::Workspace_sptr Load::loadFile(const std::string &fileName,
+                                   const std::string &wsName) {
   Mantid::API::IAlgorithm_sptr loadAlg = createChildAlgorithm("Load", 1);
 
   // Get the list properties for the concrete loader load algorithm
@@ -664,10 +758,7 @@ API::Workspace_sptr Load::loadFileToWs(const std::string &fileName,
 
   loadAlg->executeAsChildAlg();
 
-  Workspace_sptr ws = loadAlg->getProperty("OutputWorkspace");
-  // ws->setName(wsName);
-  AnalysisDataService::Instance().addOrReplace(wsName, ws);
-  return ws;
+  return loadAlg->getProperty("OutputWorkspace");
 }
 
 /**
@@ -685,21 +776,15 @@ API::Workspace_sptr Load::plusWs(Workspace_sptr ws1, Workspace_sptr ws2) {
   if (group1 && group2) {
     // If we're dealing with groups, then the child workspaces must be added
     // separately - setProperty
-    // wont work otherwise.
-    std::vector<std::string> group1ChildWsNames = group1->getNames();
-    std::vector<std::string> group2ChildWsNames = group2->getNames();
-
-    if (group1ChildWsNames.size() != group2ChildWsNames.size())
+    // wont work otherwise. The members are taken by index, as the groups may
+    // not be in the ADS.
+    if (group1->size() != group2->size())
       throw std::runtime_error("Unable to add group workspaces with different "
                                "number of child workspaces.");
 
-    auto group1ChildWsName = group1ChildWsNames.begin();
-    auto group2ChildWsName = group2ChildWsNames.begin();
-
-    for (; group1ChildWsName != group1ChildWsNames.end();
-         ++group1ChildWsName, ++group2ChildWsName) {
-      Workspace_sptr group1ChildWs = group1->getItem(*group1ChildWsName);
-      Workspace_sptr group2ChildWs = group2->getItem(*group2ChildWsName);
+    for (size_t i = 0; i < group1->size(); ++i) {
+      Workspace_sptr group1ChildWs = group1->getItem(i);
+      Workspace_sptr group2ChildWs = group2->getItem(i);
 
       Mantid::API::IAlgorithm_sptr plusAlg = createChildAlgorithm("Plus", 1);
       plusAlg->setProperty<Workspace_sptr>("LHSWorkspace", group1ChildWs);
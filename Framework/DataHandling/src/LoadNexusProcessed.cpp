@@ -17,6 +17,7 @@
 #include "MantidAPI/WorkspaceGroup.h"
 #include "MantidAPI/WorkspaceHistory.h"
 #include "MantidDataObjects/EventWorkspace.h"
+#include "MantidDataObjects/FileBackedWorkspace2D.h"
 #include "MantidDataObjects/Peak.h"
 #include "MantidDataObjects/PeakNoShapeFactory.h"
 #include "MantidDataObjects/PeakShapeEllipsoidFactory.h"
@@ -39,6 +40,7 @@
 
 #include <nexus/NeXusException.hpp>
 
+#include <future>
 #include <map>
 #include <string>
 #include <vector>
@@ -175,13 +177,42 @@ bool isMultiPeriodFile(int nWorkspaceEntries, Workspace_sptr sampleWS,
   return isMultiPeriod;
 }
 
+/// Events read from the file at once when loading an event workspace
+constexpr int64_t EVENT_BLOCK_SIZE = 1024 * 1024;
+
+/// The events of a block of spectra of an event workspace
+struct EventBlock {
+  /// The indices into the filtered spectra of the spectra in the block
+  int64_t begin{0};
+  int64_t end{0};
+  /// The index in the file of the first event of the block
+  int64_t offset{0};
+  boost::shared_array<int64_t> pulsetimes;
+  boost::shared_array<double> tofs;
+  boost::shared_array<float> error_squareds;
+  boost::shared_array<float> weights;
+};
+
+/// Reads count values of an event field starting with the value offset, or
+/// nothing if the field is not in the file or there is nothing to read. The
+/// indices are 64-bit, so any number of events can be read.
+template <class T>
+boost::shared_array<T> loadEventField(NXData &wksp_cls, const std::string &name,
+                                      const int64_t offset,
+                                      const int64_t count) {
+  if (count == 0 || !wksp_cls.isValid(name))
+    return boost::shared_array<T>();
+  NXDataSetTyped<T> field = wksp_cls.openNXDataSet<T>(name);
+  return field.loadBlock64(count, offset);
+}
 } // namespace
 
 /// Default constructor
 LoadNexusProcessed::LoadNexusProcessed()
     : m_shared_bins(false), m_xbins(0), m_axis1vals(), m_list(false),
       m_interval(false), m_spec_min(0), m_spec_max(Mantid::EMPTY_INT()),
-      m_spec_list(), m_filtered_spec_idxs(), m_cppFile(nullptr) {}
+      m_spec_list(), m_filtered_spec_idxs(), m_loadOnDemand(false),
+      m_cppFile(nullptr) {}
 
 /// Delete NexusFileIO in destructor
 LoadNexusProcessed::~LoadNexusProcessed() { delete m_cppFile; }
@@ -246,6 +277,14 @@ void LoadNexusProcessed::init() {
       "For multiperiod workspaces. Copy instrument, parameter and x-data "
       "rather than loading it directly for each workspace. Y, E and log "
       "information is always loaded.");
+  declareProperty("LoadOnDemand", false,
+                  "If true and a single histogram workspace is loaded, its "
+                  "data, instrument, sample and logs are only read from the "
+                  "file when first accessed. The file must not be changed "
+                  "while the workspace exists.");
+  declareProperty("MaxResidentSpectra", static_cast<int>(0), mustBePositive,
+                  "With LoadOnDemand, the maximum number of unmodified "
+                  "spectra held in memory at a time. 0 means no limit.");
 }
 
 /**
@@ -424,6 +463,10 @@ void LoadNexusProcessed::exec() {
     os << basename << entrynumber;
     const std::string targetEntryName = os.str();
 
+    // Only a workspace that is not part of a group is loaded on demand
+    m_loadOnDemand = getProperty("LoadOnDemand");
+    m_loadOnDemand &= nWorkspaceEntries == 1 || !bDefaultEntryNumber;
+
     // Take the first real workspace obtainable. We need it even if loading
     // groups.
     tempWS = loadEntry(root, targetEntryName, 0, 1);
@@ -684,99 +727,126 @@ LoadNexusProcessed::loadEventEntry(NXData &wksp_cls, NXDouble &xbins,
     unitLabel = indices_data.attributes("units");
   ws->setYUnitLabel(unitLabel);
 
-  // Handle optional fields.
-  // TODO: Handle inconsistent sizes
-  boost::shared_array<int64_t> pulsetimes;
-  if (wksp_cls.isValid("pulsetime")) {
-    NXDataSetTyped<int64_t> pulsetime =
-        wksp_cls.openNXDataSet<int64_t>("pulsetime");
-    pulsetime.load();
-    pulsetimes = pulsetime.sharedBuffer();
-  }
-
-  boost::shared_array<double> tofs;
-  if (wksp_cls.isValid("tof")) {
-    NXDouble tof = wksp_cls.openNXDouble("tof");
-    tof.load();
-    tofs = tof.sharedBuffer();
-  }
-
-  boost::shared_array<float> error_squareds;
-  if (wksp_cls.isValid("error_squared")) {
-    NXFloat error_squared = wksp_cls.openNXFloat("error_squared");
-    error_squared.load();
-    error_squareds = error_squared.sharedBuffer();
-  }
-
-  boost::shared_array<float> weights;
-  if (wksp_cls.isValid("weight")) {
-    NXFloat weight = wksp_cls.openNXFloat("weight");
-    weight.load();
-    weights = weight.sharedBuffer();
-  }
-
   // What type of event lists?
+  // TODO: Handle inconsistent sizes
+  const bool hasPulsetimes = wksp_cls.isValid("pulsetime");
+  const bool hasTofs = wksp_cls.isValid("tof");
+  const bool hasErrorSquareds = wksp_cls.isValid("error_squared");
+  const bool hasWeights = wksp_cls.isValid("weight");
   EventType type = TOF;
-  if (tofs && pulsetimes && weights && error_squareds)
+  if (hasTofs && hasPulsetimes && hasWeights && hasErrorSquareds)
     type = WEIGHTED;
-  else if ((tofs && weights && error_squareds))
+  else if ((hasTofs && hasWeights && hasErrorSquareds))
     type = WEIGHTED_NOTIME;
-  else if (pulsetimes && tofs)
+  else if (hasPulsetimes && hasTofs)
     type = TOF;
   else
     throw std::runtime_error("Could not figure out the type of event list!");
 
   // indices of events
   boost::shared_array<int64_t> indices = indices_data.sharedBuffer();
-  // Create all the event lists
   auto max = static_cast<int64_t>(m_filtered_spec_idxs.size());
-  Progress progress(this, progressStart, progressStart + progressRange, max);
-  PARALLEL_FOR_NO_WSP_CHECK()
+  const auto fileIndex = [this](const int64_t j) {
+    return static_cast<size_t>(m_filtered_spec_idxs[j] - 1);
+  };
+
+  // Split the spectra into blocks of consecutive spectra holding about
+  // EVENT_BLOCK_SIZE events in the file
+  std::vector<EventBlock> blocks;
   for (int64_t j = 0; j < max; ++j) {
-    PARALLEL_START_INTERUPT_REGION
-    size_t wi = m_filtered_spec_idxs[j] - 1;
-    int64_t index_start = indices[wi];
-    int64_t index_end = indices[wi + 1];
-    if (index_end >= index_start) {
-      EventList &el = ws->getSpectrum(j);
-      el.switchTo(type);
-
-      // Allocate all the required memory
-      el.reserve(index_end - index_start);
-      el.clearDetectorIDs();
-
-      for (int64_t i = index_start; i < index_end; i++)
-        switch (type) {
-        case TOF:
-          el.addEventQuickly(TofEvent(tofs[i], DateAndTime(pulsetimes[i])));
-          break;
-        case WEIGHTED:
-          el.addEventQuickly(WeightedEvent(tofs[i], DateAndTime(pulsetimes[i]),
-                                           weights[i], error_squareds[i]));
-          break;
-        case WEIGHTED_NOTIME:
-          el.addEventQuickly(
-              WeightedEventNoTime(tofs[i], weights[i], error_squareds[i]));
-          break;
-        }
+    const size_t wi = fileIndex(j);
+    if (blocks.empty() || wi < fileIndex(blocks.back().end - 1) ||
+        indices[wi + 1] - blocks.back().offset > EVENT_BLOCK_SIZE) {
+      blocks.emplace_back();
+      blocks.back().begin = j;
+      blocks.back().offset = indices[wi];
+    }
+    blocks.back().end = j + 1;
+  }
+
+  // Read the events of a block from the file
+  const auto readBlock = [&](EventBlock &block) {
+    const int64_t count =
+        indices[fileIndex(block.end - 1) + 1] - block.offset;
+    block.pulsetimes =
+        loadEventField<int64_t>(wksp_cls, "pulsetime", block.offset, count);
+    block.tofs = loadEventField<double>(wksp_cls, "tof", block.offset, count);
+    block.error_squareds =
+        loadEventField<float>(wksp_cls, "error_squared", block.offset, count);
+    block.weights =
+        loadEventField<float>(wksp_cls, "weight", block.offset, count);
+  };
+
+  // Create the event lists of a block
+  Progress progress(this, progressStart, progressStart + progressRange, max);
+  const auto decodeBlock = [&](const EventBlock &block) {
+    const auto &pulsetimes = block.pulsetimes;
+    const auto &tofs = block.tofs;
+    const auto &error_squareds = block.error_squareds;
+    const auto &weights = block.weights;
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int64_t j = block.begin; j < block.end; ++j) {
+      PARALLEL_START_INTERUPT_REGION
+      size_t wi = fileIndex(j);
+      int64_t index_start = indices[wi] - block.offset;
+      int64_t index_end = indices[wi + 1] - block.offset;
+      if (index_end >= index_start) {
+        EventList &el = ws->getSpectrum(j);
+        el.switchTo(type);
+
+        // Allocate all the required memory
+        el.reserve(index_end - index_start);
+        el.clearDetectorIDs();
+
+        for (int64_t i = index_start; i < index_end; i++)
+          switch (type) {
+          case TOF:
+            el.addEventQuickly(TofEvent(tofs[i], DateAndTime(pulsetimes[i])));
+            break;
+          case WEIGHTED:
+            el.addEventQuickly(WeightedEvent(tofs[i],
+                                             DateAndTime(pulsetimes[i]),
+                                             weights[i], error_squareds[i]));
+            break;
+          case WEIGHTED_NOTIME:
+            el.addEventQuickly(
+                WeightedEventNoTime(tofs[i], weights[i], error_squareds[i]));
+            break;
+          }
 
-      // Set the X axis
-      if (this->m_shared_bins)
-        el.setHistogram(this->m_xbins);
-      else {
-        MantidVec x(xbins.dim1());
-
-        for (int i = 0; i < xbins.dim1(); i++)
-          x[i] = xbins(static_cast<int>(wi), i);
-        // Workspace and el was just created, so we can just set a new histogram
-        // We can move x as it is not longer used after this point
-        el.setHistogram(HistogramData::BinEdges(std::move(x)));
+        // Set the X axis
+        if (this->m_shared_bins)
+          el.setHistogram(this->m_xbins);
+        else {
+          MantidVec x(xbins.dim1());
+
+          for (int i = 0; i < xbins.dim1(); i++)
+            x[i] = xbins(static_cast<int>(wi), i);
+          // Workspace and el was just created, so we can just set a new
+          // histogram. We can move x as it is not longer used after this
+          // point
+          el.setHistogram(HistogramData::BinEdges(std::move(x)));
+        }
       }
+      progress.report();
+      PARALLEL_END_INTERUPT_REGION
     }
-    progress.report();
-    PARALLEL_END_INTERUPT_REGION
+    PARALLEL_CHECK_INTERUPT_REGION
+  };
+
+  // Decode each block on worker threads while the next one is read, so that
+  // reading and decompressing the file overlaps with creating the event lists
+  // and no more than two blocks of events are held in memory at once
+  if (!blocks.empty())
+    readBlock(blocks.front());
+  for (size_t k = 0; k < blocks.size(); ++k) {
+    auto decoding = std::async(std::launch::async, decodeBlock,
+                               std::cref(blocks[k]));
+    if (k + 1 < blocks.size())
+      readBlock(blocks[k + 1]);
+    decoding.get();
+    blocks[k] = EventBlock();
   }
-  PARALLEL_CHECK_INTERUPT_REGION
 
   return ws;
 }
@@ -1267,7 +1337,7 @@ API::MatrixWorkspace_sptr LoadNexusProcessed::loadNonEventEntry(
   checkOptionalProperties(nspectra);
   // Actual number of spectra in output workspace (if only a range was going
   // to be loaded)
-  size_t total_specs = calculateWorkspaceSize(nspectra);
+  size_t total_specs = calculateWorkspaceSize(nspectra, m_loadOnDemand);
 
   //// Create the 2D workspace for the output
   bool hasFracArea = false;
@@ -1278,10 +1348,20 @@ API::MatrixWorkspace_sptr LoadNexusProcessed::loadNonEventEntry(
     workspaceType = "RebinnedOutput";
   }
 
-  API::MatrixWorkspace_sptr local_workspace =
-      boost::dynamic_pointer_cast<API::MatrixWorkspace>(
-          WorkspaceFactory::Instance().create(workspaceType, total_specs,
-                                              xlength, nchannels));
+  FileBackedWorkspace2D_sptr fileBacked;
+  API::MatrixWorkspace_sptr local_workspace;
+  if (m_loadOnDemand && workspaceType == "Workspace2D") {
+    const int maxResidentSpectra = getProperty("MaxResidentSpectra");
+    fileBacked = boost::make_shared<FileBackedWorkspace2D>(
+        getPropertyValue("Filename"), mtd_entry.path(),
+        static_cast<size_t>(maxResidentSpectra));
+    fileBacked->initialize(total_specs, xlength, nchannels);
+    local_workspace = fileBacked;
+  } else {
+    local_workspace = boost::dynamic_pointer_cast<API::MatrixWorkspace>(
+        WorkspaceFactory::Instance().create(workspaceType, total_specs,
+                                            xlength, nchannels));
+  }
   try {
     local_workspace->setTitle(mtd_entry.getString("title"));
   } catch (std::runtime_error &) {
@@ -1297,6 +1377,10 @@ API::MatrixWorkspace_sptr LoadNexusProcessed::loadNonEventEntry(
   local_workspace->setYUnitLabel(unitLabel);
 
   readBinMasking(wksp_cls, local_workspace);
+  if (fileBacked) {
+    loadSpectraOnDemand(*fileBacked, xbins, xlength);
+    return local_workspace;
+  }
   NXDataSetTyped<double> errors = wksp_cls.openNXDouble("errors");
   NXDataSetTyped<double> fracarea = errors;
   if (hasFracArea) {
@@ -1450,6 +1534,32 @@ API::MatrixWorkspace_sptr LoadNexusProcessed::loadNonEventEntry(
   return local_workspace;
 }
 
+/**
+ * Set up the X data of a file backed workspace and let it read the rest of
+ * the data of the filtered spectra on demand
+ *
+ * @param workspace The workspace to set up
+ * @param xbins The bin boundaries, already loaded
+ * @param xlength The number of bin boundaries per spectrum
+ */
+void LoadNexusProcessed::loadSpectraOnDemand(FileBackedWorkspace2D &workspace,
+                                             NXDouble &xbins,
+                                             const int xlength) {
+  workspace.setDistribution(xbins.attributes("distribution") == "1");
+  std::vector<size_t> rows(m_filtered_spec_idxs.size());
+  for (size_t i = 0; i < rows.size(); ++i) {
+    rows[i] = static_cast<size_t>(m_filtered_spec_idxs[i] - 1);
+    if (m_shared_bins) {
+      workspace.setSharedX(i, m_xbins.cowData());
+    } else {
+      const double *x = xbins() + rows[i] * static_cast<size_t>(xlength);
+      workspace.setSharedX(
+          i, Kernel::make_cow<HistogramData::HistogramX>(x, x + xlength));
+    }
+  }
+  workspace.loadSpectraOnAccess(rows);
+}
+
 //-------------------------------------------------------------------------------------------------
 /**
  * Load a single entry into a workspace (event_workspace or workspace2d)
@@ -1533,6 +1643,8 @@ API::Workspace_sptr LoadNexusProcessed::loadEntry(NXRoot &root,
                           mtd_entry, xlength, workspaceType);
   }
   size_t nspectra = local_workspace->getNumberHistograms();
+  const auto fileBacked =
+      boost::dynamic_pointer_cast<FileBackedWorkspace2D>(local_workspace);
 
   // Units
   bool verticalHistogram(false);
@@ -1581,12 +1693,15 @@ API::Workspace_sptr LoadNexusProcessed::loadEntry(NXRoot &root,
     }
   }
 
-  // Are we a distribution
-  std::string dist = xbins.attributes("distribution");
-  if (dist == "1") {
-    local_workspace->setDistribution(true);
-  } else {
-    local_workspace->setDistribution(false);
+  // Are we a distribution. A file backed workspace has been set up already,
+  // as checking it would read the data.
+  if (!fileBacked) {
+    std::string dist = xbins.attributes("distribution");
+    if (dist == "1") {
+      local_workspace->setDistribution(true);
+    } else {
+      local_workspace->setDistribution(false);
+    }
   }
 
   // Get information from all but data group
@@ -1597,25 +1712,29 @@ API::Workspace_sptr LoadNexusProcessed::loadEntry(NXRoot &root,
 
   // Hop to the right point
   m_cppFile->openPath(mtd_entry.path());
-  try {
-    // This loads logs, sample, and instrument.
-    local_workspace->loadExperimentInfoNexus(
-        getPropertyValue("Filename"), m_cppFile,
-        parameterStr); // REQUIRED PER PERIOD
-
-    // Parameter map parsing only if instrument loaded OK.
-    progress(progressStart + 0.11 * progressRange,
-             "Reading the parameter maps...");
-    local_workspace->readParameterMap(parameterStr);
-  } catch (std::exception &e) {
-    // TODO. For workspaces saved via SaveNexusESS, these warnings are not
-    // relevant. Unfortunately we need to close all file handles before we can
-    // attempt loading the new way see loadNexusGeometry function . A better
-    // solution should be found
-    g_log.warning("Error loading Instrument section of nxs file");
-    g_log.warning(e.what());
-    g_log.warning("Try running LoadInstrument Algorithm on the Workspace to "
-                  "update the geometry");
+  if (fileBacked) {
+    fileBacked->loadExperimentInfoOnAccess();
+  } else {
+    try {
+      // This loads logs, sample, and instrument.
+      local_workspace->loadExperimentInfoNexus(
+          getPropertyValue("Filename"), m_cppFile,
+          parameterStr); // REQUIRED PER PERIOD
+
+      // Parameter map parsing only if instrument loaded OK.
+      progress(progressStart + 0.11 * progressRange,
+               "Reading the parameter maps...");
+      local_workspace->readParameterMap(parameterStr);
+    } catch (std::exception &e) {
+      // TODO. For workspaces saved via SaveNexusESS, these warnings are not
+      // relevant. Unfortunately we need to close all file handles before we can
+      // attempt loading the new way see loadNexusGeometry function . A better
+      // solution should be found
+      g_log.warning("Error loading Instrument section of nxs file");
+      g_log.warning(e.what());
+      g_log.warning("Try running LoadInstrument Algorithm on the Workspace to "
+                    "update the geometry");
+    }
   }
 
   readSpectraToDetectorMapping(mtd_entry, *local_workspace);
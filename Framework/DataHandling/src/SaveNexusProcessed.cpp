@@ -13,6 +13,7 @@
 #include "MantidAPI/IMDHistoWorkspace.h"
 #include "MantidAPI/WorkspaceHistory.h"
 #include "MantidDataObjects/EventWorkspace.h"
+#include "MantidDataObjects/FileBackedWorkspace2D.h"
 #include "MantidDataObjects/MaskWorkspace.h"
 #include "MantidDataObjects/OffsetsWorkspace.h"
 #include "MantidDataObjects/PeaksWorkspace.h"
@@ -21,8 +22,11 @@
 #include "MantidKernel/BoundedValidator.h"
 #include "MantidNexus/NexusFileIO.h"
 #include <Poco/File.h>
+#include <Poco/Path.h>
 #include <boost/shared_ptr.hpp>
 
+#include <algorithm>
+
 using namespace Mantid::API;
 
 namespace Mantid {
@@ -288,6 +292,17 @@ void SaveNexusProcessed::doExec(
   // get the workspace name to write to file
   const std::string wsName = inputWorkspace->getName();
 
+  // A workspace loaded on demand from the file being written must be read
+  // completely, and the file closed, before the file is changed
+  auto fileBacked =
+      boost::dynamic_pointer_cast<const FileBackedWorkspace2D>(inputWorkspace);
+  if (fileBacked && Poco::Path(fileBacked->filename()).absolute().toString() ==
+                        Poco::Path(filename).absolute().toString()) {
+    g_log.information() << "Reading " << wsName
+                        << " into memory before its file is written\n";
+    fileBacked->loadAll();
+  }
+
   // If we don't want to append then remove the file if it already exists
   const bool append_to_file = getProperty("Append");
   if (!append_to_file && !keepFile) {
@@ -399,9 +414,11 @@ void SaveNexusProcessed::exec() {
 }
 
 //-------------------------------------------------------------------------------------
-/** Append out each field of a vector of events to separate array.
+/** Append out each field of a range of a vector of events to separate array.
  *
  * @param events :: vector of TofEvent or WeightedEvent, etc.
+ * @param first :: the index of the first event to append
+ * @param last :: one past the index of the last event to append
  * @param offset :: where the first event goes in the array
  * @param tofs, weights, errorSquareds, pulsetimes :: arrays to write to.
  *        Must be initialized and big enough,
@@ -409,16 +426,17 @@ void SaveNexusProcessed::exec() {
  */
 template <class T>
 void SaveNexusProcessed::appendEventListData(const std::vector<T> &events,
+                                             size_t first, size_t last,
                                              size_t offset, double *tofs,
                                              float *weights,
                                              float *errorSquareds,
                                              int64_t *pulsetimes) {
   // Do nothing if there are no events.
-  if (events.empty())
+  if (first >= last)
     return;
 
-  const auto it = events.cbegin();
-  const auto it_end = events.cend();
+  const auto it = std::next(events.cbegin(), first);
+  const auto it_end = std::next(events.cbegin(), last);
 
   // Fill the C-arrays with the fields from all the events, as requested.
   if (tofs) {
@@ -445,7 +463,8 @@ void SaveNexusProcessed::appendEventListData(const std::vector<T> &events,
 
 //-----------------------------------------------------------------------------------------------
 /** Execute the saving of event data.
- * This will make one long event list for all events contained.
+ * This will make one long event list for all events contained, packed and
+ * written a block at a time.
  * */
 void SaveNexusProcessed::execEvent(Mantid::NeXus::NexusFileIO *nexusFile,
                                    const bool uniformSpectra,
@@ -470,13 +489,6 @@ void SaveNexusProcessed::execEvent(Mantid::NeXus::NexusFileIO *nexusFile,
   }
   indices.push_back(index);
 
-  // Initialize all the arrays
-  int64_t num = index;
-  double *tofs = nullptr;
-  float *weights = nullptr;
-  float *errorSquareds = nullptr;
-  int64_t *pulsetimes = nullptr;
-
   // overall event type.
   EventType type = m_eventWorkspace->getEventType();
   bool writeTOF = true;
@@ -499,60 +511,66 @@ void SaveNexusProcessed::execEvent(Mantid::NeXus::NexusFileIO *nexusFile,
     break;
   }
 
-  // --- Initialize the combined event arrays ----
-  if (writeTOF)
-    tofs = new double[num];
-  if (writeWeight)
-    weights = new float[num];
-  if (writeError)
-    errorSquareds = new float[num];
-  if (writePulsetime)
-    pulsetimes = new int64_t[num];
-
-  // --- Fill in the combined event arrays ----
-  PARALLEL_FOR_NO_WSP_CHECK()
-  for (int wi = 0;
-       wi < static_cast<int>(m_eventWorkspace->getNumberHistograms()); wi++) {
-    PARALLEL_START_INTERUPT_REGION
-    const DataObjects::EventList &el = m_eventWorkspace->getSpectrum(wi);
-
-    // This is where it will land in the output array.
-    // It is okay to write in parallel since none should step on each other.
-    size_t offset = indices[wi];
-
-    switch (el.getEventType()) {
-    case TOF:
-      appendEventListData(el.getEvents(), offset, tofs, weights, errorSquareds,
-                          pulsetimes);
-      break;
-    case WEIGHTED:
-      appendEventListData(el.getWeightedEvents(), offset, tofs, weights,
-                          errorSquareds, pulsetimes);
-      break;
-    case WEIGHTED_NOTIME:
-      appendEventListData(el.getWeightedEventsNoTime(), offset, tofs, weights,
-                          errorSquareds, pulsetimes);
-      break;
-    }
-    m_progress->reportIncrement(el.getNumberEvents(), "Copying EventList");
+  // --- Fill in a block of the combined event arrays ----
+  // Called on a worker thread while the previous block is being written
+  const auto packer = [&](const size_t firstEvent, const size_t numEvents,
+                          double *tofs, float *weights, float *errorSquareds,
+                          int64_t *pulsetimes) {
+    const auto blockBegin = static_cast<int64_t>(firstEvent);
+    const auto blockEnd = static_cast<int64_t>(firstEvent + numEvents);
+    // The spectra holding the events of this block
+    const auto firstSpectrum = static_cast<int>(
+        std::upper_bound(indices.cbegin(), indices.cend(), blockBegin) -
+        indices.cbegin() - 1);
+    const auto lastSpectrum = static_cast<int>(
+        std::lower_bound(indices.cbegin(), indices.cend(), blockEnd) -
+        indices.cbegin());
+
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int wi = firstSpectrum; wi < lastSpectrum; wi++) {
+      PARALLEL_START_INTERUPT_REGION
+      const DataObjects::EventList &el = m_eventWorkspace->getSpectrum(wi);
+
+      // The part of the list in this block, and where it lands in the
+      // block. It is okay to write in parallel since none should step on
+      // each other.
+      const auto begin = std::max(indices[wi], blockBegin);
+      const auto end = std::min(indices[wi + 1], blockEnd);
+      if (begin < end) {
+        const auto first = static_cast<size_t>(begin - indices[wi]);
+        const auto last = static_cast<size_t>(end - indices[wi]);
+        const auto offset = static_cast<size_t>(begin - blockBegin);
+        switch (el.getEventType()) {
+        case TOF:
+          appendEventListData(el.getEvents(), first, last, offset, tofs,
+                              weights, errorSquareds, pulsetimes);
+          break;
+        case WEIGHTED:
+          appendEventListData(el.getWeightedEvents(), first, last, offset,
+                              tofs, weights, errorSquareds, pulsetimes);
+          break;
+        case WEIGHTED_NOTIME:
+          appendEventListData(el.getWeightedEventsNoTime(), first, last,
+                              offset, tofs, weights, errorSquareds,
+                              pulsetimes);
+          break;
+        }
+        m_progress->reportIncrement(static_cast<size_t>(end - begin),
+                                    "Copying EventList");
+      }
 
-    PARALLEL_END_INTERUPT_REGION
-  }
-  PARALLEL_CHECK_INTERUPT_REGION
+      PARALLEL_END_INTERUPT_REGION
+    }
+    PARALLEL_CHECK_INTERUPT_REGION
+  };
 
   /*Default = DONT compress - much faster*/
   bool CompressNexus = getProperty("CompressNexus");
 
   // Write out to the NXS file.
-  nexusFile->writeNexusProcessedDataEventCombined(m_eventWorkspace, indices,
-                                                  tofs, weights, errorSquareds,
-                                                  pulsetimes, CompressNexus);
-
-  // Free mem.
-  delete[] tofs;
-  delete[] weights;
-  delete[] errorSquareds;
-  delete[] pulsetimes;
+  nexusFile->writeNexusProcessedDataEventCombined(
+      m_eventWorkspace, indices, packer, writeTOF, writePulsetime, writeWeight,
+      writeError, CompressNexus);
 }
 
 //-----------------------------------------------------------------------------------------------
@@ -19,6 +19,7 @@
 #include "MantidDataHandling/LoadNexusProcessed.h"
 #include "MantidDataHandling/SaveNexusProcessed.h"
 #include "MantidDataObjects/EventWorkspace.h"
+#include "MantidDataObjects/FileBackedWorkspace2D.h"
 #include "MantidDataObjects/Peak.h"
 #include "MantidDataObjects/PeakShapeSpherical.h"
 #include "MantidDataObjects/PeaksWorkspace.h"
@@ -1110,6 +1111,116 @@ public:
     }
   }
 
+  void test_load_on_demand() {
+    auto inputWs =
+        WorkspaceCreationHelper::create2DWorkspaceWithFullInstrument(4, 3);
+    for (size_t i = 0; i < inputWs->getNumberHistograms(); ++i) {
+      auto &y = inputWs->mutableY(i);
+      for (size_t j = 0; j < y.size(); ++j)
+        y[j] = static_cast<double>(10 * i + j);
+    }
+    inputWs->mutableRun().addProperty("on_demand_log", 42.0);
+    const std::string filename = "TestLoadNexusProcessedOnDemand.nxs";
+    SaveNexusProcessed save;
+    save.setChild(true);
+    save.initialize();
+    save.setProperty("InputWorkspace", inputWs);
+    save.setPropertyValue("Filename", filename);
+    TS_ASSERT_THROWS_NOTHING(save.execute());
+
+    LoadNexusProcessed loader;
+    loader.setChild(true);
+    loader.initialize();
+    loader.setPropertyValue("Filename", save.getPropertyValue("Filename"));
+    loader.setPropertyValue("OutputWorkspace", "ws");
+    loader.setProperty("LoadOnDemand", true);
+    loader.setProperty("MaxResidentSpectra", 2);
+    loader.setProperty("SpectrumMin", 2);
+    TS_ASSERT(loader.execute());
+
+    Workspace_sptr ws = loader.getProperty("OutputWorkspace");
+    auto outputWs = boost::dynamic_pointer_cast<FileBackedWorkspace2D>(ws);
+    TS_ASSERT(outputWs);
+    TS_ASSERT_EQUALS(outputWs->maxResidentSpectra(), 2);
+    TS_ASSERT_EQUALS(outputWs->residentSpectra(), 0);
+    TS_ASSERT_EQUALS(outputWs->getNumberHistograms(), 3);
+    // Reading the bin edges does not read the counts
+    for (size_t i = 0; i < outputWs->getNumberHistograms(); ++i)
+      TS_ASSERT_EQUALS(outputWs->binEdges(i).size(), 4);
+    TS_ASSERT_EQUALS(outputWs->residentSpectra(), 0);
+    for (size_t i = 0; i < outputWs->getNumberHistograms(); ++i) {
+      TS_ASSERT_EQUALS(outputWs->getSpectrum(i).getSpectrumNo(),
+                       static_cast<specnum_t>(i + 2));
+      TS_ASSERT_EQUALS(outputWs->x(i), inputWs->x(i + 1));
+      TS_ASSERT_EQUALS(outputWs->y(i), inputWs->y(i + 1));
+      TS_ASSERT_EQUALS(outputWs->e(i), inputWs->e(i + 1));
+    }
+    TS_ASSERT_EQUALS(outputWs->residentSpectra(), 2);
+    TS_ASSERT_EQUALS(
+        outputWs->run().getPropertyValueAsType<double>("on_demand_log"), 42.0);
+    TS_ASSERT_EQUALS(outputWs->getInstrument()->getName(),
+                     inputWs->getInstrument()->getName());
+
+    outputWs.reset();
+    ws.reset();
+    Poco::File(save.getPropertyValue("Filename")).remove();
+  }
+
+  void test_load_on_demand_then_save_to_the_same_file() {
+    auto inputWs = WorkspaceCreationHelper::create2DWorkspace(2, 3);
+    for (size_t i = 0; i < inputWs->getNumberHistograms(); ++i) {
+      auto &y = inputWs->mutableY(i);
+      for (size_t j = 0; j < y.size(); ++j)
+        y[j] = static_cast<double>(10 * i + j);
+    }
+    const std::string filename = "TestLoadNexusProcessedOnDemandResave.nxs";
+    SaveNexusProcessed save;
+    save.setChild(true);
+    save.initialize();
+    save.setProperty("InputWorkspace", inputWs);
+    save.setPropertyValue("Filename", filename);
+    TS_ASSERT_THROWS_NOTHING(save.execute());
+    const std::string path = save.getPropertyValue("Filename");
+
+    LoadNexusProcessed loader;
+    loader.setChild(true);
+    loader.initialize();
+    loader.setPropertyValue("Filename", path);
+    loader.setPropertyValue("OutputWorkspace", "ws");
+    loader.setProperty("LoadOnDemand", true);
+    loader.setProperty("MaxResidentSpectra", 1);
+    TS_ASSERT(loader.execute());
+    Workspace_sptr ws = loader.getProperty("OutputWorkspace");
+    auto onDemandWs = boost::dynamic_pointer_cast<FileBackedWorkspace2D>(ws);
+    TS_ASSERT(onDemandWs);
+
+    // The workspace is read into memory before the file is replaced
+    SaveNexusProcessed resave;
+    resave.setChild(true);
+    resave.initialize();
+    resave.setProperty("InputWorkspace", ws);
+    resave.setPropertyValue("Filename", path);
+    TS_ASSERT_THROWS_NOTHING(resave.execute());
+    TS_ASSERT_EQUALS(onDemandWs->residentSpectra(), 2);
+
+    LoadNexusProcessed reloader;
+    reloader.setChild(true);
+    reloader.initialize();
+    reloader.setPropertyValue("Filename", path);
+    reloader.setPropertyValue("OutputWorkspace", "ws");
+    TS_ASSERT(reloader.execute());
+    MatrixWorkspace_sptr reloaded = reloader.getProperty("OutputWorkspace");
+    for (size_t i = 0; i < inputWs->getNumberHistograms(); ++i) {
+      TS_ASSERT_EQUALS(onDemandWs->y(i), inputWs->y(i));
+      TS_ASSERT_EQUALS(reloaded->y(i), inputWs->y(i));
+      TS_ASSERT_EQUALS(reloaded->e(i), inputWs->e(i));
+    }
+
+    onDemandWs.reset();
+    ws.reset();
+    Poco::File(path).remove();
+  }
+
 private:
   void doHistoryTest(MatrixWorkspace_sptr matrix_ws) {
     const WorkspaceHistory history = matrix_ws->getHistory();
@@ -1460,6 +1571,51 @@ public:
     loader.setPropertyValue("OutputWorkspace", "peaks");
     TS_ASSERT(loader.execute());
   }
+
+  void testSaveAndLoadLargeHistogramWorkspace() {
+    // Several blocks of chunks of spectra
+    roundTrip(WorkspaceCreationHelper::create2DWorkspaceBinned(50000, 10),
+              "LoadNexusProcessed_large_histogram.nxs", false);
+  }
+
+  void testSaveAndLoadLargeEventWorkspace() {
+    // 3 million events: several blocks on both save and load
+    roundTrip(WorkspaceCreationHelper::createEventWorkspace(1000, 100, 3000),
+              "LoadNexusProcessed_large_event.nxs", true);
+  }
+
+private:
+  void roundTrip(const MatrixWorkspace_sptr &inputWS,
+                 const std::string &filename, const bool compress) {
+    SaveNexusProcessed saver;
+    saver.initialize();
+    saver.setProperty<MatrixWorkspace_sptr>("InputWorkspace", inputWS);
+    saver.setPropertyValue("Filename", filename);
+    saver.setProperty("CompressNexus", compress);
+    TS_ASSERT(saver.execute());
+    const std::string path = saver.getPropertyValue("Filename");
+
+    LoadNexusProcessed loader;
+    loader.initialize();
+    loader.setPropertyValue("Filename", path);
+    loader.setPropertyValue("OutputWorkspace", "roundTrip");
+    TS_ASSERT(loader.execute());
+
+    auto compare =
+        AlgorithmManager::Instance().createUnmanaged("CompareWorkspaces");
+    compare->initialize();
+    compare->setProperty<MatrixWorkspace_sptr>("Workspace1", inputWS);
+    compare->setPropertyValue("Workspace2", "roundTrip");
+    compare->setProperty<double>("Tolerance", 1e-5);
+    compare->setProperty<bool>("CheckAxes", false);
+    compare->setProperty<bool>("CheckInstrument", false);
+    compare->execute();
+    TS_ASSERT(compare->getProperty("Result"));
+
+    AnalysisDataService::Instance().remove("roundTrip");
+    if (Poco::File(path).exists())
+      Poco::File(path).remove();
+  }
 };
 
 #endif /*LOADNEXUSPROCESSEDTESTRAW_H_*/
@@ -310,6 +310,36 @@ public:
     TS_ASSERT_EQUALS(output2D->getNumberHistograms(), 397);
   }
 
+  void test_Summing_More_Than_Two_Files_Adds_Every_Run() {
+    Load single;
+    single.initialize();
+    single.setPropertyValue("Filename", "IRS38633.raw");
+    single.setPropertyValue("OutputWorkspace", "LoadTest_single");
+    TS_ASSERT_THROWS_NOTHING(single.execute());
+
+    Load loader;
+    loader.initialize();
+    // Four runs are added to the first in parallel, pairwise
+    loader.setPropertyValue("Filename", "IRS38633+38633+38633+38633+38633.raw");
+    loader.setPropertyValue("OutputWorkspace", "LoadTest_sum");
+    TS_ASSERT_THROWS_NOTHING(loader.execute());
+
+    auto &ads = AnalysisDataService::Instance();
+    const auto run = ads.retrieveWS<MatrixWorkspace>("LoadTest_single");
+    const auto sum = ads.retrieveWS<MatrixWorkspace>("LoadTest_sum");
+    TS_ASSERT(run)
+    TS_ASSERT(sum)
+    TS_ASSERT_EQUALS(sum->getNumberHistograms(), run->getNumberHistograms())
+    for (size_t i = 0; i < run->getNumberHistograms(); i += 10)
+      for (size_t j = 0; j < run->blocksize(); j += 100)
+        TS_ASSERT_DELTA(sum->y(i)[j], 5. * run->y(i)[j], 1e-9)
+    // The runs are not added to the ADS
+    TS_ASSERT(!ads.doesExist("__@loadsum_temp@"))
+
+    ads.remove("LoadTest_single");
+    ads.remove("LoadTest_sum");
+  }
+
   void test_EventPreNeXus_WithNoExecute() {
     Load loader;
     loader.initialize();
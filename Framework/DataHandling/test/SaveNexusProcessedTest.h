@@ -329,6 +329,30 @@ public:
         true /* DONT preserve events */, true /* Compress */);
   }
 
+  void testExec_EmptyEventWorkspace_CompressNexus() {
+    EventWorkspace_sptr ws =
+        WorkspaceCreationHelper::createEventWorkspace(3, 10, 0);
+    SaveNexusProcessed alg;
+    alg.initialize();
+    alg.setProperty("InputWorkspace",
+                    boost::dynamic_pointer_cast<Workspace>(ws));
+    alg.setPropertyValue("Filename", "SaveNexusProcessed_EmptyEvents.nxs");
+    const std::string outputFile = alg.getPropertyValue("Filename");
+    alg.setProperty("CompressNexus", true);
+    if (Poco::File(outputFile).exists())
+      Poco::File(outputFile).remove();
+    TS_ASSERT_THROWS_NOTHING(alg.execute())
+    TS_ASSERT(alg.isExecuted())
+
+    // The fields are created, empty
+    ::NeXus::File file(outputFile);
+    file.openPath("/mantid_workspace_1/event_workspace/tof");
+    TS_ASSERT_EQUALS(file.getInfo().dims.front(), 0)
+    file.close();
+    if (clearfiles)
+      Poco::File(outputFile).remove();
+  }
+
   void testExecSaveLabel() {
     SaveNexusProcessed alg;
     if (!alg.isInitialized())
@@ -0,0 +1,114 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_DATAOBJECTS_CONTIGUOUSWORKSPACE2D_H_
+#define MANTID_DATAOBJECTS_CONTIGUOUSWORKSPACE2D_H_
+
+#include "MantidDataObjects/Workspace2D.h"
+
+#include <atomic>
+#include <mutex>
+
+namespace Mantid {
+namespace DataObjects {
+
+/** ContiguousWorkspace2D
+
+  A Workspace2D that stores the Y and E data of all of its spectra in two
+  contiguous blocks, one row per spectrum, instead of allocating them for each
+  spectrum separately. As in a Workspace2D the X data is shared between the
+  spectra wherever possible.
+
+  Algorithms with a fast path for this storage read and write the rows
+  directly with rowY(), rowE(), mutableRowY() and mutableRowE(), and whole
+  workspace operations can use blockY() and blockE(). The data is also
+  available through the Histogram API of the spectra. A HistogramY cannot
+  refer to a row of a block, so the first access to the Y, E or Dx data of a
+  spectrum through that API copies its row out of the blocks, and the
+  spectrum is stored like that of a Workspace2D from then on. Its row in the
+  blocks is then unused, and the row accessors return the data where it is
+  stored now. Accessing the X data, or taking a copy with histogram(), leaves
+  the spectrum in the blocks.
+
+  All rows have the same length, which is given at initialization. The
+  workspace reports the id of a Workspace2D, so that it can be used wherever
+  a Workspace2D is expected.
+*/
+class DLLExport ContiguousWorkspace2D : public Workspace2D {
+public:
+  ContiguousWorkspace2D(
+      const Parallel::StorageMode storageMode = Parallel::StorageMode::Cloned);
+  ContiguousWorkspace2D &operator=(const ContiguousWorkspace2D &) = delete;
+  ~ContiguousWorkspace2D() override;
+
+  /// Returns a clone of the workspace
+  std::unique_ptr<ContiguousWorkspace2D> clone() const {
+    return std::unique_ptr<ContiguousWorkspace2D>(doClone());
+  }
+  /// Returns a default-initialized clone of the workspace
+  std::unique_ptr<ContiguousWorkspace2D> cloneEmpty() const {
+    return std::unique_ptr<ContiguousWorkspace2D>(doCloneEmpty());
+  }
+
+  /// The number of values in each row of the blocks
+  size_t rowLength() const { return m_rowLength; }
+  /// The Y values of a spectrum
+  const double *rowY(const size_t index) const;
+  /// The E values of a spectrum
+  const double *rowE(const size_t index) const;
+  /// The Y values of a spectrum, for writing
+  double *mutableRowY(const size_t index);
+  /// The E values of a spectrum, for writing
+  double *mutableRowE(const size_t index);
+
+  /// Whether the data of all spectra is still held in the blocks
+  bool allInBlocks() const { return m_copiedOut == 0; }
+  /// The Y values of all spectra, one row after the other. Only up to date
+  /// for the spectra still held in the blocks.
+  const std::vector<double> &blockY() const { return m_y; }
+  /// The E values of all spectra, one row after the other. Only up to date
+  /// for the spectra still held in the blocks.
+  const std::vector<double> &blockE() const { return m_e; }
+
+  class BlockHistogram1D;
+
+protected:
+  ContiguousWorkspace2D(const ContiguousWorkspace2D &other);
+
+  void init(const std::size_t &NVectors, const std::size_t &XLength,
+            const std::size_t &YLength) override;
+  void init(const HistogramData::Histogram &histogram) override;
+
+private:
+  ContiguousWorkspace2D *doClone() const override;
+  ContiguousWorkspace2D *doCloneEmpty() const override;
+
+  void initBlocks(const Histogram1D &spectrum);
+  const BlockHistogram1D &blockSpectrum(const size_t index) const;
+  BlockHistogram1D &blockSpectrum(const size_t index);
+
+  /// The number of values in each row
+  size_t m_rowLength{0};
+  /// The Y values, one row per spectrum
+  std::vector<double> m_y;
+  /// The E values, one row per spectrum
+  std::vector<double> m_e;
+  /// The number of spectra whose data has been copied out of the blocks
+  std::atomic<size_t> m_copiedOut{0};
+  /// Serialises copying spectra out of the blocks
+  mutable std::mutex m_mutex;
+};
+
+/// shared pointer to the ContiguousWorkspace2D class
+using ContiguousWorkspace2D_sptr = boost::shared_ptr<ContiguousWorkspace2D>;
+/// shared pointer to a const ContiguousWorkspace2D
+using ContiguousWorkspace2D_const_sptr =
+    boost::shared_ptr<const ContiguousWorkspace2D>;
+
+} // namespace DataObjects
+} // namespace Mantid
+
+#endif /* MANTID_DATAOBJECTS_CONTIGUOUSWORKSPACE2D_H_ */
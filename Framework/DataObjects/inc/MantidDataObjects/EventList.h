@@ -144,6 +144,22 @@ public:
   std::vector<WeightedEventNoTime> &getWeightedEventsNoTime();
   const std::vector<WeightedEventNoTime> &getWeightedEventsNoTime() const;
 
+  /**
+   * Where one field of the events of a list is stored. It does not keep the
+   * list alive, and any change to the list, including sorting, which const
+   * methods may do, moves the events. Use the views of EventWorkspace, which
+   * hold the workspace.
+   */
+  template <typename T> struct FieldView {
+    /// The field of the first event, null if the list is empty
+    const T *data;
+    /// The number of bytes between the fields of consecutive events. This is
+    /// 0 if the events do not store the field and data points to its default.
+    size_t stride;
+    /// The number of events
+    size_t size;
+  };
+
   void clear(const bool removeDetIDs = true) override;
   void clearUnused();
 
@@ -359,6 +375,15 @@ private:
   void copyDataInto(EventList &sink) const override;
   void copyDataInto(Histogram1D &sink) const override;
 
+  /// EventWorkspace provides views of the fields of the events that hold the
+  /// workspace
+  friend class EventWorkspace;
+  FieldView<double> tofView() const;
+  FieldView<float> weightView() const;
+  FieldView<float> errorSquaredView() const;
+  /// The pulse times as nanoseconds since the DateAndTime epoch
+  FieldView<int64_t> pulseTimeView() const;
+
   const HistogramData::Histogram &histogramRef() const override {
     return m_histogram;
   }
@@ -150,6 +150,32 @@ public:
   void sortAll(EventSortType sortType, Mantid::API::Progress *prog) const;
   void sortAllOld(EventSortType sortType, Mantid::API::Progress *prog) const;
 
+  /**
+   * A view of one field of the events of a spectrum, for reading without
+   * copying. It holds the workspace, so deleting or replacing the workspace
+   * does not free the events. Changing the events of the spectrum, for
+   * example by running an algorithm on the workspace in place, changes what
+   * the view shows.
+   */
+  template <typename T> struct EventFieldView {
+    /// The workspace that holds the events
+    boost::shared_ptr<const EventWorkspace> workspace;
+    /// Where the field is stored
+    EventList::FieldView<T> field;
+  };
+  static EventFieldView<double>
+  tofView(const boost::shared_ptr<const EventWorkspace> &workspace,
+          const size_t index);
+  static EventFieldView<float>
+  weightView(const boost::shared_ptr<const EventWorkspace> &workspace,
+             const size_t index);
+  static EventFieldView<float>
+  errorSquaredView(const boost::shared_ptr<const EventWorkspace> &workspace,
+                   const size_t index);
+  static EventFieldView<int64_t>
+  pulseTimeView(const boost::shared_ptr<const EventWorkspace> &workspace,
+                const size_t index);
+
   void getIntegratedSpectra(std::vector<double> &out, const double minX,
                             const double maxX,
                             const bool entireRange) const override;
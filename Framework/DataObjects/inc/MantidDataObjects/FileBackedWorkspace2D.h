@@ -0,0 +1,91 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_DATAOBJECTS_FILEBACKEDWORKSPACE2D_H_
+#define MANTID_DATAOBJECTS_FILEBACKEDWORKSPACE2D_H_
+
+#include "MantidDataObjects/Workspace2D.h"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+
+namespace Mantid {
+namespace DataObjects {
+
+/** FileBackedWorkspace2D
+
+  A Workspace2D whose Y, E and Dx data, and optionally whose experiment
+  information (instrument, sample and logs), are read from a NeXus processed
+  file the first time they are accessed.
+
+  The X data and the spectrum metadata (spectrum numbers, detector IDs and
+  masking) are set up by the loader and are always held in memory, and
+  reading them does not read anything else. The Y, E and Dx data of a
+  spectrum are read on the first access to any of them.
+
+  Without a residency budget the data read then stays in memory like that of
+  a Workspace2D. With a budget, the least recently used spectra that have
+  only been read ("clean" spectra) are dropped again once more than the
+  budget are in memory, and are read again on their next access. A spectrum
+  is never dropped while it is the one most recently accessed by some
+  thread, so a reference to its data stays valid until the thread holding it
+  accesses another spectrum of the workspace; keep a copy, or use sharedY(),
+  to hold on to the data of several spectra. A spectrum accessed through a
+  non-const accessor is kept in memory from then on, as it may hold
+  modifications.
+
+  Cloning the workspace gives an ordinary Workspace2D holding all the data.
+*/
+class DLLExport FileBackedWorkspace2D : public Workspace2D {
+public:
+  FileBackedWorkspace2D(const std::string &filename, const std::string &nxpath,
+                        const size_t maxResidentSpectra = 0);
+  FileBackedWorkspace2D &operator=(const FileBackedWorkspace2D &) = delete;
+  ~FileBackedWorkspace2D() override;
+
+  /// Read the data of the spectra from the file on first access
+  void loadSpectraOnAccess(const std::vector<size_t> &fileIndices);
+  /// Read the experiment information from the file on first access
+  void loadExperimentInfoOnAccess();
+
+  /// The number of spectra whose data is currently in memory
+  size_t residentSpectra() const;
+  /// The maximum number of clean spectra held in memory, 0 if unlimited
+  size_t maxResidentSpectra() const { return m_maxResidentSpectra; }
+  /// The file the data is read from
+  const std::string &filename() const { return m_filename; }
+  /// Read everything still in the file into memory and close the file
+  void loadAll() const;
+
+  class Backing;
+
+protected:
+  void populateIfNotLoaded() const override;
+
+private:
+  FileBackedWorkspace2D(const FileBackedWorkspace2D &) = delete;
+
+  const std::string m_filename;
+  const std::string m_nxpath;
+  const size_t m_maxResidentSpectra;
+  /// Reads the spectra and keeps track of the ones in memory
+  std::unique_ptr<Backing> m_backing;
+
+  /// Whether the experiment information still needs to be read
+  mutable std::atomic<bool> m_experimentInfoPending{false};
+  /// Set while the experiment information is read, to stop recursion
+  mutable bool m_experimentInfoLoading{false};
+  mutable std::recursive_mutex m_experimentInfoMutex;
+};
+
+/// shared pointer to the FileBackedWorkspace2D class
+using FileBackedWorkspace2D_sptr = boost::shared_ptr<FileBackedWorkspace2D>;
+
+} // namespace DataObjects
+} // namespace Mantid
+
+#endif /* MANTID_DATAOBJECTS_FILEBACKEDWORKSPACE2D_H_ */
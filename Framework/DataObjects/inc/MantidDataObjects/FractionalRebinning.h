@@ -34,6 +34,52 @@ namespace DataObjects {
 
 namespace FractionalRebinning {
 
+/**
+ * Sums of the signal, variance and, for a fractional rebin, fractional weight
+ * of the bins of an output grid, held by one thread. Each thread of a parallel
+ * rebin fills its own sums without locking and the sums are added to the
+ * output workspace at the end, see addToOutput().
+ */
+class MANTID_DATAOBJECTS_DLL PartialSums {
+public:
+  PartialSums(const size_t numberHistograms, const size_t numberBins,
+              const bool fractional)
+      : m_numberBins(numberBins),
+        m_signal(numberHistograms * numberBins, 0.),
+        m_variance(numberHistograms * numberBins, 0.),
+        m_weight(fractional ? numberHistograms * numberBins : 0, 0.) {}
+
+  /// Add a contribution to a bin of the grid
+  void add(const size_t wsIndex, const size_t binIndex, const double signal,
+           const double variance, const double weight) {
+    const size_t index = wsIndex * m_numberBins + binIndex;
+    m_signal[index] += signal;
+    m_variance[index] += variance;
+    if (!m_weight.empty())
+      m_weight[index] += weight;
+  }
+
+  size_t numberBins() const { return m_numberBins; }
+  /// The sums of the signal, stored row by row
+  const std::vector<double> &signal() const { return m_signal; }
+  /// The sums of the variance, stored row by row
+  const std::vector<double> &variance() const { return m_variance; }
+  /// The sums of the fractional weight, stored row by row. Empty unless the
+  /// rebin is fractional.
+  const std::vector<double> &weight() const { return m_weight; }
+
+private:
+  size_t m_numberBins;
+  std::vector<double> m_signal;
+  std::vector<double> m_variance;
+  std::vector<double> m_weight;
+};
+
+/// The number of threads that may each hold the PartialSums of an output grid
+MANTID_DATAOBJECTS_DLL int
+numberOfPartialSums(const API::MatrixWorkspace &outputWS,
+                    const bool fractional);
+
 /// Find the intersect region on the output grid
 MANTID_DATAOBJECTS_DLL bool
 getIntersectionRegion(const std::vector<double> &xAxis,
@@ -62,6 +108,26 @@ MANTID_DATAOBJECTS_DLL void rebinToFractionalOutput(
     const std::vector<double> &verticalAxis,
     const DataObjects::RebinnedOutput_const_sptr &inputRB = nullptr);
 
+/// Rebin the input quadrilateral to the partial sums of one thread
+MANTID_DATAOBJECTS_DLL void
+rebinToOutput(const Geometry::Quadrilateral &inputQ,
+              const API::MatrixWorkspace_const_sptr &inputWS, const size_t i,
+              const size_t j, PartialSums &sums,
+              const std::vector<double> &xAxis,
+              const std::vector<double> &verticalAxis);
+
+/// Rebin the input quadrilateral to the partial sums of one thread
+MANTID_DATAOBJECTS_DLL void rebinToFractionalOutput(
+    const Geometry::Quadrilateral &inputQ,
+    const API::MatrixWorkspace_const_sptr &inputWS, const size_t i,
+    const size_t j, PartialSums &sums, const std::vector<double> &xAxis,
+    const std::vector<double> &verticalAxis,
+    const DataObjects::RebinnedOutput_const_sptr &inputRB = nullptr);
+
+/// Add the partial sums of all threads to the output workspace
+MANTID_DATAOBJECTS_DLL void addToOutput(const std::vector<PartialSums> &sums,
+                                        API::MatrixWorkspace &outputWS);
+
 } // namespace FractionalRebinning
 
 } // namespace DataObjects
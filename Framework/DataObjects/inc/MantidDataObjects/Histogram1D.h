@@ -25,11 +25,11 @@ public:
   Histogram1D(HistogramData::Histogram::XMode xmode,
               HistogramData::Histogram::YMode ymode);
 
-  Histogram1D(const Histogram1D &) = default;
+  Histogram1D(const Histogram1D &other);
   Histogram1D(Histogram1D &&) = default;
   Histogram1D(const ISpectrum &other);
 
-  Histogram1D &operator=(const Histogram1D &) = default;
+  Histogram1D &operator=(const Histogram1D &rhs);
   Histogram1D &operator=(Histogram1D &&) = default;
   Histogram1D &operator=(const ISpectrum &rhs);
 
@@ -49,14 +49,14 @@ public:
   void clearData() override;
 
   /// Deprecated, use y() instead. Returns the y data const
-  const MantidVec &dataY() const override { return m_histogram.dataY(); }
+  const MantidVec &dataY() const override { return histogramRef().dataY(); }
   /// Deprecated, use e() instead. Returns the error data const
-  const MantidVec &dataE() const override { return m_histogram.dataE(); }
+  const MantidVec &dataE() const override { return histogramRef().dataE(); }
 
   /// Deprecated, use mutableY() instead. Returns the y data
-  MantidVec &dataY() override { return m_histogram.dataY(); }
+  MantidVec &dataY() override { return mutableHistogramRef().dataY(); }
   /// Deprecated, use mutableE() instead. Returns the error data
-  MantidVec &dataE() override { return m_histogram.dataE(); }
+  MantidVec &dataE() override { return mutableHistogramRef().dataE(); }
 
   virtual std::size_t size() const {
     return m_histogram.readY().size();
@@ -71,17 +71,24 @@ public:
             sizeof(double));
   }
 
-private:
-  using ISpectrum::copyDataInto;
-  void copyDataInto(Histogram1D &sink) const override;
+protected:
+  Histogram1D(const ISpectrum &other,
+              const HistogramData::Histogram &histogram);
 
-  void checkAndSanitizeHistogram(HistogramData::Histogram &histogram) override;
+  /// All access to the data goes through these two methods, so that
+  /// subclasses can provide the data on demand.
   const HistogramData::Histogram &histogramRef() const override {
     return m_histogram;
   }
   HistogramData::Histogram &mutableHistogramRef() override {
     return m_histogram;
   }
+
+private:
+  using ISpectrum::copyDataInto;
+  void copyDataInto(Histogram1D &sink) const override;
+
+  void checkAndSanitizeHistogram(HistogramData::Histogram &histogram) override;
 };
 
 } // namespace DataObjects
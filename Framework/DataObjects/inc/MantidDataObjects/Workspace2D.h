@@ -86,6 +86,7 @@ public:
 protected:
   /// Protected copy constructor. May be used by childs for cloning.
   Workspace2D(const Workspace2D &other);
+  Workspace2D(const Workspace2D &other, const bool copySpectra);
 
   /// Called by initialize()
   void init(const std::size_t &NVectors, const std::size_t &XLength,
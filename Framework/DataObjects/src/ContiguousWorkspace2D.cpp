@@ -0,0 +1,313 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidDataObjects/ContiguousWorkspace2D.h"
+#include "MantidAPI/RefAxis.h"
+#include "MantidAPI/SpectraAxis.h"
+#include "MantidAPI/WorkspaceFactory.h"
+#include "MantidHistogramData/LinearGenerator.h"
+
+#include <algorithm>
+
+namespace Mantid {
+namespace DataObjects {
+
+DECLARE_WORKSPACE(ContiguousWorkspace2D)
+
+namespace {
+/// The values of a HistogramY or HistogramE, for writing
+template <class T> double *mutableValues(T &values) {
+  return values.empty() ? nullptr : &values[0];
+}
+} // namespace
+
+/**
+ * A Histogram1D whose Y and E data are held in a row of the blocks of a
+ * ContiguousWorkspace2D, until they are accessed through the Histogram API.
+ * Its own Y and E data until then are shared placeholders of the length of a
+ * row.
+ */
+class ContiguousWorkspace2D::BlockHistogram1D : public Histogram1D {
+public:
+  /// Construct a spectrum with the metadata and X data of spectrum, whose Y
+  /// and E data are in the given row of the blocks of workspace
+  BlockHistogram1D(const Histogram1D &spectrum,
+                   ContiguousWorkspace2D &workspace, const size_t row)
+      : Histogram1D(spectrum), m_workspace(workspace), m_row(row) {}
+  /// Copy other, a spectrum of another workspace, without copying its data
+  /// out of the blocks
+  BlockHistogram1D(const BlockHistogram1D &other,
+                   ContiguousWorkspace2D &workspace)
+      : Histogram1D(other, other.storage()), m_workspace(workspace),
+        m_row(other.m_row), m_copiedOut(other.m_copiedOut.load()) {}
+  BlockHistogram1D(const BlockHistogram1D &) = delete;
+  BlockHistogram1D &operator=(const BlockHistogram1D &) = delete;
+
+  HistogramData::Histogram histogram() const override;
+  void clearData() override;
+
+  /// Gets the memory size of the data not held in the blocks
+  size_t getMemorySize() const override {
+    const auto &histogram = storage();
+    size_t size = histogram.x().size();
+    if (m_copiedOut)
+      size += histogram.y().size() + histogram.e().size();
+    return size * sizeof(double);
+  }
+
+  const double *rowY() const {
+    return m_copiedOut.load(std::memory_order_acquire)
+               ? storage().y().rawData().data()
+               : blockRow(m_workspace.m_y);
+  }
+  const double *rowE() const {
+    return m_copiedOut.load(std::memory_order_acquire)
+               ? storage().e().rawData().data()
+               : blockRow(m_workspace.m_e);
+  }
+  double *mutableRowY() {
+    return m_copiedOut.load(std::memory_order_acquire)
+               ? mutableValues(Histogram1D::mutableHistogramRef().mutableY())
+               : blockRow(m_workspace.m_y);
+  }
+  double *mutableRowE() {
+    return m_copiedOut.load(std::memory_order_acquire)
+               ? mutableValues(Histogram1D::mutableHistogramRef().mutableE())
+               : blockRow(m_workspace.m_e);
+  }
+
+protected:
+  const HistogramData::Histogram &histogramRef() const override {
+    copyOut();
+    return storage();
+  }
+  HistogramData::Histogram &mutableHistogramRef() override {
+    copyOut();
+    return Histogram1D::mutableHistogramRef();
+  }
+  const HistogramData::Histogram &histogramXRef() const override {
+    return storage();
+  }
+  HistogramData::Histogram &mutableHistogramXRef() override {
+    return Histogram1D::mutableHistogramRef();
+  }
+
+private:
+  void copyDataInto(Histogram1D &sink) const override {
+    sink.setHistogram(histogram());
+  }
+
+  /// The data as held by the spectrum, without copying it out of the blocks
+  const HistogramData::Histogram &storage() const {
+    return Histogram1D::histogramRef();
+  }
+  double *blockRow(std::vector<double> &block) const {
+    return block.data() + m_row * m_workspace.m_rowLength;
+  }
+  void copyOut() const;
+
+  ContiguousWorkspace2D &m_workspace;
+  const size_t m_row;
+  /// Set once the data has been copied out of the blocks
+  mutable std::atomic<bool> m_copiedOut{false};
+};
+
+/// Copy the Y and E data of the spectrum out of the blocks into its own
+/// storage, if this has not been done
+void ContiguousWorkspace2D::BlockHistogram1D::copyOut() const {
+  if (m_copiedOut.load(std::memory_order_acquire))
+    return;
+  std::lock_guard<std::mutex> lock(m_workspace.m_mutex);
+  if (m_copiedOut)
+    return;
+  auto &histogram =
+      const_cast<BlockHistogram1D &>(*this).Histogram1D::mutableHistogramRef();
+  const double *y = blockRow(m_workspace.m_y);
+  const double *e = blockRow(m_workspace.m_e);
+  const size_t length = m_workspace.m_rowLength;
+  histogram.setSharedY(
+      Kernel::make_cow<HistogramData::HistogramY>(y, y + length));
+  histogram.setSharedE(
+      Kernel::make_cow<HistogramData::HistogramE>(e, e + length));
+  ++m_workspace.m_copiedOut;
+  m_copiedOut.store(true, std::memory_order_release);
+}
+
+/// Returns a copy of the histogram. Does not copy the data of the spectrum
+/// out of the blocks.
+HistogramData::Histogram
+ContiguousWorkspace2D::BlockHistogram1D::histogram() const {
+  if (m_copiedOut.load(std::memory_order_acquire))
+    return storage();
+  HistogramData::Histogram histogram(storage());
+  const double *y = rowY();
+  const double *e = rowE();
+  const size_t length = m_workspace.m_rowLength;
+  histogram.setSharedY(
+      Kernel::make_cow<HistogramData::HistogramY>(y, y + length));
+  histogram.setSharedE(
+      Kernel::make_cow<HistogramData::HistogramE>(e, e + length));
+  return histogram;
+}
+
+/// Zero the Y and E data
+void ContiguousWorkspace2D::BlockHistogram1D::clearData() {
+  if (m_copiedOut.load(std::memory_order_acquire)) {
+    Histogram1D::clearData();
+    return;
+  }
+  std::fill_n(mutableRowY(), m_workspace.m_rowLength, 0.0);
+  std::fill_n(mutableRowE(), m_workspace.m_rowLength, 0.0);
+}
+
+/// Constructor
+ContiguousWorkspace2D::ContiguousWorkspace2D(
+    const Parallel::StorageMode storageMode)
+    : Workspace2D(storageMode) {}
+
+/// Copy constructor. The blocks are copied, and the spectra of other are
+/// copied without copying their data out of the blocks.
+ContiguousWorkspace2D::ContiguousWorkspace2D(
+    const ContiguousWorkspace2D &other)
+    : Workspace2D(other, false), m_rowLength(other.m_rowLength),
+      m_y(other.m_y), m_e(other.m_e), m_copiedOut(other.m_copiedOut.load()) {
+  for (size_t i = 0; i < data.size(); ++i) {
+    data[i] = std::make_unique<BlockHistogram1D>(other.blockSpectrum(i), *this);
+  }
+}
+
+/// Destructor
+ContiguousWorkspace2D::~ContiguousWorkspace2D() = default;
+
+/**
+ * Sets the size of the workspace and initializes the blocks to zero
+ * @param NVectors :: The number of spectra
+ * @param XLength :: The number of X data points/bin boundaries of each spectrum
+ * @param YLength :: The number of data/error points of each spectrum
+ */
+void ContiguousWorkspace2D::init(const std::size_t &NVectors,
+                                 const std::size_t &XLength,
+                                 const std::size_t &YLength) {
+  data.resize(NVectors);
+
+  auto x = Kernel::make_cow<HistogramData::HistogramX>(
+      XLength, HistogramData::LinearGenerator(1.0, 1.0));
+  HistogramData::Counts y(YLength);
+  HistogramData::CountStandardDeviations e(YLength);
+  Histogram1D spec(HistogramData::getHistogramXMode(XLength, YLength),
+                   HistogramData::Histogram::YMode::Counts);
+  spec.setX(x);
+  spec.setCounts(y);
+  spec.setCountStandardDeviations(e);
+  initBlocks(spec);
+  for (size_t i = 0; i < data.size(); i++) {
+    // Default spectrum number = starts at 1, for workspace index 0.
+    data[i]->setSpectrumNo(specnum_t(i + 1));
+  }
+
+  // Add axes that reference the data
+  m_axes.resize(2);
+  m_axes[0] = std::make_unique<API::RefAxis>(this);
+  m_axes[1] = std::make_unique<API::SpectraAxis>(this);
+}
+
+/**
+ * Sets the size of the workspace, and fills every row of the blocks with the
+ * Y and E data of histogram, or zeros if it has none.
+ * @param histogram :: The X data and length of every spectrum
+ */
+void ContiguousWorkspace2D::init(const HistogramData::Histogram &histogram) {
+  data.resize(numberOfDetectorGroups());
+
+  HistogramData::Histogram initializedHistogram(histogram);
+  if (!histogram.sharedY()) {
+    if (histogram.yMode() == HistogramData::Histogram::YMode::Frequencies) {
+      initializedHistogram.setFrequencies(histogram.size(), 0.0);
+      initializedHistogram.setFrequencyStandardDeviations(histogram.size(),
+                                                          0.0);
+    } else { // YMode::Counts or YMode::Uninitialized -> default to Counts
+      initializedHistogram.setCounts(histogram.size(), 0.0);
+      initializedHistogram.setCountStandardDeviations(histogram.size(), 0.0);
+    }
+  }
+
+  Histogram1D spec(initializedHistogram.xMode(), initializedHistogram.yMode());
+  spec.setHistogram(initializedHistogram);
+  initBlocks(spec);
+
+  // Add axes that reference the data
+  m_axes.resize(2);
+  m_axes[0] = std::make_unique<API::RefAxis>(this);
+  m_axes[1] = std::make_unique<API::SpectraAxis>(this);
+}
+
+/**
+ * Fill every row of the blocks with the Y and E data of spectrum, and create
+ * a spectrum for each row with the X data of spectrum. data must be sized.
+ * @param spectrum :: The spectrum to copy
+ */
+void ContiguousWorkspace2D::initBlocks(const Histogram1D &spectrum) {
+  const auto &y = spectrum.y();
+  const auto &e = spectrum.e();
+  m_rowLength = y.size();
+  m_copiedOut = 0;
+  m_y.clear();
+  m_e.clear();
+  m_y.reserve(data.size() * m_rowLength);
+  m_e.reserve(data.size() * m_rowLength);
+  for (size_t i = 0; i < data.size(); ++i) {
+    m_y.insert(m_y.end(), y.cbegin(), y.cend());
+    m_e.insert(m_e.end(), e.cbegin(), e.cend());
+  }
+  for (size_t i = 0; i < data.size(); ++i) {
+    data[i] = std::make_unique<BlockHistogram1D>(spectrum, *this, i);
+  }
+}
+
+const ContiguousWorkspace2D::BlockHistogram1D &
+ContiguousWorkspace2D::blockSpectrum(const size_t index) const {
+  return static_cast<const BlockHistogram1D &>(*data[index]);
+}
+
+ContiguousWorkspace2D::BlockHistogram1D &
+ContiguousWorkspace2D::blockSpectrum(const size_t index) {
+  return static_cast<BlockHistogram1D &>(*data[index]);
+}
+
+/// @param index :: The workspace index
+/// @return The Y values of the spectrum, which may be in the blocks
+const double *ContiguousWorkspace2D::rowY(const size_t index) const {
+  return blockSpectrum(index).rowY();
+}
+
+/// @param index :: The workspace index
+/// @return The E values of the spectrum, which may be in the blocks
+const double *ContiguousWorkspace2D::rowE(const size_t index) const {
+  return blockSpectrum(index).rowE();
+}
+
+/// @param index :: The workspace index
+/// @return The Y values of the spectrum, which may be in the blocks
+double *ContiguousWorkspace2D::mutableRowY(const size_t index) {
+  return blockSpectrum(index).mutableRowY();
+}
+
+/// @param index :: The workspace index
+/// @return The E values of the spectrum, which may be in the blocks
+double *ContiguousWorkspace2D::mutableRowE(const size_t index) {
+  return blockSpectrum(index).mutableRowE();
+}
+
+ContiguousWorkspace2D *ContiguousWorkspace2D::doClone() const {
+  return new ContiguousWorkspace2D(*this);
+}
+
+ContiguousWorkspace2D *ContiguousWorkspace2D::doCloneEmpty() const {
+  return new ContiguousWorkspace2D(storageMode());
+}
+
+} // namespace DataObjects
+} // namespace Mantid
@@ -23,6 +23,7 @@
 #pragma warning(default : 4180)
 #endif
 
+#include <algorithm>
 #include <cfloat>
 #include <cmath>
 #include <functional>
@@ -91,6 +92,21 @@ public:
     return (tAtSample1 < tAtSample2);
   }
 };
+
+/**
+ * Make room for appending events to a vector. Reserving exactly the size
+ * needed on every append would reallocate each time, so the capacity grows
+ * geometrically and repeated appends, e.g. when summing many runs, take
+ * linear time.
+ * @param events :: The vector to append to
+ * @param num :: The number of events that will be appended
+ */
+template <typename EventType>
+void reserveForAppend(std::vector<EventType> &events, const size_t num) {
+  const size_t required = events.size() + num;
+  if (required > events.capacity())
+    events.reserve(std::max(required, 2 * events.capacity()));
+}
 } // namespace
 //==========================================================================
 /// --------------------- TofEvent Comparators
@@ -389,8 +405,7 @@ EventList &EventList::operator+=(const std::vector<TofEvent> &more_events) {
   case WEIGHTED:
     // Add default weights to all the un-weighted incoming events from the list.
     // and append to the list
-    this->weightedEvents.reserve(this->weightedEvents.size() +
-                                 more_events.size());
+    reserveForAppend(this->weightedEvents, more_events.size());
     for (const auto &event : more_events) {
       this->weightedEvents.emplace_back(event);
     }
@@ -399,8 +414,7 @@ EventList &EventList::operator+=(const std::vector<TofEvent> &more_events) {
   case WEIGHTED_NOTIME:
     // Add default weights to all the un-weighted incoming events from the list.
     // and append to the list
-    this->weightedEventsNoTime.reserve(this->weightedEventsNoTime.size() +
-                                       more_events.size());
+    reserveForAppend(this->weightedEventsNoTime, more_events.size());
     for (const auto &more_event : more_events)
       this->weightedEventsNoTime.emplace_back(more_event);
     break;
@@ -450,8 +464,7 @@ operator+=(const std::vector<WeightedEvent> &more_events) {
   case WEIGHTED_NOTIME:
     // Add default weights to all the un-weighted incoming events from the list.
     // and append to the list
-    this->weightedEventsNoTime.reserve(this->weightedEventsNoTime.size() +
-                                       more_events.size());
+    reserveForAppend(this->weightedEventsNoTime, more_events.size());
     for (const auto &event : more_events) {
       this->weightedEventsNoTime.emplace_back(event);
     }
@@ -537,7 +550,7 @@ template <class T1, class T2>
 void EventList::minusHelper(std::vector<T1> &events,
                             const std::vector<T2> &more_events) {
   // Make the end vector big enough in one go (avoids repeated re-allocations).
-  events.reserve(events.size() + more_events.size());
+  reserveForAppend(events, more_events.size());
   /* In the event of subtracting in place, calling the end() vector would make
    * it point at the wrong place
    * Using it caused a segault, Ticket #2306.
@@ -934,16 +947,27 @@ void EventList::clearData() { this->clear(false); }
  */
 void EventList::setMRU(EventWorkspaceMRU *newMRU) { mru = newMRU; }
 
-/** Reserve a certain number of entries in the (NOT-WEIGHTED) event list. Do NOT
- *call
- * on weighted events!
+/** Reserve a certain number of entries in the event list, in the vector of
+ * its current event type.
  *
  * Calls std::vector<>::reserve() in order to pre-allocate the length of the
  *event list vector.
  *
  * @param num :: number of events that will be in this EventList
  */
-void EventList::reserve(size_t num) { this->events.reserve(num); }
+void EventList::reserve(size_t num) {
+  switch (this->eventType) {
+  case TOF:
+    this->events.reserve(num);
+    break;
+  case WEIGHTED:
+    this->weightedEvents.reserve(num);
+    break;
+  case WEIGHTED_NOTIME:
+    this->weightedEventsNoTime.reserve(num);
+    break;
+  }
+}
 
 // ==============================================================================================
 // --- Sorting functions -----------------------------------------------------
@@ -2988,6 +3012,102 @@ std::vector<Mantid::Types::Core::DateAndTime> EventList::getPulseTimes() const {
   return times;
 }
 
+namespace {
+/// The weight and squared error of events that do not store them
+const float UNIT_WEIGHT = 1.f;
+/// The pulse time of events that do not store it
+const int64_t NO_PULSE_TIME = 0;
+
+/**
+ * Describe where a field of every event of a vector is stored
+ * @param events :: The events of a list
+ * @param field :: Returns a pointer to the field of a given event
+ */
+template <typename T, typename Event, typename Field>
+EventList::FieldView<T> makeFieldView(const std::vector<Event> &events,
+                                      Field field) {
+  if (events.empty())
+    return {nullptr, sizeof(Event), 0};
+  return {field(events.front()), sizeof(Event), events.size()};
+}
+} // namespace
+
+/**
+ * @return The storage of the time of flight of the events
+ */
+EventList::FieldView<double> EventList::tofView() const {
+  switch (eventType) {
+  case WEIGHTED:
+    return makeFieldView<double>(
+        weightedEvents, [](const WeightedEvent &e) { return &e.m_tof; });
+  case WEIGHTED_NOTIME:
+    return makeFieldView<double>(
+        weightedEventsNoTime,
+        [](const WeightedEventNoTime &e) { return &e.m_tof; });
+  default:
+    return makeFieldView<double>(events,
+                                 [](const TofEvent &e) { return &e.m_tof; });
+  }
+}
+
+/**
+ * @return The storage of the weight of the events. Unweighted events all
+ * share a weight of 1.
+ */
+EventList::FieldView<float> EventList::weightView() const {
+  switch (eventType) {
+  case WEIGHTED:
+    return makeFieldView<float>(
+        weightedEvents, [](const WeightedEvent &e) { return &e.m_weight; });
+  case WEIGHTED_NOTIME:
+    return makeFieldView<float>(
+        weightedEventsNoTime,
+        [](const WeightedEventNoTime &e) { return &e.m_weight; });
+  default:
+    return {&UNIT_WEIGHT, 0, events.size()};
+  }
+}
+
+/**
+ * @return The storage of the squared error of the weight of the events.
+ * Unweighted events all share a squared error of 1.
+ */
+EventList::FieldView<float> EventList::errorSquaredView() const {
+  switch (eventType) {
+  case WEIGHTED:
+    return makeFieldView<float>(
+        weightedEvents,
+        [](const WeightedEvent &e) { return &e.m_errorSquared; });
+  case WEIGHTED_NOTIME:
+    return makeFieldView<float>(
+        weightedEventsNoTime,
+        [](const WeightedEventNoTime &e) { return &e.m_errorSquared; });
+  default:
+    return {&UNIT_WEIGHT, 0, events.size()};
+  }
+}
+
+/**
+ * @return The storage of the pulse time of the events, in nanoseconds since
+ * the DateAndTime epoch. Events without a pulse time all share a time of 0.
+ */
+EventList::FieldView<int64_t> EventList::pulseTimeView() const {
+  static_assert(sizeof(DateAndTime) == sizeof(int64_t),
+                "DateAndTime must hold only its nanoseconds");
+  switch (eventType) {
+  case TOF:
+    return makeFieldView<int64_t>(events, [](const TofEvent &e) {
+      return reinterpret_cast<const int64_t *>(&e.m_pulsetime);
+    });
+  case WEIGHTED:
+    return makeFieldView<int64_t>(weightedEvents, [](const WeightedEvent &e) {
+      return reinterpret_cast<const int64_t *>(&e.m_pulsetime);
+    });
+  default:
+    return {&NO_PULSE_TIME, 0, weightedEventsNoTime.size()};
+  }
+}
+
 // --------------------------------------------------------------------------
 /**
  * @return The minimum tof value for the list of the events.
@@ -683,6 +683,54 @@ void EventWorkspace::sortAll(EventSortType sortType,
   tbb::parallel_for(tbb::blocked_range<size_t>(0, data.size()), task);
 }
 
+/**
+ * @param workspace :: The workspace holding the events
+ * @param index :: The workspace index of the spectrum
+ * @return A view of the time of flight of the events of the spectrum
+ */
+EventWorkspace::EventFieldView<double>
+EventWorkspace::tofView(const EventWorkspace_const_sptr &workspace,
+                        const size_t index) {
+  return {workspace, workspace->getSpectrum(index).tofView()};
+}
+
+/**
+ * @param workspace :: The workspace holding the events
+ * @param index :: The workspace index of the spectrum
+ * @return A view of the weight of the events of the spectrum. Unweighted
+ * events all share a weight of 1.
+ */
+EventWorkspace::EventFieldView<float>
+EventWorkspace::weightView(const EventWorkspace_const_sptr &workspace,
+                           const size_t index) {
+  return {workspace, workspace->getSpectrum(index).weightView()};
+}
+
+/**
+ * @param workspace :: The workspace holding the events
+ * @param index :: The workspace index of the spectrum
+ * @return A view of the squared error of the weight of the events of the
+ * spectrum. Unweighted events all share a squared error of 1.
+ */
+EventWorkspace::EventFieldView<float>
+EventWorkspace::errorSquaredView(const EventWorkspace_const_sptr &workspace,
+                                 const size_t index) {
+  return {workspace, workspace->getSpectrum(index).errorSquaredView()};
+}
+
+/**
+ * @param workspace :: The workspace holding the events
+ * @param index :: The workspace index of the spectrum
+ * @return A view of the pulse time of the events of the spectrum, in
+ * nanoseconds since the DateAndTime epoch. Events without a pulse time all
+ * share a time of 0.
+ */
+EventWorkspace::EventFieldView<int64_t>
+EventWorkspace::pulseTimeView(const EventWorkspace_const_sptr &workspace,
+                              const size_t index) {
+  return {workspace, workspace->getSpectrum(index).pulseTimeView()};
+}
+
 /** Integrate all the spectra in the matrix workspace within the range given.
  * Default implementation, can be overridden by base classes if they know
  *something smarter!
@@ -0,0 +1,392 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidDataObjects/FileBackedWorkspace2D.h"
+#include "MantidKernel/Logger.h"
+
+#include <list>
+#include <sstream>
+#include <thread>
+#include <unordered_map>
+
+// clang-format off
+#include <nexus/NeXusFile.hpp>
+#include <nexus/NeXusException.hpp>
+// clang-format on
+
+namespace Mantid {
+namespace DataObjects {
+
+namespace {
+/// static logger object
+Kernel::Logger g_log("FileBackedWorkspace2D");
+/// HDF5 is not thread safe, so the reads of all workspaces are serialised.
+/// Reading the experiment information may access the workspace again.
+std::recursive_mutex g_fileMutex;
+} // namespace
+
+/**
+ * Reads the data of the spectra of a FileBackedWorkspace2D and keeps track of
+ * the spectra held in memory. The clean spectra are kept in a list ordered
+ * from the most to the least recently used, and the spectrum last accessed by
+ * each thread is recorded so that it is not dropped.
+ */
+class FileBackedWorkspace2D::Backing {
+public:
+  class LazyHistogram1D;
+
+  Backing(const std::string &filename, const std::string &nxpath,
+          const size_t maxResident)
+      : m_filename(filename), m_nxpath(nxpath), m_maxResident(maxResident) {}
+
+  /// Set the Y and E data that stand in for the data of unread spectra
+  void setPlaceholders(const Histogram1D &spectrum) {
+    m_placeholderY = spectrum.sharedY();
+    m_placeholderE = spectrum.sharedE();
+  }
+  void access(LazyHistogram1D &spectrum, const bool pin);
+  void forget(LazyHistogram1D &spectrum);
+  void closeFile();
+  size_t resident() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_resident;
+  }
+
+private:
+  void read(LazyHistogram1D &spectrum);
+  void useInThisThread(LazyHistogram1D &spectrum);
+  void evictLeastRecentlyUsed();
+  void evict(LazyHistogram1D &spectrum);
+  void openFields();
+
+  const std::string m_filename;
+  const std::string m_nxpath;
+  const size_t m_maxResident;
+  /// One handle per field, each with its dataset kept open
+  std::unique_ptr<::NeXus::File> m_values;
+  std::unique_ptr<::NeXus::File> m_errors;
+  std::unique_ptr<::NeXus::File> m_xErrors;
+  Kernel::cow_ptr<HistogramData::HistogramY> m_placeholderY{nullptr};
+  Kernel::cow_ptr<HistogramData::HistogramE> m_placeholderE{nullptr};
+  /// The clean spectra in memory, the most recently used first
+  std::list<LazyHistogram1D *> m_clean;
+  /// The spectrum last accessed by each thread
+  std::unordered_map<std::thread::id, LazyHistogram1D *> m_lastAccessed;
+  size_t m_resident{0};
+  mutable std::mutex m_mutex;
+};
+
+/**
+ * A Histogram1D whose Y, E and Dx data are read by the backing when any of
+ * them is accessed. Access to the X data alone does not read anything.
+ */
+class FileBackedWorkspace2D::Backing::LazyHistogram1D : public Histogram1D {
+public:
+  LazyHistogram1D(const Histogram1D &spectrum, Backing &backing,
+                  const size_t fileIndex)
+      : Histogram1D(spectrum), m_backing(backing), m_fileIndex(fileIndex) {}
+  LazyHistogram1D(const LazyHistogram1D &) = delete;
+  LazyHistogram1D &operator=(const LazyHistogram1D &) = delete;
+  ~LazyHistogram1D() override { m_backing.forget(*this); }
+
+  /// Gets the memory size of the data currently held in memory
+  size_t getMemorySize() const override {
+    const auto &histogram = Histogram1D::histogramRef();
+    size_t size = histogram.x().size();
+    if (m_resident)
+      size += histogram.y().size() + histogram.e().size() +
+              (histogram.sharedDx() ? histogram.dx().size() : 0);
+    return size * sizeof(double);
+  }
+
+protected:
+  const HistogramData::Histogram &histogramRef() const override {
+    m_backing.access(const_cast<LazyHistogram1D &>(*this), false);
+    return Histogram1D::histogramRef();
+  }
+  const HistogramData::Histogram &histogramXRef() const override {
+    return Histogram1D::histogramRef();
+  }
+  HistogramData::Histogram &mutableHistogramRef() override {
+    m_backing.access(*this, true);
+    return Histogram1D::mutableHistogramRef();
+  }
+
+private:
+  friend class Backing;
+  /// The data as held in memory, without reading it
+  HistogramData::Histogram &storage() {
+    return Histogram1D::mutableHistogramRef();
+  }
+
+  Backing &m_backing;
+  const size_t m_fileIndex;
+  /// Set once the data has been read, reset when it is evicted
+  std::atomic<bool> m_resident{false};
+  /// Set once the data may have been modified, so it must stay in memory
+  std::atomic<bool> m_pinned{false};
+  /// The number of threads whose last accessed spectrum this is
+  size_t m_users{0};
+  /// The position in the list of clean spectra, if resident and not pinned
+  std::list<LazyHistogram1D *>::iterator m_position;
+};
+
+/**
+ * Make sure the data of a spectrum is in memory, reading it if necessary.
+ * @param spectrum :: The spectrum being accessed
+ * @param pin :: If true the spectrum is kept in memory from now on
+ */
+void FileBackedWorkspace2D::Backing::access(LazyHistogram1D &spectrum,
+                                            const bool pin) {
+  // Without a budget nothing is ever dropped, and neither is a pinned
+  // spectrum, so once read these are used without locking
+  if (m_maxResident == 0 || spectrum.m_pinned.load(std::memory_order_acquire)) {
+    if (spectrum.m_resident.load(std::memory_order_acquire))
+      return;
+  }
+  // The file is locked first, as reading the experiment information does, and
+  // only if the data has to be read
+  std::unique_lock<std::recursive_mutex> fileLock(g_fileMutex,
+                                                  std::defer_lock);
+  std::unique_lock<std::mutex> lock(m_mutex);
+  if (!spectrum.m_resident) {
+    lock.unlock();
+    fileLock.lock();
+    lock.lock();
+  }
+  if (!spectrum.m_resident) {
+    read(spectrum);
+    ++m_resident;
+    if (m_maxResident > 0) {
+      m_clean.push_front(&spectrum);
+      spectrum.m_position = m_clean.begin();
+    }
+    spectrum.m_resident.store(true, std::memory_order_release);
+  } else if (m_maxResident > 0 && !spectrum.m_pinned) {
+    m_clean.splice(m_clean.begin(), m_clean, spectrum.m_position);
+  }
+  if (m_maxResident == 0 || spectrum.m_pinned)
+    return;
+  useInThisThread(spectrum);
+  if (pin) {
+    m_clean.erase(spectrum.m_position);
+    spectrum.m_pinned.store(true, std::memory_order_release);
+  }
+  evictLeastRecentlyUsed();
+}
+
+/// Record the spectrum as the one last accessed by the calling thread. The
+/// caller holds the lock.
+void FileBackedWorkspace2D::Backing::useInThisThread(
+    LazyHistogram1D &spectrum) {
+  auto &last = m_lastAccessed[std::this_thread::get_id()];
+  if (last == &spectrum)
+    return;
+  if (last)
+    --last->m_users;
+  last = &spectrum;
+  ++spectrum.m_users;
+}
+
+/// Drop the least recently used clean spectra that are not the last accessed
+/// by any thread until the budget is met. The caller holds the lock.
+void FileBackedWorkspace2D::Backing::evictLeastRecentlyUsed() {
+  auto it = m_clean.end();
+  while (m_clean.size() > m_maxResident && it != m_clean.begin()) {
+    auto &spectrum = **--it;
+    if (spectrum.m_users > 0)
+      continue;
+    it = m_clean.erase(it);
+    evict(spectrum);
+  }
+}
+
+/// Stop tracking a spectrum that is being destroyed
+void FileBackedWorkspace2D::Backing::forget(LazyHistogram1D &spectrum) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  if (spectrum.m_users > 0) {
+    for (auto &last : m_lastAccessed) {
+      if (last.second == &spectrum)
+        last.second = nullptr;
+    }
+  }
+  if (!spectrum.m_resident)
+    return;
+  if (m_maxResident > 0 && !spectrum.m_pinned)
+    m_clean.erase(spectrum.m_position);
+  --m_resident;
+}
+
+/// Drop the data of a clean spectrum, which has been taken off the list. The
+/// caller holds the lock.
+void FileBackedWorkspace2D::Backing::evict(LazyHistogram1D &spectrum) {
+  auto &histogram = spectrum.storage();
+  histogram.setSharedY(m_placeholderY);
+  histogram.setSharedE(m_placeholderE);
+  histogram.setSharedDx(Kernel::cow_ptr<HistogramData::HistogramDx>(nullptr));
+  spectrum.m_resident = false;
+  --m_resident;
+}
+
+/// Close the file. Reading any spectrum not in memory opens it again.
+void FileBackedWorkspace2D::Backing::closeFile() {
+  std::lock_guard<std::recursive_mutex> fileLock(g_fileMutex);
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_values.reset();
+  m_errors.reset();
+  m_xErrors.reset();
+}
+
+/// Read the Y, E and Dx data of a spectrum from the file. The caller holds the
+/// file mutex.
+void FileBackedWorkspace2D::Backing::read(LazyHistogram1D &spectrum) {
+  auto &histogram = spectrum.storage();
+  const auto length = histogram.y().size();
+  const std::vector<int64_t> start{static_cast<int64_t>(spectrum.m_fileIndex),
+                                   0};
+  // NexusFileIO writes one Dx value more per spectrum in old files. The last
+  // one is dropped, as the loader does.
+  const std::vector<int64_t> size{1, static_cast<int64_t>(length)};
+  std::vector<double> y(length);
+  std::vector<double> e(length);
+  std::vector<double> dx;
+  try {
+    openFields();
+    m_values->getSlab(y.data(), start, size);
+    m_errors->getSlab(e.data(), start, size);
+    if (m_xErrors) {
+      dx.resize(length);
+      m_xErrors->getSlab(dx.data(), start, size);
+    }
+  } catch (::NeXus::Exception &exc) {
+    std::ostringstream os;
+    os << "Unable to read spectrum " << spectrum.m_fileIndex << " from "
+       << m_filename << ": " << exc.what();
+    throw std::runtime_error(os.str());
+  }
+  histogram.setSharedY(
+      Kernel::make_cow<HistogramData::HistogramY>(std::move(y)));
+  histogram.setSharedE(
+      Kernel::make_cow<HistogramData::HistogramE>(std::move(e)));
+  if (m_xErrors)
+    histogram.setSharedDx(
+        Kernel::make_cow<HistogramData::HistogramDx>(std::move(dx)));
+}
+
+/// Open the datasets on the first read. The handles are kept open, so that
+/// HDF5 can cache the chunks shared by neighbouring spectra.
+void FileBackedWorkspace2D::Backing::openFields() {
+  if (m_values)
+    return;
+  const std::string group = m_nxpath + "/workspace";
+  auto open = [this, &group](const std::string &name) {
+    auto file = std::make_unique<::NeXus::File>(m_filename);
+    file->openPath(group + "/" + name);
+    return file;
+  };
+  m_values = open("values");
+  m_errors = open("errors");
+  ::NeXus::File file(m_filename);
+  file.openPath(group);
+  if (file.getEntries().count("xerrors") > 0)
+    m_xErrors = open("xerrors");
+}
+
+/**
+ * Create an empty workspace backed by a NeXus processed file. Use initialize()
+ * and set up the X data and the spectrum metadata, then call
+ * loadSpectraOnAccess().
+ * @param filename :: The full path to the file
+ * @param nxpath :: The path of the "mantid_workspace_<n>" entry in the file
+ * @param maxResidentSpectra :: The maximum number of clean spectra held in
+ * memory, 0 for no limit
+ */
+FileBackedWorkspace2D::FileBackedWorkspace2D(const std::string &filename,
+                                             const std::string &nxpath,
+                                             const size_t maxResidentSpectra)
+    : Workspace2D(), m_filename(filename), m_nxpath(nxpath),
+      m_maxResidentSpectra(maxResidentSpectra),
+      m_backing(
+          std::make_unique<Backing>(filename, nxpath, maxResidentSpectra)) {}
+
+/// The spectra are destroyed first, as they hold a reference to the backing
+FileBackedWorkspace2D::~FileBackedWorkspace2D() { data.clear(); }
+
+/**
+ * Replace the spectra by ones that read their Y, E and Dx data from the file
+ * on first access. The X data and the metadata of the spectra are kept.
+ * @param fileIndices :: The row in the file of each spectrum
+ */
+void FileBackedWorkspace2D::loadSpectraOnAccess(
+    const std::vector<size_t> &fileIndices) {
+  if (fileIndices.size() != data.size())
+    throw std::invalid_argument(
+        "FileBackedWorkspace2D: the number of file indices must match the "
+        "number of spectra");
+  if (data.empty())
+    return;
+  m_backing->setPlaceholders(*data.front());
+  for (size_t i = 0; i < data.size(); ++i) {
+    data[i] = std::make_unique<Backing::LazyHistogram1D>(*data[i], *m_backing,
+                                                         fileIndices[i]);
+  }
+}
+
+/// The instrument, sample, logs and parameters are read from the file when
+/// any of them is first accessed
+void FileBackedWorkspace2D::loadExperimentInfoOnAccess() {
+  m_experimentInfoPending = true;
+}
+
+size_t FileBackedWorkspace2D::residentSpectra() const {
+  return m_backing->resident();
+}
+
+/**
+ * Read the experiment information and the data of all the spectra, keep them
+ * in memory regardless of the budget, and close the file. Needed before the
+ * file is overwritten.
+ */
+void FileBackedWorkspace2D::loadAll() const {
+  populateIfNotLoaded();
+  for (const auto &spectrum : data) {
+    auto lazy = dynamic_cast<Backing::LazyHistogram1D *>(spectrum.get());
+    if (lazy)
+      m_backing->access(*lazy, true);
+  }
+  m_backing->closeFile();
+}
+
+/**
+ * Read the experiment information from the file, if this has not been done.
+ * Failures are reported as warnings, as LoadNexusProcessed does.
+ */
+void FileBackedWorkspace2D::populateIfNotLoaded() const {
+  if (!m_experimentInfoPending)
+    return;
+  std::lock_guard<std::recursive_mutex> lock(m_experimentInfoMutex);
+  // Loading calls things such as mutableSample(), which end up here again
+  if (m_experimentInfoLoading || !m_experimentInfoPending)
+    return;
+  m_experimentInfoLoading = true;
+  auto &self = const_cast<FileBackedWorkspace2D &>(*this);
+  try {
+    std::lock_guard<std::recursive_mutex> fileLock(g_fileMutex);
+    ::NeXus::File nxFile(m_filename);
+    nxFile.openPath(m_nxpath);
+    std::string parameterStr;
+    self.loadExperimentInfoNexus(m_filename, &nxFile, parameterStr);
+    self.readParameterMap(parameterStr);
+  } catch (std::exception &e) {
+    g_log.warning() << "Error loading the experiment information from "
+                    << m_filename << ": " << e.what() << '\n';
+  }
+  m_experimentInfoLoading = false;
+  m_experimentInfoPending = false;
+}
+
+} // namespace DataObjects
+} // namespace Mantid
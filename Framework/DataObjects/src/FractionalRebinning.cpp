@@ -10,8 +10,10 @@
 #include "MantidGeometry/Math/ConvexPolygon.h"
 #include "MantidGeometry/Math/PolygonIntersection.h"
 #include "MantidGeometry/Math/Quadrilateral.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/V2D.h"
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
 
@@ -48,6 +50,8 @@ namespace DataObjects {
 namespace FractionalRebinning {
 
 const double POS_TOLERANCE = 1.e-10;
+/// The memory, in bytes, that the PartialSums of all threads may take
+const size_t PARTIAL_SUMS_MEMORY_LIMIT = size_t(1) << 30;
 
 enum class QuadrilateralType { Rectangle, TrapezoidX, TrapezoidY, General };
 
@@ -126,7 +130,9 @@ bool getIntersectionRegion(const std::vector<double> &xAxis,
 
 /**
  * Computes the output grid bins which intersect the input quad and their
- * overlapping areas assuming both input and output grids are rectangular
+ * overlapping areas assuming both input and output grids are rectangular.
+ * The overlap of each bin is the product of its overlapping width and height,
+ * so the areas are passed straight to the caller rather than collected.
  * @param xAxis A vector containing the output horizontal axis edges
  * @param yAxis The output data vertical axis
  * @param inputQ The input quadrilateral
@@ -134,29 +140,28 @@ bool getIntersectionRegion(const std::vector<double> &xAxis,
  * @param y_end The starting y-axis index
  * @param x_start The starting x-axis index
  * @param x_end The starting x-axis index
- * @param areaInfos Output vector of indices and areas of overlapping bins
+ * @param addArea Called with the x and y indices and the overlapping area of
+ * each bin
  */
+template <typename AddArea>
 void calcRectangleIntersections(const std::vector<double> &xAxis,
                                 const std::vector<double> &yAxis,
                                 const Quadrilateral &inputQ,
                                 const size_t y_start, const size_t y_end,
                                 const size_t x_start, const size_t x_end,
-                                std::vector<AreaInfo> &areaInfos) {
-  std::vector<double> width;
-  width.reserve(x_end - x_start);
+                                AddArea &&addArea) {
+  std::vector<double> width(x_end - x_start);
   for (size_t xi = x_start; xi < x_end; ++xi) {
     const double x0 = (xi == x_start) ? inputQ.minX() : xAxis[xi];
     const double x1 = (xi == x_end - 1) ? inputQ.maxX() : xAxis[xi + 1];
-    width.emplace_back(x1 - x0);
+    width[xi - x_start] = x1 - x0;
   }
-  areaInfos.reserve((y_end - y_start) * (x_end - x_start));
   for (size_t yi = y_start; yi < y_end; ++yi) {
     const double y0 = (yi == y_start) ? inputQ.minY() : yAxis[yi];
     const double y1 = (yi == y_end - 1) ? inputQ.maxY() : yAxis[yi + 1];
     const double height = y1 - y0;
-    auto width_it = width.begin();
     for (size_t xi = x_start; xi < x_end; ++xi) {
-      areaInfos.emplace_back(xi, yi, height * (*width_it++));
+      addArea(xi, yi, height * width[xi - x_start]);
     }
   }
 }
@@ -518,28 +523,32 @@ void normaliseOutput(MatrixWorkspace_sptr outputWS,
   outputWS->setDistribution(inputWS->isDistribution());
 }
 
+namespace {
 /**
- * Rebin the input quadrilateral to the output grid.
- * The quadrilateral must have a CLOCKWISE winding.
+ * Rebin the input quadrilateral to the output grid, passing the contribution
+ * to each overlapping output bin to the caller.
  * @param inputQ The input polygon (Polygon winding must be Clockwise)
  * @param inputWS The input workspace containing the input intensity values
  * @param i The index in the vertical axis direction that inputQ references
  * @param j The index in the horizontal axis direction that inputQ references
- * @param outputWS A pointer to the output workspace that accumulates the data
+ * @param X The output horizontal bin boundaries
  * @param verticalAxis A vector containing the output vertical axis bin
  * boundaries
+ * @param add Called with the workspace index, bin index, signal and variance
+ * of each contribution
  */
-void rebinToOutput(const Quadrilateral &inputQ,
-                   const MatrixWorkspace_const_sptr &inputWS, const size_t i,
-                   const size_t j, MatrixWorkspace &outputWS,
-                   const std::vector<double> &verticalAxis) {
+template <typename Add>
+void rebinQuadrilateral(const Quadrilateral &inputQ,
+                        const MatrixWorkspace_const_sptr &inputWS,
+                        const size_t i, const size_t j,
+                        const std::vector<double> &X,
+                        const std::vector<double> &verticalAxis, Add &&add) {
   const auto &inY = inputWS->y(i);
   // Check once whether the signal
   if (std::isnan(inY[j])) {
     return;
   }
 
-  const auto &X = outputWS.x(0).rawData();
   size_t qstart(0), qend(verticalAxis.size() - 1), x_start(0),
       x_end(X.size() - 1);
   if (!getIntersectionRegion(X, verticalAxis, inputQ, qstart, qend, x_start,
@@ -547,6 +556,8 @@ void rebinToOutput(const Quadrilateral &inputQ,
     return;
 
   const auto &inE = inputWS->e(i);
+  const bool isDistribution = inputWS->isDistribution();
+  const double inputQArea = inputQ.area();
   // It seems to be more efficient to construct this once and clear it before
   // each calculation in the loop
   ConvexPolygon intersectOverlap;
@@ -562,52 +573,45 @@ void rebinToOutput(const Quadrilateral &inputQ,
         if (overlapArea == 0.) {
           continue;
         }
-        const double weight = overlapArea / inputQ.area();
+        const double weight = overlapArea / inputQArea;
         double yValue = inY[j];
         yValue *= weight;
         double eValue = inE[j];
-        if (inputWS->isDistribution()) {
+        if (isDistribution) {
           const double overlapWidth =
               intersectOverlap.maxX() - intersectOverlap.minX();
           yValue *= overlapWidth;
           eValue *= overlapWidth;
         }
         eValue = eValue * eValue * weight;
-        PARALLEL_CRITICAL(overlap_sum) {
-          // The mutable calls must be in the critical section
-          // so that any calls from omp sections can write to the
-          // output workspace safely
-          outputWS.mutableY(y)[xi] += yValue;
-          outputWS.mutableE(y)[xi] += eValue;
-        }
+        add(y, xi, yValue, eValue);
       }
     }
   }
 }
 
 /**
- * Rebin the input quadrilateral to the output grid
- * The quadrilateral must have a CLOCKWISE winding.
+ * Rebin the input quadrilateral to the output grid, passing the contribution
+ * to each overlapping output bin to the caller.
  * @param inputQ The input polygon (Polygon winding must be clockwise)
  * @param inputWS The input workspace containing the input intensity values
- * @param i The indexiin the vertical axis direction that inputQ references
+ * @param i The index in the vertical axis direction that inputQ references
  * @param j The index in the horizontal axis direction that inputQ references
- * @param outputWS A pointer to the output workspace that accumulates the data
- *        Note that the error array of the output workspace contains the
- *        **variance** and not the errors (standard deviations).
+ * @param X The output horizontal bin boundaries
  * @param verticalAxis A vector containing the output vertical axis bin
  * boundaries
- * @param inputRB A pointer, of RebinnedOutput type, to the input workspace.
- * It is used to take into account the input area fractions when calcuting
- * the final output fractions.
- * This can be null to indicate that the input was a standard 2D workspace.
+ * @param inputRB The input as a RebinnedOutput, or null
+ * @param add Called with the workspace index, bin index, signal, variance
+ * and fractional weight of each contribution
  */
-void rebinToFractionalOutput(const Quadrilateral &inputQ,
-                             const MatrixWorkspace_const_sptr &inputWS,
-                             const size_t i, const size_t j,
-                             RebinnedOutput &outputWS,
-                             const std::vector<double> &verticalAxis,
-                             const RebinnedOutput_const_sptr &inputRB) {
+template <typename Add>
+void rebinQuadrilateralFractional(const Quadrilateral &inputQ,
+                                  const MatrixWorkspace_const_sptr &inputWS,
+                                  const size_t i, const size_t j,
+                                  const std::vector<double> &X,
+                                  const std::vector<double> &verticalAxis,
+                                  const RebinnedOutput_const_sptr &inputRB,
+                                  Add &&add) {
   const auto &inX = inputWS->x(i);
   const auto &inY = inputWS->y(i);
   const auto &inE = inputWS->e(i);
@@ -615,7 +619,6 @@ void rebinToFractionalOutput(const Quadrilateral &inputQ,
   if (std::isnan(signal))
     return;
 
-  const auto &X = outputWS.x(0).rawData();
   size_t qstart(0), qend(verticalAxis.size() - 1), x_start(0),
       x_end(X.size() - 1);
   if (!getIntersectionRegion(X, verticalAxis, inputQ, qstart, qend, x_start,
@@ -635,24 +638,6 @@ void rebinToFractionalOutput(const Quadrilateral &inputQ,
     inputWeight = overlapWidth;
   }
 
-  // The intersection overlap algorithm is relatively costly. The outputQ is
-  // defined as rectangular. If the inputQ is is also rectangular or
-  // trapezoidal, a simpler/faster way of calculating the intersection area
-  // of all or some bins can be used.
-  std::vector<AreaInfo> areaInfos;
-  const double inputQArea = inputQ.area();
-  const QuadrilateralType inputQType = getQuadrilateralType(inputQ);
-  if (inputQType == QuadrilateralType::Rectangle) {
-    calcRectangleIntersections(X, verticalAxis, inputQ, qstart, qend, x_start,
-                               x_end, areaInfos);
-  } else if (inputQType == QuadrilateralType::TrapezoidY) {
-    calcTrapezoidYIntersections(X, verticalAxis, inputQ, qstart, qend, x_start,
-                                x_end, areaInfos);
-  } else {
-    calcGeneralIntersections(X, verticalAxis, inputQ, qstart, qend, x_start,
-                             x_end, areaInfos);
-  }
-
   // If the input is a RebinnedOutput workspace with frac. area we need
   // to account for the weight of the input bin in the output bin weights
   if (inputRB) {
@@ -667,18 +652,211 @@ void rebinToFractionalOutput(const Quadrilateral &inputQ,
   }
 
   const double variance = error * error;
-  for (const auto &ai : areaInfos) {
-    if (ai.weight == 0.) {
-      continue;
+  const double inputQArea = inputQ.area();
+  auto addArea = [&](const size_t xi, const size_t yi, const double area) {
+    if (area == 0.) {
+      return;
     }
-    const double weight = ai.weight / inputQArea;
-    PARALLEL_CRITICAL(overlap) {
-      // The mutable calls must be in the critical section
-      // so that any calls from omp sections can write to the
-      // output workspace safely
-      outputWS.mutableY(ai.wsIndex)[ai.binIndex] += signal * weight;
-      outputWS.mutableE(ai.wsIndex)[ai.binIndex] += variance * weight;
-      outputWS.dataF(ai.wsIndex)[ai.binIndex] += weight * inputWeight;
+    const double weight = area / inputQArea;
+    add(yi, xi, signal * weight, variance * weight, weight * inputWeight);
+  };
+
+  // The intersection overlap algorithm is relatively costly. The outputQ is
+  // defined as rectangular. If the inputQ is is also rectangular or
+  // trapezoidal, a simpler/faster way of calculating the intersection area
+  // of all or some bins can be used.
+  const QuadrilateralType inputQType = getQuadrilateralType(inputQ);
+  if (inputQType == QuadrilateralType::Rectangle) {
+    calcRectangleIntersections(X, verticalAxis, inputQ, qstart, qend, x_start,
+                               x_end, addArea);
+    return;
+  }
+  std::vector<AreaInfo> areaInfos;
+  if (inputQType == QuadrilateralType::TrapezoidY) {
+    calcTrapezoidYIntersections(X, verticalAxis, inputQ, qstart, qend, x_start,
+                                x_end, areaInfos);
+  } else {
+    calcGeneralIntersections(X, verticalAxis, inputQ, qstart, qend, x_start,
+                             x_end, areaInfos);
+  }
+  for (const auto &ai : areaInfos) {
+    addArea(ai.binIndex, ai.wsIndex, ai.weight);
+  }
+}
+} // namespace
+
+/**
+ * Rebin the input quadrilateral to the output grid.
+ * The quadrilateral must have a CLOCKWISE winding.
+ * @param inputQ The input polygon (Polygon winding must be Clockwise)
+ * @param inputWS The input workspace containing the input intensity values
+ * @param i The index in the vertical axis direction that inputQ references
+ * @param j The index in the horizontal axis direction that inputQ references
+ * @param outputWS A pointer to the output workspace that accumulates the data
+ * @param verticalAxis A vector containing the output vertical axis bin
+ * boundaries
+ */
+void rebinToOutput(const Quadrilateral &inputQ,
+                   const MatrixWorkspace_const_sptr &inputWS, const size_t i,
+                   const size_t j, MatrixWorkspace &outputWS,
+                   const std::vector<double> &verticalAxis) {
+  rebinQuadrilateral(
+      inputQ, inputWS, i, j, outputWS.x(0).rawData(), verticalAxis,
+      [&outputWS](const size_t y, const size_t xi, const double yValue,
+                  const double eValue) {
+        PARALLEL_CRITICAL(overlap_sum) {
+          // The mutable calls must be in the critical section
+          // so that any calls from omp sections can write to the
+          // output workspace safely
+          outputWS.mutableY(y)[xi] += yValue;
+          outputWS.mutableE(y)[xi] += eValue;
+        }
+      });
+}
+
+/**
+ * Rebin the input quadrilateral to the partial sums of the calling thread.
+ * The quadrilateral must have a CLOCKWISE winding.
+ * @param inputQ The input polygon (Polygon winding must be Clockwise)
+ * @param inputWS The input workspace containing the input intensity values
+ * @param i The index in the vertical axis direction that inputQ references
+ * @param j The index in the horizontal axis direction that inputQ references
+ * @param sums The sums of the calling thread, which accumulate the data
+ * @param xAxis A vector containing the output horizontal axis bin boundaries
+ * @param verticalAxis A vector containing the output vertical axis bin
+ * boundaries
+ */
+void rebinToOutput(const Quadrilateral &inputQ,
+                   const MatrixWorkspace_const_sptr &inputWS, const size_t i,
+                   const size_t j, PartialSums &sums,
+                   const std::vector<double> &xAxis,
+                   const std::vector<double> &verticalAxis) {
+  rebinQuadrilateral(inputQ, inputWS, i, j, xAxis, verticalAxis,
+                     [&sums](const size_t y, const size_t xi,
+                             const double yValue, const double eValue) {
+                       sums.add(y, xi, yValue, eValue, 0.);
+                     });
+}
+
+/**
+ * Rebin the input quadrilateral to the output grid
+ * The quadrilateral must have a CLOCKWISE winding.
+ * @param inputQ The input polygon (Polygon winding must be clockwise)
+ * @param inputWS The input workspace containing the input intensity values
+ * @param i The indexiin the vertical axis direction that inputQ references
+ * @param j The index in the horizontal axis direction that inputQ references
+ * @param outputWS A pointer to the output workspace that accumulates the data
+ *        Note that the error array of the output workspace contains the
+ *        **variance** and not the errors (standard deviations).
+ * @param verticalAxis A vector containing the output vertical axis bin
+ * boundaries
+ * @param inputRB A pointer, of RebinnedOutput type, to the input workspace.
+ * It is used to take into account the input area fractions when calcuting
+ * the final output fractions.
+ * This can be null to indicate that the input was a standard 2D workspace.
+ */
+void rebinToFractionalOutput(const Quadrilateral &inputQ,
+                             const MatrixWorkspace_const_sptr &inputWS,
+                             const size_t i, const size_t j,
+                             RebinnedOutput &outputWS,
+                             const std::vector<double> &verticalAxis,
+                             const RebinnedOutput_const_sptr &inputRB) {
+  rebinQuadrilateralFractional(
+      inputQ, inputWS, i, j, outputWS.x(0).rawData(), verticalAxis, inputRB,
+      [&outputWS](const size_t wsIndex, const size_t binIndex,
+                  const double signal, const double variance,
+                  const double weight) {
+        PARALLEL_CRITICAL(overlap) {
+          // The mutable calls must be in the critical section
+          // so that any calls from omp sections can write to the
+          // output workspace safely
+          outputWS.mutableY(wsIndex)[binIndex] += signal;
+          outputWS.mutableE(wsIndex)[binIndex] += variance;
+          outputWS.dataF(wsIndex)[binIndex] += weight;
+        }
+      });
+}
+
+/**
+ * Rebin the input quadrilateral to the partial sums of the calling thread.
+ * The quadrilateral must have a CLOCKWISE winding.
+ * @param inputQ The input polygon (Polygon winding must be clockwise)
+ * @param inputWS The input workspace containing the input intensity values
+ * @param i The index in the vertical axis direction that inputQ references
+ * @param j The index in the horizontal axis direction that inputQ references
+ * @param sums The sums of the calling thread, which accumulate the data.
+ *        As for a RebinnedOutput, the variance is summed, not the errors.
+ * @param xAxis A vector containing the output horizontal axis bin boundaries
+ * @param verticalAxis A vector containing the output vertical axis bin
+ * boundaries
+ * @param inputRB A pointer, of RebinnedOutput type, to the input workspace,
+ * or null if the input was a standard 2D workspace
+ */
+void rebinToFractionalOutput(const Quadrilateral &inputQ,
+                             const MatrixWorkspace_const_sptr &inputWS,
+                             const size_t i, const size_t j,
+                             PartialSums &sums,
+                             const std::vector<double> &xAxis,
+                             const std::vector<double> &verticalAxis,
+                             const RebinnedOutput_const_sptr &inputRB) {
+  rebinQuadrilateralFractional(
+      inputQ, inputWS, i, j, xAxis, verticalAxis, inputRB,
+      [&sums](const size_t wsIndex, const size_t binIndex, const double signal,
+              const double variance, const double weight) {
+        sums.add(wsIndex, binIndex, signal, variance, weight);
+      });
+}
+
+/**
+ * The number of threads of a parallel rebin, each of which holds its own
+ * PartialSums of the output grid. The sums of all threads are limited to
+ * PARTIAL_SUMS_MEMORY_LIMIT bytes, so fewer threads are used for large
+ * outputs, down to one.
+ * @param outputWS The output workspace
+ * @param fractional True if the fractional weights are summed too
+ * @return The number of threads to use, at least 1
+ */
+int numberOfPartialSums(const MatrixWorkspace &outputWS,
+                        const bool fractional) {
+  const int maxThreads = PARALLEL_GET_MAX_THREADS;
+  const size_t gridSize = outputWS.getNumberHistograms() *
+                          outputWS.blocksize() * (fractional ? 3 : 2) *
+                          sizeof(double);
+  if (gridSize == 0)
+    return maxThreads;
+  const size_t fitting =
+      std::max<size_t>(PARTIAL_SUMS_MEMORY_LIMIT / gridSize, 1);
+  return static_cast<int>(std::min(fitting, static_cast<size_t>(maxThreads)));
+}
+
+/**
+ * Add the partial sums of the threads of a parallel rebin to the output
+ * workspace. The sums are added in order, so the result does not depend on
+ * how the work was scheduled. The fractional weights are only added if the
+ * output is a RebinnedOutput.
+ * @param sums The partial sums of each thread
+ * @param outputWS The output workspace, which must have the shape of the sums
+ */
+void addToOutput(const std::vector<PartialSums> &sums,
+                 MatrixWorkspace &outputWS) {
+  auto outputRB = dynamic_cast<RebinnedOutput *>(&outputWS);
+  const auto numberHistograms =
+      static_cast<int64_t>(outputWS.getNumberHistograms());
+  PARALLEL_FOR_IF(Kernel::threadSafe(outputWS))
+  for (int64_t i = 0; i < numberHistograms; ++i) {
+    auto &outputY = outputWS.mutableY(i);
+    auto &outputE = outputWS.mutableE(i);
+    for (const auto &partial : sums) {
+      const size_t offset = static_cast<size_t>(i) * partial.numberBins();
+      for (size_t j = 0; j < outputY.size(); ++j) {
+        outputY[j] += partial.signal()[offset + j];
+        outputE[j] += partial.variance()[offset + j];
+      }
+      if (outputRB && !partial.weight().empty()) {
+        auto &outputF = outputRB->dataF(i);
+        for (size_t j = 0; j < outputF.size(); ++j)
+          outputF[j] += partial.weight()[offset + j];
+      }
     }
   }
 }
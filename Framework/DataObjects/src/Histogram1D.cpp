@@ -25,14 +25,31 @@ Histogram1D::Histogram1D(HistogramData::Histogram::XMode xmode,
   }
 }
 
+/// Copy constructor. Reads the data of other through histogramRef().
+Histogram1D::Histogram1D(const Histogram1D &other)
+    : ISpectrum(other), m_histogram(other.histogramRef()) {}
+
 /// Construct from ISpectrum.
 Histogram1D::Histogram1D(const ISpectrum &other)
     : ISpectrum(other), m_histogram(other.histogram()) {}
 
+/// Construct with the spectrum number and detector IDs of other, holding the
+/// given histogram. Lets subclasses copy without reading the data of other.
+Histogram1D::Histogram1D(const ISpectrum &other,
+                         const HistogramData::Histogram &histogram)
+    : ISpectrum(other), m_histogram(histogram) {}
+
+/// Copy assignment. Reads the data of rhs through histogramRef().
+Histogram1D &Histogram1D::operator=(const Histogram1D &rhs) {
+  ISpectrum::operator=(rhs);
+  mutableHistogramRef() = rhs.histogramRef();
+  return *this;
+}
+
 /// Assignment from ISpectrum.
 Histogram1D &Histogram1D::operator=(const ISpectrum &rhs) {
   ISpectrum::operator=(rhs);
-  m_histogram = rhs.histogram();
+  mutableHistogramRef() = rhs.histogram();
   return *this;
 }
 
@@ -43,7 +60,7 @@ void Histogram1D::copyDataFrom(const ISpectrum &source) {
 
 /// Used by copyDataFrom for dynamic dispatch for its `source`.
 void Histogram1D::copyDataInto(Histogram1D &sink) const {
-  sink.m_histogram = m_histogram;
+  sink.mutableHistogramRef() = histogramRef();
 }
 
 void Histogram1D::clearData() {
@@ -56,29 +73,35 @@ void Histogram1D::clearData() {
 /// Deprecated, use setSharedX() instead. Sets the x data.
 /// @param X :: vector of X data
 void Histogram1D::setX(const Kernel::cow_ptr<HistogramData::HistogramX> &X) {
-  m_histogram.setX(X);
+  mutableHistogramXRef().setX(X);
 }
 
 /// Deprecated, use mutableX() instead. Returns the x data
-MantidVec &Histogram1D::dataX() { return m_histogram.dataX(); }
+MantidVec &Histogram1D::dataX() { return mutableHistogramXRef().dataX(); }
 
 /// Deprecated, use x() instead. Returns the x data const
-const MantidVec &Histogram1D::dataX() const { return m_histogram.dataX(); }
+const MantidVec &Histogram1D::dataX() const {
+  return histogramXRef().dataX();
+}
 
 /// Deprecated, use x() instead. Returns the x data const
-const MantidVec &Histogram1D::readX() const { return m_histogram.readX(); }
+const MantidVec &Histogram1D::readX() const {
+  return histogramXRef().readX();
+}
 
 /// Deprecated, use sharedX() instead. Returns a pointer to the x data
 Kernel::cow_ptr<HistogramData::HistogramX> Histogram1D::ptrX() const {
-  return m_histogram.ptrX();
+  return histogramXRef().ptrX();
 }
 
 /// Deprecated, use mutableDx() instead.
-MantidVec &Histogram1D::dataDx() { return m_histogram.dataDx(); }
+MantidVec &Histogram1D::dataDx() { return mutableHistogramRef().dataDx(); }
 /// Deprecated, use dx() instead.
-const MantidVec &Histogram1D::dataDx() const { return m_histogram.dataDx(); }
+const MantidVec &Histogram1D::dataDx() const {
+  return histogramRef().dataDx();
+}
 /// Deprecated, use dx() instead.
-const MantidVec &Histogram1D::readDx() const { return m_histogram.readDx(); }
+const MantidVec &Histogram1D::readDx() const { return histogramRef().readDx(); }
 
 /**
  * Makes sure a histogram has valid Y and E data.
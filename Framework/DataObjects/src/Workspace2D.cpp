@@ -30,8 +30,19 @@ Workspace2D::Workspace2D(const Parallel::StorageMode storageMode)
     : HistoWorkspace(storageMode) {}
 
 Workspace2D::Workspace2D(const Workspace2D &other)
+    : Workspace2D(other, true) {}
+
+/**
+ * Copy constructor that may leave the spectra to a child to copy
+ * @param other :: The workspace to copy
+ * @param copySpectra :: If false, data is sized but the spectra are not
+ * created
+ */
+Workspace2D::Workspace2D(const Workspace2D &other, const bool copySpectra)
     : HistoWorkspace(other), m_monitorList(other.m_monitorList) {
   data.resize(other.data.size());
+  if (!copySpectra)
+    return;
   for (size_t i = 0; i < data.size(); ++i) {
     data[i] = std::make_unique<Histogram1D>(*(other.data[i]));
   }
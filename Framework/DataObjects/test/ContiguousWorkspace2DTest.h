@@ -0,0 +1,216 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_DATAOBJECTS_CONTIGUOUSWORKSPACE2DTEST_H_
+#define MANTID_DATAOBJECTS_CONTIGUOUSWORKSPACE2DTEST_H_
+
+#include "MantidDataObjects/ContiguousWorkspace2D.h"
+#include "MantidDataObjects/WorkspaceCreation.h"
+#include "MantidHistogramData/LinearGenerator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cxxtest/TestSuite.h>
+#include <thread>
+
+using namespace Mantid::DataObjects;
+using namespace Mantid::HistogramData;
+
+namespace {
+constexpr size_t NUMBER_OF_SPECTRA = 4;
+constexpr size_t NUMBER_OF_BINS = 3;
+
+/// A workspace whose Y value of bin j of spectrum i is 10 i + j, and whose E
+/// values are half of that
+std::unique_ptr<ContiguousWorkspace2D> createWorkspace() {
+  auto ws = std::make_unique<ContiguousWorkspace2D>();
+  ws->initialize(NUMBER_OF_SPECTRA, NUMBER_OF_BINS + 1, NUMBER_OF_BINS);
+  for (size_t i = 0; i < NUMBER_OF_SPECTRA; ++i) {
+    double *y = ws->mutableRowY(i);
+    double *e = ws->mutableRowE(i);
+    for (size_t j = 0; j < NUMBER_OF_BINS; ++j) {
+      y[j] = 10. * static_cast<double>(i) + static_cast<double>(j);
+      e[j] = 0.5 * y[j];
+    }
+  }
+  return ws;
+}
+} // namespace
+
+class ContiguousWorkspace2DTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static ContiguousWorkspace2DTest *createSuite() {
+    return new ContiguousWorkspace2DTest();
+  }
+  static void destroySuite(ContiguousWorkspace2DTest *suite) { delete suite; }
+
+  void test_initialize_creates_zeroed_blocks() {
+    ContiguousWorkspace2D ws;
+    ws.initialize(NUMBER_OF_SPECTRA, NUMBER_OF_BINS + 1, NUMBER_OF_BINS);
+    TS_ASSERT_EQUALS(ws.id(), "Workspace2D")
+    TS_ASSERT_EQUALS(ws.getNumberHistograms(), NUMBER_OF_SPECTRA)
+    TS_ASSERT_EQUALS(ws.blocksize(), NUMBER_OF_BINS)
+    TS_ASSERT_EQUALS(ws.rowLength(), NUMBER_OF_BINS)
+    TS_ASSERT_EQUALS(ws.blockY().size(), NUMBER_OF_SPECTRA * NUMBER_OF_BINS)
+    TS_ASSERT_EQUALS(ws.blockE().size(), NUMBER_OF_SPECTRA * NUMBER_OF_BINS)
+    TS_ASSERT(std::all_of(ws.blockY().cbegin(), ws.blockY().cend(),
+                          [](const double y) { return y == 0.; }))
+    TS_ASSERT_EQUALS(ws.getSpectrum(2).getSpectrumNo(), 3)
+    TS_ASSERT(ws.allInBlocks())
+  }
+
+  void test_rows_are_consecutive_in_the_blocks() {
+    auto ws = createWorkspace();
+    TS_ASSERT_EQUALS(ws->rowY(1), ws->blockY().data() + NUMBER_OF_BINS)
+    TS_ASSERT_EQUALS(ws->rowE(3), ws->blockE().data() + 3 * NUMBER_OF_BINS)
+    TS_ASSERT_EQUALS(ws->blockY()[2 * NUMBER_OF_BINS + 1], 21.)
+    TS_ASSERT_EQUALS(ws->blockE()[2 * NUMBER_OF_BINS + 1], 10.5)
+    TS_ASSERT(ws->allInBlocks())
+  }
+
+  void test_x_access_leaves_the_spectra_in_the_blocks() {
+    auto ws = createWorkspace();
+    TS_ASSERT_EQUALS(ws->x(0)[1], 2.)
+    ws->mutableX(1)[0] = -1.;
+    ws->setSharedX(2, ws->sharedX(0));
+    ws->setBinEdges(3, BinEdges(NUMBER_OF_BINS + 1, LinearGenerator(0., 2.)));
+    TS_ASSERT_EQUALS(ws->x(1)[0], -1.)
+    TS_ASSERT_EQUALS(ws->x(3)[1], 2.)
+    TS_ASSERT_EQUALS(ws->binEdges(3)[1], 2.)
+    TS_ASSERT(ws->allInBlocks())
+  }
+
+  void test_histogram_copies_the_row_without_taking_it_out() {
+    auto ws = createWorkspace();
+    const auto histogram = ws->histogram(2);
+    TS_ASSERT_EQUALS(histogram.y()[1], 21.)
+    TS_ASSERT_EQUALS(histogram.e()[1], 10.5)
+    TS_ASSERT_EQUALS(histogram.x()[1], 2.)
+    TS_ASSERT(ws->allInBlocks())
+  }
+
+  void test_histogram_api_copies_the_row_out() {
+    auto ws = createWorkspace();
+    TS_ASSERT_EQUALS(ws->y(1)[2], 12.)
+    TS_ASSERT_EQUALS(ws->e(1)[2], 6.)
+    TS_ASSERT(!ws->allInBlocks())
+    // The row accessors follow the data of the spectrum
+    TS_ASSERT_EQUALS(ws->rowY(1), ws->y(1).rawData().data())
+    TS_ASSERT_EQUALS(ws->rowE(1), ws->e(1).rawData().data())
+    ws->mutableY(1)[0] = 42.;
+    TS_ASSERT_EQUALS(ws->rowY(1)[0], 42.)
+    ws->mutableRowE(1)[0] = 7.;
+    TS_ASSERT_EQUALS(ws->e(1)[0], 7.)
+    // The other spectra are still in the blocks
+    TS_ASSERT_EQUALS(ws->rowY(2), ws->blockY().data() + 2 * NUMBER_OF_BINS)
+  }
+
+  void test_setting_a_histogram_takes_the_row_out() {
+    auto ws = createWorkspace();
+    ws->setHistogram(0, BinEdges{0., 1., 2.}, Counts{5., 6.});
+    TS_ASSERT_EQUALS(ws->y(0).size(), 2)
+    TS_ASSERT_EQUALS(ws->rowY(0)[1], 6.)
+    TS_ASSERT_EQUALS(ws->y(1)[1], 11.)
+  }
+
+  void test_clear_data_zeroes_the_row() {
+    auto ws = createWorkspace();
+    ws->getSpectrum(2).clearData();
+    TS_ASSERT(ws->allInBlocks())
+    TS_ASSERT_EQUALS(ws->rowY(2)[1], 0.)
+    TS_ASSERT_EQUALS(ws->rowE(2)[1], 0.)
+    TS_ASSERT_EQUALS(ws->rowY(3)[1], 31.)
+  }
+
+  void test_clone_copies_the_blocks() {
+    auto ws = createWorkspace();
+    ws->mutableY(3)[0] = 3.5;
+    ws->getSpectrum(1).setSpectrumNo(17);
+    auto clone = ws->clone();
+    TS_ASSERT_EQUALS(clone->getSpectrum(1).getSpectrumNo(), 17)
+    TS_ASSERT_EQUALS(clone->rowY(2)[1], 21.)
+    TS_ASSERT_EQUALS(clone->rowY(3)[0], 3.5)
+    TS_ASSERT_EQUALS(clone->rowY(2),
+                     clone->blockY().data() + 2 * NUMBER_OF_BINS)
+    TS_ASSERT(!clone->allInBlocks())
+    // The data of the clone is independent of that of the original
+    clone->mutableRowY(2)[1] = -1.;
+    clone->mutableY(3)[0] = -2.;
+    TS_ASSERT_EQUALS(ws->rowY(2)[1], 21.)
+    TS_ASSERT_EQUALS(ws->y(3)[0], 3.5)
+  }
+
+  void test_clone_empty_is_contiguous() {
+    auto ws = createWorkspace();
+    auto empty = create<Workspace2D>(*ws);
+    TS_ASSERT(dynamic_cast<ContiguousWorkspace2D *>(empty.get()))
+    TS_ASSERT_EQUALS(empty->getNumberHistograms(), NUMBER_OF_SPECTRA)
+    TS_ASSERT_EQUALS(empty->x(1)[1], 2.)
+    TS_ASSERT_EQUALS(empty->y(1)[1], 0.)
+    // Creating it does not take the spectra of the parent out of the blocks
+    TS_ASSERT(ws->allInBlocks())
+  }
+
+  void test_create_with_values_fills_every_row() {
+    auto ws = create<ContiguousWorkspace2D>(
+        3, Histogram(BinEdges{0., 1., 2.}, Counts{2., 3.}));
+    TS_ASSERT_EQUALS(ws->rowLength(), 2)
+    TS_ASSERT_EQUALS(ws->blockY(),
+                     std::vector<double>({2., 3., 2., 3., 2., 3.}))
+    TS_ASSERT_DELTA(ws->blockE()[1], std::sqrt(3.), 1e-12)
+  }
+
+  void test_concurrent_reads_copy_a_row_out_once() {
+    auto ws = createWorkspace();
+    std::vector<const double *> data(4);
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < data.size(); ++t)
+      threads.emplace_back([&ws, &data, t]() {
+        data[t] = ws->y(2).rawData().data();
+      });
+    for (auto &thread : threads)
+      thread.join();
+    for (const auto *y : data)
+      TS_ASSERT_EQUALS(y, ws->rowY(2))
+    TS_ASSERT_EQUALS(ws->rowY(2)[1], 21.)
+  }
+};
+
+class ContiguousWorkspace2DTestPerformance : public CxxTest::TestSuite {
+public:
+  static ContiguousWorkspace2DTestPerformance *createSuite() {
+    return new ContiguousWorkspace2DTestPerformance();
+  }
+  static void destroySuite(ContiguousWorkspace2DTestPerformance *suite) {
+    delete suite;
+  }
+
+  void test_create_and_fill_many_spectra() {
+    ContiguousWorkspace2D ws;
+    ws.initialize(numberOfSpectra, 2, 1);
+    for (size_t i = 0; i < numberOfSpectra; ++i) {
+      ws.mutableRowY(i)[0] = static_cast<double>(i);
+      ws.mutableRowE(i)[0] = 1.;
+    }
+    TS_ASSERT(ws.allInBlocks())
+  }
+
+  void test_create_and_fill_many_spectra_in_a_Workspace2D() {
+    Workspace2D ws;
+    ws.initialize(numberOfSpectra, 2, 1);
+    for (size_t i = 0; i < numberOfSpectra; ++i) {
+      ws.mutableY(i)[0] = static_cast<double>(i);
+      ws.mutableE(i)[0] = 1.;
+    }
+  }
+
+private:
+  const size_t numberOfSpectra = 1000000;
+};
+
+#endif /* MANTID_DATAOBJECTS_CONTIGUOUSWORKSPACE2DTEST_H_ */
@@ -19,6 +19,7 @@
 
 #include <boost/scoped_ptr.hpp>
 #include <cmath>
+#include <set>
 
 using namespace Mantid;
 using namespace Mantid::API;
@@ -312,6 +313,33 @@ public:
   }
 
   //----------------------------------
+  void test_reserve_uses_the_current_event_type() {
+    EventList weighted;
+    weighted.switchTo(WEIGHTED);
+    weighted.reserve(100);
+    TS_ASSERT_LESS_THAN_EQUALS(100, weighted.getWeightedEvents().capacity());
+
+    EventList noTime;
+    noTime.switchTo(WEIGHTED_NOTIME);
+    noTime.reserve(100);
+    TS_ASSERT_LESS_THAN_EQUALS(100,
+                               noTime.getWeightedEventsNoTime().capacity());
+  }
+
+  void test_appending_to_weighted_events_grows_the_capacity_geometrically() {
+    EventList sum;
+    sum.switchTo(WEIGHTED);
+    const std::vector<TofEvent> run(10, TofEvent(1.0, 0));
+    std::set<size_t> capacities;
+    for (int i = 0; i < 100; ++i) {
+      sum += run;
+      capacities.insert(sum.getWeightedEvents().capacity());
+    }
+    TS_ASSERT_EQUALS(sum.getNumberEvents(), 1000);
+    // Reserving exactly the size needed would reallocate on every append
+    TS_ASSERT_LESS_THAN(capacities.size(), 20);
+  }
+
   void test_switchToWeightedEventsNoTime() {
     // Start with a bit of fake data
     this->fake_data();
@@ -799,6 +799,38 @@ public:
     TS_ASSERT_EQUALS(hist1.sharedE(), hist2.sharedE());
   }
 
+  void test_event_field_views() {
+    EventWorkspace_sptr ws =
+        WorkspaceCreationHelper::createRandomEventWorkspace(4, 2);
+    const auto &events = ws->getSpectrum(1).getEvents();
+    const auto tofs = EventWorkspace::tofView(ws, 1);
+    TS_ASSERT_EQUALS(tofs.workspace, ws);
+    TS_ASSERT_EQUALS(tofs.field.size, events.size());
+    TS_ASSERT_EQUALS(tofs.field.stride, sizeof(TofEvent));
+    for (size_t i = 0; i < events.size(); ++i) {
+      const auto *tof = reinterpret_cast<const double *>(
+          reinterpret_cast<const char *>(tofs.field.data) +
+          i * tofs.field.stride);
+      TS_ASSERT_EQUALS(*tof, events[i].tof());
+    }
+    const auto weights = EventWorkspace::weightView(ws, 1);
+    TS_ASSERT_EQUALS(weights.field.size, events.size());
+    TS_ASSERT_EQUALS(weights.field.stride, 0);
+    TS_ASSERT_EQUALS(*weights.field.data, 1.f);
+    TS_ASSERT_THROWS(EventWorkspace::pulseTimeView(ws, 2),
+                     const std::range_error &);
+  }
+
+  void test_event_field_view_keeps_the_workspace_alive() {
+    EventWorkspace_sptr ws =
+        WorkspaceCreationHelper::createRandomEventWorkspace(4, 1);
+    const double firstTof = ws->getSpectrum(0).getEvents().front().tof();
+    const auto tofs = EventWorkspace::tofView(ws, 0);
+    ws.reset();
+    TS_ASSERT_EQUALS(tofs.workspace.use_count(), 1);
+    TS_ASSERT_EQUALS(*tofs.field.data, firstTof);
+  }
+
   void test_clearing_EventList_clears_MRU() {
     auto ws = WorkspaceCreationHelper::createRandomEventWorkspace(2, 1);
     auto y = ws->sharedY(0);
@@ -0,0 +1,181 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_DATAOBJECTS_FILEBACKEDWORKSPACE2DTEST_H_
+#define MANTID_DATAOBJECTS_FILEBACKEDWORKSPACE2DTEST_H_
+
+#include "MantidDataObjects/FileBackedWorkspace2D.h"
+#include "MantidTestHelpers/NexusTestHelper.h"
+
+#include <cxxtest/TestSuite.h>
+#include <nexus/NeXusFile.hpp>
+#include <thread>
+
+using namespace Mantid::DataObjects;
+
+namespace {
+constexpr int NUMBER_OF_SPECTRA = 5;
+constexpr int NUMBER_OF_BINS = 3;
+
+/// The value stored in the file for bin j of row i of a field
+double fileValue(const size_t row, const size_t bin, const double field) {
+  return field + 10. * static_cast<double>(row) + static_cast<double>(bin);
+}
+
+/// Writes a minimal processed file with values, errors and xerrors datasets
+void writeFile(NexusTestHelper &helper) {
+  helper.createFile("FileBackedWorkspace2DTest.nxs");
+  helper.file->makeGroup("workspace", "NXdata", true);
+  const std::vector<int> dims{NUMBER_OF_SPECTRA, NUMBER_OF_BINS};
+  auto field = [](const double offset) {
+    std::vector<double> values;
+    for (size_t i = 0; i < NUMBER_OF_SPECTRA; ++i)
+      for (size_t j = 0; j < NUMBER_OF_BINS; ++j)
+        values.push_back(fileValue(i, j, offset));
+    return values;
+  };
+  helper.file->writeData("values", field(0.), dims);
+  helper.file->writeData("errors", field(0.5), dims);
+  helper.file->writeData("xerrors", field(0.25), dims);
+  helper.file->closeGroup();
+  helper.file->close();
+}
+
+/// A workspace with the spectra in reverse order of the rows in the file
+std::unique_ptr<FileBackedWorkspace2D>
+createWorkspace(const std::string &filename, const size_t budget = 0) {
+  auto ws = std::make_unique<FileBackedWorkspace2D>(filename, "/test_entry",
+                                                    budget);
+  ws->initialize(NUMBER_OF_SPECTRA, NUMBER_OF_BINS + 1, NUMBER_OF_BINS);
+  std::vector<size_t> rows;
+  for (size_t i = 0; i < NUMBER_OF_SPECTRA; ++i)
+    rows.push_back(NUMBER_OF_SPECTRA - 1 - i);
+  ws->loadSpectraOnAccess(rows);
+  return ws;
+}
+} // namespace
+
+class FileBackedWorkspace2DTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static FileBackedWorkspace2DTest *createSuite() {
+    return new FileBackedWorkspace2DTest();
+  }
+  static void destroySuite(FileBackedWorkspace2DTest *suite) { delete suite; }
+
+  FileBackedWorkspace2DTest() { writeFile(m_file); }
+
+  void test_spectra_are_read_on_first_access() {
+    auto ws = createWorkspace(m_file.filename);
+    TS_ASSERT_EQUALS(ws->id(), "Workspace2D")
+    TS_ASSERT_EQUALS(ws->getNumberHistograms(), NUMBER_OF_SPECTRA)
+    TS_ASSERT_EQUALS(ws->blocksize(), NUMBER_OF_BINS)
+    TS_ASSERT_EQUALS(ws->residentSpectra(), 0)
+
+    const auto &y = ws->y(1);
+    TS_ASSERT_EQUALS(ws->residentSpectra(), 1)
+    for (size_t j = 0; j < NUMBER_OF_BINS; ++j) {
+      TS_ASSERT_EQUALS(y[j], fileValue(3, j, 0.))
+      TS_ASSERT_EQUALS(ws->e(1)[j], fileValue(3, j, 0.5))
+      TS_ASSERT_EQUALS(ws->dx(1)[j], fileValue(3, j, 0.25))
+    }
+    TS_ASSERT_EQUALS(ws->readY(4)[0], fileValue(0, 0, 0.))
+    TS_ASSERT_EQUALS(ws->residentSpectra(), 2)
+  }
+
+  void test_reading_x_does_not_read_the_data() {
+    auto ws = createWorkspace(m_file.filename);
+    const auto &constWs = *ws;
+    for (size_t i = 0; i < NUMBER_OF_SPECTRA; ++i) {
+      TS_ASSERT_EQUALS(constWs.x(i).size(), NUMBER_OF_BINS + 1)
+      TS_ASSERT_EQUALS(constWs.readX(i).size(), NUMBER_OF_BINS + 1)
+      TS_ASSERT_EQUALS(constWs.binEdges(i).size(), NUMBER_OF_BINS + 1)
+      TS_ASSERT(constWs.sharedX(i))
+    }
+    TS_ASSERT_EQUALS(ws->residentSpectra(), 0)
+  }
+
+  void test_least_recently_used_spectra_are_evicted() {
+    auto ws = createWorkspace(m_file.filename, 2);
+    TS_ASSERT_EQUALS(ws->maxResidentSpectra(), 2)
+    for (size_t i = 0; i < NUMBER_OF_SPECTRA; ++i) {
+      TS_ASSERT_EQUALS(ws->y(i)[2], fileValue(NUMBER_OF_SPECTRA - 1 - i, 2, 0.))
+      TS_ASSERT_LESS_THAN_EQUALS(ws->residentSpectra(), 2)
+    }
+    // Spectrum 0 was evicted and is read again
+    TS_ASSERT_EQUALS(ws->e(0)[1], fileValue(NUMBER_OF_SPECTRA - 1, 1, 0.5))
+    TS_ASSERT_EQUALS(ws->residentSpectra(), 2)
+  }
+
+  void test_spectrum_last_accessed_by_a_thread_is_not_evicted() {
+    auto ws = createWorkspace(m_file.filename, 1);
+    const double *held = nullptr;
+    std::thread other([&ws, &held]() { held = &ws->y(0)[0]; });
+    other.join();
+    for (size_t i = 1; i < NUMBER_OF_SPECTRA; ++i)
+      ws->y(i);
+    // The spectrum of the other thread and the one accessed last here
+    TS_ASSERT_EQUALS(ws->residentSpectra(), 2)
+    TS_ASSERT_EQUALS(&ws->y(0)[0], held)
+    TS_ASSERT_EQUALS(*held, fileValue(NUMBER_OF_SPECTRA - 1, 0, 0.))
+  }
+
+  void test_modified_spectra_are_not_evicted() {
+    auto ws = createWorkspace(m_file.filename, 1);
+    ws->mutableY(2)[0] = -1.;
+    for (size_t i = 0; i < NUMBER_OF_SPECTRA; ++i)
+      ws->y(i);
+    TS_ASSERT_EQUALS(ws->y(2)[0], -1.)
+    TS_ASSERT_EQUALS(ws->y(2)[1], fileValue(2, 1, 0.))
+    // The modified spectrum and the most recently used one
+    TS_ASSERT_EQUALS(ws->residentSpectra(), 2)
+  }
+
+  void test_load_all_keeps_everything_in_memory() {
+    auto ws = createWorkspace(m_file.filename, 1);
+    ws->loadAll();
+    TS_ASSERT_EQUALS(ws->residentSpectra(), NUMBER_OF_SPECTRA)
+    for (size_t i = 0; i < NUMBER_OF_SPECTRA; ++i)
+      TS_ASSERT_EQUALS(ws->y(i)[1], fileValue(NUMBER_OF_SPECTRA - 1 - i, 1, 0.))
+    TS_ASSERT_EQUALS(ws->residentSpectra(), NUMBER_OF_SPECTRA)
+  }
+
+  void test_modified_spectra_are_kept() {
+    auto ws = createWorkspace(m_file.filename);
+    auto &y = ws->mutableY(2);
+    y[0] = -1.;
+    for (size_t i = 0; i < NUMBER_OF_SPECTRA; ++i)
+      ws->y(i);
+    TS_ASSERT_EQUALS(ws->residentSpectra(), NUMBER_OF_SPECTRA)
+    // References handed out earlier stay valid
+    TS_ASSERT_EQUALS(&ws->y(2)[0], &y[0])
+    TS_ASSERT_EQUALS(ws->y(2)[0], -1.)
+    TS_ASSERT_EQUALS(ws->y(2)[1], fileValue(2, 1, 0.))
+  }
+
+  void test_clone_holds_all_the_data() {
+    auto ws = createWorkspace(m_file.filename, 1);
+    ws->mutableE(0)[0] = -1.;
+    auto clone = ws->clone();
+    TS_ASSERT(!dynamic_cast<FileBackedWorkspace2D *>(clone.get()))
+    TS_ASSERT_EQUALS(clone->e(0)[0], -1.)
+    for (size_t i = 1; i < NUMBER_OF_SPECTRA; ++i)
+      TS_ASSERT_EQUALS(clone->y(i)[0],
+                       fileValue(NUMBER_OF_SPECTRA - 1 - i, 0, 0.))
+  }
+
+  void test_wrong_number_of_file_indices_throws() {
+    FileBackedWorkspace2D ws(m_file.filename, "/test_entry");
+    ws.initialize(2, 2, 1);
+    TS_ASSERT_THROWS(ws.loadSpectraOnAccess({0}), const std::invalid_argument &)
+  }
+
+private:
+  NexusTestHelper m_file;
+};
+
+#endif /* MANTID_DATAOBJECTS_FILEBACKEDWORKSPACE2DTEST_H_ */
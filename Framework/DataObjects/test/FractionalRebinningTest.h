@@ -0,0 +1,127 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_DATAOBJECTS_FRACTIONALREBINNINGTEST_H_
+#define MANTID_DATAOBJECTS_FRACTIONALREBINNINGTEST_H_
+
+#include "MantidDataObjects/FractionalRebinning.h"
+#include "MantidKernel/MultiThreaded.h"
+#include "MantidTestHelpers/WorkspaceCreationHelper.h"
+
+#include <cxxtest/TestSuite.h>
+
+using namespace Mantid::API;
+using namespace Mantid::DataObjects;
+using namespace Mantid::DataObjects::FractionalRebinning;
+using Mantid::Geometry::Quadrilateral;
+using Mantid::Kernel::V2D;
+
+namespace {
+const std::vector<double> OUTPUT_X{0., 1.5, 3., 4.};
+const std::vector<double> OUTPUT_Y{0., 0.5, 1.7, 3.};
+
+RebinnedOutput_sptr createOutput() {
+  auto ws = boost::make_shared<RebinnedOutput>();
+  ws->initialize(OUTPUT_Y.size() - 1, OUTPUT_X.size(), OUTPUT_X.size() - 1);
+  for (size_t i = 0; i < ws->getNumberHistograms(); ++i)
+    ws->mutableX(i) = OUTPUT_X;
+  return ws;
+}
+
+/// The polygon of bin j of spectrum i. Odd spectra are sheared in y.
+Quadrilateral inputPolygon(const size_t i, const size_t j) {
+  const double x0 = static_cast<double>(j);
+  const double y0 = static_cast<double>(i);
+  if (i % 2 == 0)
+    return Quadrilateral(x0, x0 + 1., y0, y0 + 1.);
+  const double shear = 0.1;
+  return Quadrilateral(V2D(x0, y0 + shear * x0),
+                       V2D(x0 + 1., y0 + shear * (x0 + 1.)),
+                       V2D(x0 + 1., y0 + 1. + shear * (x0 + 1.)),
+                       V2D(x0, y0 + 1. + shear * x0));
+}
+} // namespace
+
+class FractionalRebinningTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static FractionalRebinningTest *createSuite() {
+    return new FractionalRebinningTest();
+  }
+  static void destroySuite(FractionalRebinningTest *suite) { delete suite; }
+
+  void test_partial_sums_match_rebinning_to_the_workspace() {
+    MatrixWorkspace_const_sptr input =
+        WorkspaceCreationHelper::create2DWorkspaceBinned(3, 4, 0., 1.);
+    auto direct = createOutput();
+    auto summed = createOutput();
+    // Two threads, each taking every other spectrum
+    std::vector<PartialSums> sums(
+        2,
+        PartialSums(summed->getNumberHistograms(), summed->blocksize(), true));
+    for (size_t i = 0; i < input->getNumberHistograms(); ++i) {
+      for (size_t j = 0; j < input->blocksize(); ++j) {
+        rebinToFractionalOutput(inputPolygon(i, j), input, i, j, *direct,
+                                OUTPUT_Y);
+        rebinToFractionalOutput(inputPolygon(i, j), input, i, j, sums[i % 2],
+                                OUTPUT_X, OUTPUT_Y);
+      }
+    }
+    addToOutput(sums, *summed);
+
+    double total = 0.;
+    for (size_t i = 0; i < direct->getNumberHistograms(); ++i) {
+      for (size_t j = 0; j < direct->blocksize(); ++j) {
+        TS_ASSERT_DELTA(summed->y(i)[j], direct->y(i)[j], 1e-12)
+        TS_ASSERT_DELTA(summed->e(i)[j], direct->e(i)[j], 1e-12)
+        TS_ASSERT_DELTA(summed->dataF(i)[j], direct->dataF(i)[j], 1e-12)
+        total += summed->y(i)[j];
+      }
+    }
+    // All of the input lies on the grid, so the signal is conserved
+    TS_ASSERT_DELTA(total, 12. * 2., 1e-12)
+  }
+
+  void test_partial_sums_without_fractions() {
+    MatrixWorkspace_const_sptr input =
+        WorkspaceCreationHelper::create2DWorkspaceBinned(2, 4, 0., 1.);
+    auto output =
+        WorkspaceCreationHelper::create2DWorkspaceBinned(3, 3, 0., 1.);
+    for (size_t i = 0; i < output->getNumberHistograms(); ++i)
+      output->mutableX(i) = OUTPUT_X;
+    std::vector<PartialSums> sums(
+        1,
+        PartialSums(output->getNumberHistograms(), output->blocksize(), false));
+    for (size_t i = 0; i < output->getNumberHistograms(); ++i) {
+      output->mutableY(i) = 0.;
+      output->mutableE(i) = 0.;
+    }
+    rebinToOutput(Quadrilateral(1., 2., 0., 1.), input, 0, 1, sums.front(),
+                  OUTPUT_X, OUTPUT_Y);
+    addToOutput(sums, *output);
+
+    // Bin 1 of spectrum 0 holds 2 +- sqrt(2) and is split 1:1 in x and
+    // 1:1 in y
+    TS_ASSERT_DELTA(output->y(0)[0], 0.5, 1e-12)
+    TS_ASSERT_DELTA(output->y(0)[1], 0.5, 1e-12)
+    TS_ASSERT_DELTA(output->y(1)[0], 0.5, 1e-12)
+    TS_ASSERT_DELTA(output->y(1)[1], 0.5, 1e-12)
+    TS_ASSERT_DELTA(output->e(1)[1], 0.5, 1e-12)
+    TS_ASSERT_EQUALS(output->y(2)[0], 0.)
+    // No fractional weights are held
+    TS_ASSERT(sums.front().weight().empty())
+  }
+
+  void test_number_of_partial_sums_is_limited_by_the_threads() {
+    auto output = createOutput();
+    const int numThreads = numberOfPartialSums(*output, true);
+    TS_ASSERT_LESS_THAN_EQUALS(1, numThreads)
+    TS_ASSERT_LESS_THAN_EQUALS(numThreads, PARALLEL_GET_MAX_THREADS)
+  }
+};
+
+#endif /* MANTID_DATAOBJECTS_FRACTIONALREBINNINGTEST_H_ */
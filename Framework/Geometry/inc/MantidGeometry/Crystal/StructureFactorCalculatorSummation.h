@@ -20,6 +20,13 @@ namespace Geometry {
   the unit cell by combining the space group and the scatterers located in the
   asymmetric unit (both taken from CrystalStructure) and stores them.
 
+  If all scatterers are isotropic atoms, their positions and scattering
+  parameters are additionally stored as flat arrays (one entry per atom in the
+  unit cell), so that structure factors of many reflections can be calculated
+  without going through the scatterer objects. This is used by getF() and by
+  the batched getFs() and getFsSquared(), which evaluate the reflections in
+  parallel.
+
       @author Michael Wedel, ESS
       @date 05/09/2015
 */
@@ -29,6 +36,11 @@ public:
   StructureFactorCalculatorSummation();
   StructureFactor getF(const Kernel::V3D &hkl) const override;
 
+  std::vector<StructureFactor>
+  getFs(const std::vector<Kernel::V3D> &hkls) const override;
+  std::vector<double>
+  getFsSquared(const std::vector<Kernel::V3D> &hkls) const override;
+
 protected:
   void
   crystalStructureSetHook(const CrystalStructure &crystalStructure) override;
@@ -36,7 +48,25 @@ protected:
   void updateUnitCellScatterers(const CrystalStructure &crystalStructure);
   std::string getV3DasString(const Kernel::V3D &point) const;
 
+  StructureFactor getFFromAtomArrays(const Kernel::V3D &hkl) const;
+
   CompositeBraggScatterer_sptr m_unitCellScatterers;
+
+  /// True if the atom arrays below describe all scatterers
+  bool m_hasAtomArrays;
+  /// Fractional coordinates of all atoms in the unit cell
+  std::vector<double> m_atomX;
+  std::vector<double> m_atomY;
+  std::vector<double> m_atomZ;
+  /// Atoms of the unit cell generated from the i-th atom of the asymmetric
+  /// unit are [m_siteOffsets[i], m_siteOffsets[i + 1])
+  std::vector<size_t> m_siteOffsets;
+  /// Occupancy times scattering length of each atom in the asymmetric unit
+  std::vector<double> m_siteAmplitudes;
+  /// Isotropic displacement parameter of each atom in the asymmetric unit
+  std::vector<double> m_siteU;
+  /// B-matrix of the unit cell of each atom in the asymmetric unit
+  std::vector<Kernel::DblMatrix> m_siteB;
 };
 
 using StructureFactorSummation_sptr =
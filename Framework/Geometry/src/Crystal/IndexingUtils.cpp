@@ -7,6 +7,7 @@
 #include "MantidGeometry/Crystal/IndexingUtils.h"
 #include "MantidGeometry/Crystal/NiggliCell.h"
 #include "MantidKernel/EigenConversionHelpers.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/Quat.h"
 
 #include <boost/math/special_functions/round.hpp>
@@ -21,6 +22,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <exception>
 
 using namespace Mantid::Geometry;
 using Mantid::Kernel::DblMatrix;
@@ -31,6 +33,105 @@ using Mantid::Kernel::V3D;
 namespace {
 const constexpr double DEG_TO_RAD = M_PI / 180.;
 const constexpr double RAD_TO_DEG = 180. / M_PI;
+
+/// Returns the q_vectors divided by 2 pi, as used for the direction scans.
+std::vector<V3D> getScaledQs(const std::vector<V3D> &q_vectors) {
+  std::vector<V3D> scaled_qs;
+  scaled_qs.reserve(q_vectors.size());
+  for (const auto &q_vector : q_vectors) {
+    scaled_qs.push_back(q_vector / (2.0 * M_PI));
+  }
+  return scaled_qs;
+}
+
+/// True if the projection of q_vec on dir is within tolerance of an integer.
+inline bool indexesPeak(const V3D &dir, const V3D &q_vec, double tolerance) {
+  const double dot_prod = dir.scalar_prod(q_vec);
+  return fabs(dot_prod - std::round(dot_prod)) <= tolerance;
+}
+
+/// Candidate edge vectors from a direction scan, tagged with their position
+/// in the serial scan order.
+struct ScanCandidate {
+  size_t order;
+  V3D a_dir;
+  V3D b_dir;
+  V3D c_dir;
+};
+
+/**
+  Keeps the candidates of a scan that index the largest number of peaks.
+  In a parallel scan each thread fills its own list, mergeBestCandidates()
+  then selects the same candidates, in the same order, as a serial scan.
+ */
+class BestScanCandidates {
+public:
+  void add(int num_indexed, const ScanCandidate &candidate) {
+    if (num_indexed > m_max_indexed) {
+      m_candidates.clear();
+      m_max_indexed = num_indexed;
+    }
+    if (num_indexed == m_max_indexed) {
+      m_candidates.push_back(candidate);
+    }
+  }
+
+  int maxIndexed() const { return m_max_indexed; }
+  const std::vector<ScanCandidate> &candidates() const { return m_candidates; }
+
+private:
+  int m_max_indexed = 0;
+  std::vector<ScanCandidate> m_candidates;
+};
+
+/// Merges the per-thread candidate lists, returns the candidates indexing
+/// max_indexed peaks in scan order.
+std::vector<ScanCandidate>
+mergeBestCandidates(const std::vector<BestScanCandidates> &per_thread,
+                    int &max_indexed) {
+  max_indexed = 0;
+  for (const auto &best : per_thread) {
+    max_indexed = std::max(max_indexed, best.maxIndexed());
+  }
+
+  std::vector<ScanCandidate> merged;
+  for (const auto &best : per_thread) {
+    if (best.maxIndexed() == max_indexed) {
+      merged.insert(merged.end(), best.candidates().begin(),
+                    best.candidates().end());
+    }
+  }
+
+  std::sort(merged.begin(), merged.end(),
+            [](const ScanCandidate &lhs, const ScanCandidate &rhs) {
+              return lhs.order < rhs.order;
+            });
+  return merged;
+}
+
+/// Rethrows the first captured exception, if any.
+void rethrowFirst(const std::vector<std::exception_ptr> &exceptions) {
+  for (const auto &exception : exceptions) {
+    if (exception) {
+      std::rethrow_exception(exception);
+    }
+  }
+}
+
+/// Number of peaks indexed by each of the directions, evaluated in parallel.
+std::vector<int> numberIndexed1D(const std::vector<V3D> &directions,
+                                 const std::vector<V3D> &q_vectors,
+                                 double required_tolerance) {
+  std::vector<int> num_indexed(directions.size());
+  const auto num_dirs = static_cast<int64_t>(directions.size());
+
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int64_t i = 0; i < num_dirs; i++) {
+    num_indexed[i] = IndexingUtils::NumberIndexed_1D(directions[i], q_vectors,
+                                                     required_tolerance);
+  }
+  return num_indexed;
+}
 } // namespace
 
 /**
@@ -1224,8 +1325,6 @@ double IndexingUtils::ScanFor_UB(DblMatrix &UB,
   std::vector<V3D> a_dir_list =
       MakeHemisphereDirections(boost::numeric_cast<int>(num_a_steps));
 
-  std::vector<V3D> b_dir_list;
-
   V3D a_dir_temp;
   V3D b_dir_temp;
   V3D c_dir_temp;
@@ -1236,74 +1335,55 @@ double IndexingUtils::ScanFor_UB(DblMatrix &UB,
   int max_indexed = 0;
   V3D q_vec;
   // first select those directions
-  // that index the most peaks
-  std::vector<V3D> selected_a_dirs;
-  std::vector<V3D> selected_b_dirs;
-  std::vector<V3D> selected_c_dirs;
-
-  for (auto &a_dir_num : a_dir_list) {
-    a_dir_temp = a_dir_num;
-    a_dir_temp = V3D(a_dir_temp);
-    a_dir_temp *= a;
-
-    b_dir_list = MakeCircleDirections(boost::numeric_cast<int>(num_b_steps),
-                                      a_dir_temp, gamma_degrees);
-
-    for (auto &b_dir_num : b_dir_list) {
-      b_dir_temp = b_dir_num;
-      b_dir_temp = V3D(b_dir_temp);
-      b_dir_temp *= b;
-      c_dir_temp = makeCDir(a_dir_temp, b_dir_temp, c, cosAlpha, cosBeta,
-                            cosGamma, sinGamma);
-      int num_indexed = 0;
-      for (const auto &q_vector : q_vectors) {
-        bool indexes_peak = true;
-        q_vec = q_vector / (2.0 * M_PI);
-        dot_prod = a_dir_temp.scalar_prod(q_vec);
-        nearest_int = std::round(dot_prod);
-        error = fabs(dot_prod - nearest_int);
-        if (error > required_tolerance)
-          indexes_peak = false;
-        else {
-          dot_prod = b_dir_temp.scalar_prod(q_vec);
-          nearest_int = std::round(dot_prod);
-          error = fabs(dot_prod - nearest_int);
-          if (error > required_tolerance)
-            indexes_peak = false;
-          else {
-            dot_prod = c_dir_temp.scalar_prod(q_vec);
-            nearest_int = std::round(dot_prod);
-            error = fabs(dot_prod - nearest_int);
-            if (error > required_tolerance)
-              indexes_peak = false;
-          }
+  // that index the most peaks. The a
+  // directions are scanned in parallel,
+  // each thread keeping its own best list
+  const std::vector<V3D> scaled_qs = getScaledQs(q_vectors);
+  std::vector<BestScanCandidates> best_per_thread(PARALLEL_GET_MAX_THREADS);
+  std::vector<std::exception_ptr> exceptions(a_dir_list.size());
+  const auto num_a_dirs = static_cast<int64_t>(a_dir_list.size());
+
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int64_t a_num = 0; a_num < num_a_dirs; a_num++) {
+    try {
+      auto &best = best_per_thread[PARALLEL_THREAD_NUMBER];
+      const V3D a_dir_scan = a_dir_list[a_num] * a;
+
+      const std::vector<V3D> b_dir_list = MakeCircleDirections(
+          boost::numeric_cast<int>(num_b_steps), a_dir_scan, gamma_degrees);
+
+      for (size_t b_num = 0; b_num < b_dir_list.size(); b_num++) {
+        const V3D b_dir_scan = b_dir_list[b_num] * b;
+        const V3D c_dir_scan = makeCDir(a_dir_scan, b_dir_scan, c, cosAlpha,
+                                        cosBeta, cosGamma, sinGamma);
+        int num_indexed = 0;
+        for (const auto &scaled_q : scaled_qs) {
+          if (indexesPeak(a_dir_scan, scaled_q, required_tolerance) &&
+              indexesPeak(b_dir_scan, scaled_q, required_tolerance) &&
+              indexesPeak(c_dir_scan, scaled_q, required_tolerance))
+            num_indexed++;
         }
-        if (indexes_peak)
-          num_indexed++;
-      }
 
-      if (num_indexed > max_indexed) // only keep those directions that
-      {                              // index the max number of peaks
-        selected_a_dirs.clear();
-        selected_b_dirs.clear();
-        selected_c_dirs.clear();
-        max_indexed = num_indexed;
-      }
-      if (num_indexed == max_indexed) {
-        selected_a_dirs.push_back(a_dir_temp);
-        selected_b_dirs.push_back(b_dir_temp);
-        selected_c_dirs.push_back(c_dir_temp);
+        const size_t order = static_cast<size_t>(a_num) * b_dir_list.size() +
+                             b_num;
+        best.add(num_indexed, {order, a_dir_scan, b_dir_scan, c_dir_scan});
       }
+    } catch (...) {
+      exceptions[a_num] = std::current_exception();
     }
   }
+  rethrowFirst(exceptions);
+
+  const std::vector<ScanCandidate> selected =
+      mergeBestCandidates(best_per_thread, max_indexed);
   // now, for each such direction, find
   // the one that indexes closes to
   // integer values
   double min_error = 1.0e50;
-  for (size_t dir_num = 0; dir_num < selected_a_dirs.size(); dir_num++) {
-    a_dir_temp = selected_a_dirs[dir_num];
-    b_dir_temp = selected_b_dirs[dir_num];
-    c_dir_temp = selected_c_dirs[dir_num];
+  for (const auto &candidate : selected) {
+    a_dir_temp = candidate.a_dir;
+    b_dir_temp = candidate.b_dir;
+    c_dir_temp = candidate.c_dir;
 
     double sum_sq_error = 0.0;
     for (const auto &q_vector : q_vectors) {
@@ -1368,12 +1448,7 @@ size_t IndexingUtils::ScanFor_Directions(std::vector<V3D> &directions,
                                          double min_d, double max_d,
                                          double required_tolerance,
                                          double degrees_per_step) {
-  double error;
-  double fit_error;
-  double dot_prod;
-  double nearest_int;
   int max_indexed = 0;
-  V3D q_vec;
   // first, make hemisphere of possible directions
   // with specified resolution.
   int num_steps = boost::math::iround(90.0 / degrees_per_step);
@@ -1386,52 +1461,67 @@ size_t IndexingUtils::ScanFor_Directions(std::vector<V3D> &directions,
   double delta_d = 0.1f;
   int n_steps = boost::math::iround(1.0 + (max_d - min_d) / delta_d);
 
-  std::vector<V3D> selected_dirs;
-  V3D dir_temp;
+  const std::vector<V3D> scaled_qs = getScaledQs(q_vectors);
+  std::vector<BestScanCandidates> best_per_thread(PARALLEL_GET_MAX_THREADS);
+  const auto num_dirs = static_cast<int64_t>(full_list.size());
 
-  for (const auto &current_dir : full_list) {
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int64_t dir_num = 0; dir_num < num_dirs; dir_num++) {
+    auto &best = best_per_thread[PARALLEL_THREAD_NUMBER];
     for (int step = 0; step <= n_steps; step++) {
-      dir_temp = current_dir;
-      dir_temp *= (min_d + step * delta_d); // increasing size
+      V3D dir_scan = full_list[dir_num];
+      dir_scan *= (min_d + step * delta_d); // increasing size
 
       int num_indexed = 0;
-      for (const auto &q_vector : q_vectors) {
-        q_vec = q_vector / (2.0 * M_PI);
-        dot_prod = dir_temp.scalar_prod(q_vec);
-        nearest_int = std::round(dot_prod);
-        error = fabs(dot_prod - nearest_int);
-        if (error <= required_tolerance)
+      for (const auto &scaled_q : scaled_qs) {
+        if (indexesPeak(dir_scan, scaled_q, required_tolerance))
           num_indexed++;
       }
 
-      if (num_indexed > max_indexed) // only keep those directions that
-      {                              // index the max number of peaks
-        selected_dirs.clear();
-        max_indexed = num_indexed;
-      }
-      if (num_indexed >= max_indexed) {
-        selected_dirs.emplace_back(dir_temp);
-      }
+      const size_t order = static_cast<size_t>(dir_num) * (n_steps + 1) + step;
+      best.add(num_indexed, {order, dir_scan, V3D(), V3D()});
     }
   }
+
+  // only keep those directions that
+  // index the max number of peaks
+  const std::vector<ScanCandidate> selected_dirs =
+      mergeBestCandidates(best_per_thread, max_indexed);
+
   // Now, optimize each direction and discard possible
   // unit cell edges that are duplicates, putting the
   // new smaller list in the vector "directions"
-  std::vector<int> index_vals;
-  std::vector<V3D> indexed_qs;
-  index_vals.reserve(q_vectors.size());
-  indexed_qs.reserve(q_vectors.size());
+  std::vector<V3D> optimized_dirs(selected_dirs.size());
+  std::vector<std::exception_ptr> exceptions(selected_dirs.size());
+  const auto num_selected = static_cast<int64_t>(selected_dirs.size());
+
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int64_t i = 0; i < num_selected; i++) {
+    try {
+      std::vector<int> index_vals;
+      std::vector<V3D> indexed_qs;
+      double fit_error;
+      V3D optimized_dir = selected_dirs[i].a_dir;
+
+      GetIndexedPeaks_1D(optimized_dir, q_vectors, required_tolerance,
+                         index_vals, indexed_qs, fit_error);
+
+      Optimize_Direction(optimized_dir, index_vals, indexed_qs);
+      optimized_dirs[i] = optimized_dir;
+    } catch (...) {
+      exceptions[i] = std::current_exception();
+    }
+  }
 
   directions.clear();
   V3D current_dir;
+  V3D dir_temp;
   V3D diff;
-  for (auto &selected_dir : selected_dirs) {
-    current_dir = selected_dir;
-
-    GetIndexedPeaks_1D(current_dir, q_vectors, required_tolerance, index_vals,
-                       indexed_qs, fit_error);
-
-    Optimize_Direction(current_dir, index_vals, indexed_qs);
+  for (size_t i = 0; i < optimized_dirs.size(); i++) {
+    if (exceptions[i]) {
+      std::rethrow_exception(exceptions[i]);
+    }
+    current_dir = optimized_dirs[i];
 
     double length = current_dir.norm();
     if (length >= min_d && length <= max_d) // only keep if within range
@@ -1493,7 +1583,6 @@ size_t IndexingUtils::FFTScanFor_Directions(std::vector<V3D> &directions,
   constexpr size_t N_FFT_STEPS = 512;
   constexpr size_t HALF_FFT_STEPS = 256;
 
-  double fit_error;
   int max_indexed = 0;
 
   // first, make hemisphere of possible directions
@@ -1518,17 +1607,18 @@ size_t IndexingUtils::FFTScanFor_Directions(std::vector<V3D> &directions,
   std::vector<double> max_fft_val;
   max_fft_val.resize(full_list.size());
 
-  double projections[N_FFT_STEPS];
-  double magnitude_fft[HALF_FFT_STEPS];
-
   double index_factor = N_FFT_STEPS / max_mag_Q; // maps |proj Q| to index
 
-  for (size_t dir_num = 0; dir_num < full_list.size(); dir_num++) {
-    V3D current_dir = full_list[dir_num];
-    max_mag_fft = GetMagFFT(q_vectors, current_dir, N_FFT_STEPS, projections,
-                            index_factor, magnitude_fft);
+  // each thread projects and transforms into its own buffers
+  const auto num_dirs = static_cast<int64_t>(full_list.size());
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int64_t dir_num = 0; dir_num < num_dirs; dir_num++) {
+    double projections[N_FFT_STEPS];
+    double magnitude_fft[HALF_FFT_STEPS];
 
-    max_fft_val[dir_num] = max_mag_fft;
+    max_fft_val[dir_num] =
+        GetMagFFT(q_vectors, full_list[dir_num], N_FFT_STEPS, projections,
+                  index_factor, magnitude_fft);
   }
   // find the directions with the 500 largest
   // fft values, and place them in temp_dirs vector
@@ -1562,32 +1652,40 @@ size_t IndexingUtils::FFTScanFor_Directions(std::vector<V3D> &directions,
   // FFT to find the cell edge length that
   // corresponds to the max_mag_fft.  Only keep
   // directions with length nearly in bounds
-  V3D temp;
-  std::vector<V3D> temp_dirs_2;
+  std::vector<double> d_vals(temp_dirs.size(), 0.0);
+  const auto num_temp_dirs = static_cast<int64_t>(temp_dirs.size());
 
-  for (auto &temp_dir : temp_dirs) {
-    GetMagFFT(q_vectors, temp_dir, N_FFT_STEPS, projections, index_factor,
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int64_t i = 0; i < num_temp_dirs; i++) {
+    double projections[N_FFT_STEPS];
+    double magnitude_fft[HALF_FFT_STEPS];
+
+    GetMagFFT(q_vectors, temp_dirs[i], N_FFT_STEPS, projections, index_factor,
               magnitude_fft);
 
     double position =
         GetFirstMaxIndex(magnitude_fft, HALF_FFT_STEPS, threshold);
     if (position > 0) {
       double q_val = max_mag_Q / position;
-      double d_val = 1 / q_val;
-      if (d_val >= 0.8 * min_d && d_val <= 1.2 * max_d) {
-        temp = temp_dir * d_val;
-        temp_dirs_2.push_back(temp);
-      }
+      d_vals[i] = 1 / q_val;
+    }
+  }
+
+  V3D temp;
+  std::vector<V3D> temp_dirs_2;
+  for (size_t i = 0; i < temp_dirs.size(); i++) {
+    double d_val = d_vals[i];
+    if (d_val > 0 && d_val >= 0.8 * min_d && d_val <= 1.2 * max_d) {
+      temp = temp_dirs[i] * d_val;
+      temp_dirs_2.push_back(temp);
     }
   }
   // look at how many peaks were indexed
   // for each of the initial directions
+  std::vector<int> num_indexed_list =
+      numberIndexed1D(temp_dirs_2, q_vectors, required_tolerance);
   max_indexed = 0;
-  int num_indexed;
-  V3D current_dir;
-  for (auto &dir_num : temp_dirs_2) {
-    current_dir = dir_num;
-    num_indexed = NumberIndexed_1D(current_dir, q_vectors, required_tolerance);
+  for (const auto num_indexed : num_indexed_list) {
     if (num_indexed > max_indexed)
       max_indexed = num_indexed;
   }
@@ -1595,32 +1693,35 @@ size_t IndexingUtils::FFTScanFor_Directions(std::vector<V3D> &directions,
   // only keep original directions that index
   // at least 50% of max num indexed
   temp_dirs.clear();
-  for (auto &dir_num : temp_dirs_2) {
-    current_dir = dir_num;
-    num_indexed = NumberIndexed_1D(current_dir, q_vectors, required_tolerance);
-    if (num_indexed >= 0.50 * max_indexed)
-      temp_dirs.push_back(current_dir);
+  for (size_t i = 0; i < temp_dirs_2.size(); i++) {
+    if (num_indexed_list[i] >= 0.50 * max_indexed)
+      temp_dirs.push_back(temp_dirs_2[i]);
   }
   // refine directions and again find the
   // max number indexed, for the optimized
   // directions
-  max_indexed = 0;
-  std::vector<int> index_vals;
-  std::vector<V3D> indexed_qs;
-  for (auto &temp_dir : temp_dirs) {
-    num_indexed = GetIndexedPeaks_1D(temp_dir, q_vectors, required_tolerance,
-                                     index_vals, indexed_qs, fit_error);
+  std::vector<int> max_indexed_per_dir(temp_dirs.size(), 0);
+  const auto num_refined = static_cast<int64_t>(temp_dirs.size());
+
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int64_t i = 0; i < num_refined; i++) {
+    V3D &temp_dir = temp_dirs[i];
+    std::vector<int> index_vals;
+    std::vector<V3D> indexed_qs;
+    double dir_fit_error;
     try {
+      GetIndexedPeaks_1D(temp_dir, q_vectors, required_tolerance, index_vals,
+                         indexed_qs, dir_fit_error);
       int count = 0;
       while (count < 5) // 5 iterations should be enough for
       {                 // the optimization to stabilize
         Optimize_Direction(temp_dir, index_vals, indexed_qs);
 
-        num_indexed =
+        int num_indexed =
             GetIndexedPeaks_1D(temp_dir, q_vectors, required_tolerance,
-                               index_vals, indexed_qs, fit_error);
-        if (num_indexed > max_indexed)
-          max_indexed = num_indexed;
+                               index_vals, indexed_qs, dir_fit_error);
+        if (num_indexed > max_indexed_per_dir[i])
+          max_indexed_per_dir[i] = num_indexed;
 
         count++;
       }
@@ -1628,22 +1729,27 @@ size_t IndexingUtils::FFTScanFor_Directions(std::vector<V3D> &directions,
       // don't continue to refine if the direction fails to optimize properly
     }
   }
+
+  max_indexed = 0;
+  for (const auto num_indexed : max_indexed_per_dir) {
+    if (num_indexed > max_indexed)
+      max_indexed = num_indexed;
+  }
   // discard those with length out of bounds
   temp_dirs_2.clear();
-  for (auto &temp_dir : temp_dirs) {
-    current_dir = temp_dir;
-    double length = current_dir.norm();
+  for (const auto &temp_dir : temp_dirs) {
+    double length = temp_dir.norm();
     if (length >= 0.8 * min_d && length <= 1.2 * max_d)
-      temp_dirs_2.push_back(current_dir);
+      temp_dirs_2.push_back(temp_dir);
   }
   // only keep directions that index at
   // least 75% of the max number of peaks
+  num_indexed_list =
+      numberIndexed1D(temp_dirs_2, q_vectors, required_tolerance);
   temp_dirs.clear();
-  for (auto &dir_num : temp_dirs_2) {
-    current_dir = dir_num;
-    num_indexed = NumberIndexed_1D(current_dir, q_vectors, required_tolerance);
-    if (num_indexed > max_indexed * 0.75)
-      temp_dirs.push_back(current_dir);
+  for (size_t i = 0; i < temp_dirs_2.size(); i++) {
+    if (num_indexed_list[i] > max_indexed * 0.75)
+      temp_dirs.push_back(temp_dirs_2[i]);
   }
 
   std::sort(temp_dirs.begin(), temp_dirs.end(), V3D::compareMagnitude);
@@ -1912,36 +2018,51 @@ bool IndexingUtils::FormUB_From_abc_Vectors(DblMatrix &UB,
   V3D b_dir(0, 0, 0);
   V3D c_dir(0, 0, 0);
   V3D a_temp;
-  V3D b_temp;
-  V3D c_temp;
   V3D acrossb;
-  double vol;
 
-  for (size_t i = 0; i < directions.size() - 2; i++) {
-    a_temp = directions[i];
+  // Count the peaks indexed by every triple with a large enough volume in
+  // parallel, then select a,b,c in the original order, since the selection
+  // below depends on the order in which the triples are visited.
+  struct TripleCount {
+    size_t j;
+    size_t k;
+    int num_indexed;
+  };
+  const size_t num_a = directions.size() < 2 ? 0 : directions.size() - 2;
+  std::vector<std::vector<TripleCount>> counts(num_a);
+
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int64_t i = 0; i < static_cast<int64_t>(num_a); i++) {
+    const V3D &a_scan = directions[i];
     for (size_t j = i + 1; j < directions.size() - 1; j++) {
-      b_temp = directions[j];
-      acrossb = a_temp.cross_prod(b_temp);
+      const V3D &b_scan = directions[j];
+      const V3D a_cross_b = a_scan.cross_prod(b_scan);
       for (size_t k = j + 1; k < directions.size(); k++) {
-        c_temp = directions[k];
-        vol = fabs(acrossb.scalar_prod(c_temp));
-        if (vol > min_vol) {
-          const auto num_indexed = NumberIndexed_3D(a_temp, b_temp, c_temp,
-                                                    q_vectors, req_tolerance);
-
-          // Requiring 20% more indexed with longer edge lengths, favors
-          // the smaller unit cells.
-          if (num_indexed > 1.20 * max_indexed) {
-            max_indexed = num_indexed;
-            a_dir = a_temp;
-            b_dir = b_temp;
-            c_dir = c_temp;
-          }
+        const V3D &c_scan = directions[k];
+        if (fabs(a_cross_b.scalar_prod(c_scan)) > min_vol) {
+          counts[i].push_back(
+              {j, k,
+               NumberIndexed_3D(a_scan, b_scan, c_scan, q_vectors,
+                                req_tolerance)});
         }
       }
     }
   }
 
+  for (size_t i = 0; i < num_a; i++) {
+    a_temp = directions[i];
+    for (const auto &count : counts[i]) {
+      // Requiring 20% more indexed with longer edge lengths, favors
+      // the smaller unit cells.
+      if (count.num_indexed > 1.20 * max_indexed) {
+        max_indexed = count.num_indexed;
+        a_dir = a_temp;
+        b_dir = directions[count.j];
+        c_dir = directions[count.k];
+      }
+    }
+  }
+
   if (max_indexed <= 0) {
     return false;
   }
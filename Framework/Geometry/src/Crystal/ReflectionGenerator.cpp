@@ -8,6 +8,7 @@
 #include "MantidGeometry/Crystal/BasicHKLFilters.h"
 #include "MantidGeometry/Crystal/HKLGenerator.h"
 #include "MantidGeometry/Crystal/StructureFactorCalculatorSummation.h"
+#include "MantidKernel/MultiThreaded.h"
 
 namespace Mantid {
 namespace Geometry {
@@ -25,6 +26,44 @@ private:
   UnitCell m_cell;
 };
 
+namespace {
+/**
+ * Returns all HKLs produced by the generator that are allowed by the filter
+ *
+ * The filter is evaluated in parallel, which pays off mostly for expensive
+ * filters such as HKLFilterStructureFactor. The order of the generated HKLs is
+ * preserved.
+ *
+ * @param generator :: HKLGenerator to take the HKLs from.
+ * @param filter :: Filter that is applied to each HKL.
+ * @return :: The allowed HKLs.
+ */
+std::vector<V3D> getAllowedHKLs(const HKLGenerator &generator,
+                                const HKLFilter_const_sptr &filter) {
+  std::vector<V3D> candidates;
+  candidates.reserve(generator.size());
+  std::copy(generator.begin(), generator.end(), std::back_inserter(candidates));
+
+  const auto size = static_cast<int64_t>(candidates.size());
+  std::vector<char> isAllowed(candidates.size());
+
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int64_t i = 0; i < size; ++i) {
+    isAllowed[i] = filter->isAllowed(candidates[i]);
+  }
+
+  size_t nAllowed = 0;
+  for (size_t i = 0; i < candidates.size(); ++i) {
+    if (isAllowed[i]) {
+      candidates[nAllowed++] = candidates[i];
+    }
+  }
+  candidates.resize(nAllowed);
+
+  return candidates;
+}
+} // namespace
+
 /// Constructor
 ReflectionGenerator::ReflectionGenerator(
     const CrystalStructure &crystalStructure,
@@ -84,12 +123,7 @@ std::vector<Kernel::V3D> ReflectionGenerator::getHKLs(
     filter = filter & reflectionConditionFilter;
   }
 
-  std::vector<V3D> hkls;
-  hkls.reserve(generator.size());
-
-  std::remove_copy_if(generator.begin(), generator.end(),
-                      std::back_inserter(hkls), (~filter)->fn());
-  return hkls;
+  return getAllowedHKLs(generator, filter);
 }
 
 /// Returns a list of symetrically independent HKLs within the specified
@@ -111,16 +145,12 @@ std::vector<V3D> ReflectionGenerator::getUniqueHKLs(
     filter = filter & reflectionConditionFilter;
   }
 
-  std::vector<V3D> hkls;
-  hkls.reserve(generator.size());
+  std::vector<V3D> hkls = getAllowedHKLs(generator, filter);
 
   PointGroup_sptr pg = m_crystalStructure.spaceGroup()->getPointGroup();
-
-  for (auto hkl = generator.begin(); hkl != generator.end(); ++hkl) {
-    if (filter->isAllowed(*hkl)) {
-      hkls.push_back(pg->getReflectionFamily(*hkl));
-    }
-  }
+  std::transform(
+      hkls.begin(), hkls.end(), hkls.begin(),
+      [&pg](const V3D &hkl) { return pg->getReflectionFamily(hkl); });
 
   std::sort(hkls.begin(), hkls.end());
   hkls.erase(std::unique(hkls.begin(), hkls.end()), hkls.end());
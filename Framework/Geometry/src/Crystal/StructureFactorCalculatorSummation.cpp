@@ -6,7 +6,10 @@
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "MantidGeometry/Crystal/StructureFactorCalculatorSummation.h"
 #include "MantidGeometry/Crystal/BraggScattererInCrystalStructure.h"
+#include "MantidGeometry/Crystal/IsotropicAtomBraggScatterer.h"
+#include "MantidKernel/MultiThreaded.h"
 
+#include <cmath>
 #include <iomanip>
 
 namespace Mantid {
@@ -16,14 +19,102 @@ using namespace Kernel;
 
 StructureFactorCalculatorSummation::StructureFactorCalculatorSummation()
     : StructureFactorCalculator(),
-      m_unitCellScatterers(CompositeBraggScatterer::create()) {}
+      m_unitCellScatterers(CompositeBraggScatterer::create()),
+      m_hasAtomArrays(false) {}
 
 /// Returns the structure factor obtained from the stored scatterers.
 StructureFactor
 StructureFactorCalculatorSummation::getF(const Kernel::V3D &hkl) const {
+  if (m_hasAtomArrays) {
+    return getFFromAtomArrays(hkl);
+  }
+
   return m_unitCellScatterers->calculateStructureFactor(hkl);
 }
 
+/// Returns the structure factors of all HKLs, calculated in parallel if the
+/// atom arrays are available.
+std::vector<StructureFactor> StructureFactorCalculatorSummation::getFs(
+    const std::vector<Kernel::V3D> &hkls) const {
+  if (!m_hasAtomArrays) {
+    return StructureFactorCalculator::getFs(hkls);
+  }
+
+  std::vector<StructureFactor> structureFactors(hkls.size());
+  const auto size = static_cast<int64_t>(hkls.size());
+
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int64_t i = 0; i < size; ++i) {
+    structureFactors[i] = getFFromAtomArrays(hkls[i]);
+  }
+
+  return structureFactors;
+}
+
+/// Returns F^2 for all HKLs, calculated in parallel if the atom arrays are
+/// available.
+std::vector<double> StructureFactorCalculatorSummation::getFsSquared(
+    const std::vector<Kernel::V3D> &hkls) const {
+  if (!m_hasAtomArrays) {
+    return StructureFactorCalculator::getFsSquared(hkls);
+  }
+
+  std::vector<double> fSquareds(hkls.size());
+  const auto size = static_cast<int64_t>(hkls.size());
+
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int64_t i = 0; i < size; ++i) {
+    fSquareds[i] = std::norm(getFFromAtomArrays(hkls[i]));
+  }
+
+  return fSquareds;
+}
+
+/**
+ * Calculates the structure factor from the atom arrays
+ *
+ * The Debye-Waller factor and the amplitude are the same for all atoms
+ * generated from one atom of the asymmetric unit, so they are applied once per
+ * site. The inner loop only sums the phase factors over the contiguous
+ * coordinate arrays.
+ *
+ * @param hkl :: HKL for which the structure factor is calculated.
+ * @return :: The structure factor.
+ */
+StructureFactor StructureFactorCalculatorSummation::getFFromAtomArrays(
+    const Kernel::V3D &hkl) const {
+  const double twoPi = 2.0 * M_PI;
+  const double h = twoPi * hkl.X();
+  const double k = twoPi * hkl.Y();
+  const double l = twoPi * hkl.Z();
+
+  const double *x = m_atomX.data();
+  const double *y = m_atomY.data();
+  const double *z = m_atomZ.data();
+
+  double real = 0.0;
+  double imag = 0.0;
+  for (size_t site = 0; site < m_siteAmplitudes.size(); ++site) {
+    double siteReal = 0.0;
+    double siteImag = 0.0;
+    for (size_t i = m_siteOffsets[site]; i < m_siteOffsets[site + 1]; ++i) {
+      const double phase = h * x[i] + k * y[i] + l * z[i];
+      siteReal += std::cos(phase);
+      siteImag += std::sin(phase);
+    }
+
+    const V3D dstar = m_siteB[site] * hkl;
+    const double amplitude =
+        m_siteAmplitudes[site] *
+        std::exp(-2.0 * M_PI * M_PI * m_siteU[site] * dstar.norm2());
+
+    real += amplitude * siteReal;
+    imag += amplitude * siteImag;
+  }
+
+  return StructureFactor(real, imag);
+}
+
 /// Calls updateUnitCellScatterers() to rebuild the complete list of scatterers.
 void StructureFactorCalculatorSummation::crystalStructureSetHook(
     const CrystalStructure &crystalStructure) {
@@ -42,6 +133,14 @@ void StructureFactorCalculatorSummation::crystalStructureSetHook(
 void StructureFactorCalculatorSummation::updateUnitCellScatterers(
     const CrystalStructure &crystalStructure) {
   m_unitCellScatterers->removeAllScatterers();
+  m_hasAtomArrays = false;
+  m_atomX.clear();
+  m_atomY.clear();
+  m_atomZ.clear();
+  m_siteOffsets.assign(1, 0);
+  m_siteAmplitudes.clear();
+  m_siteU.clear();
+  m_siteB.clear();
 
   CompositeBraggScatterer_sptr scatterersInAsymmetricUnit =
       crystalStructure.getScatterers();
@@ -52,6 +151,8 @@ void StructureFactorCalculatorSummation::updateUnitCellScatterers(
     braggScatterers.reserve(scatterersInAsymmetricUnit->nScatterers() *
                             spaceGroup->order());
 
+    bool allIsotropicAtoms = true;
+
     for (size_t i = 0; i < scatterersInAsymmetricUnit->nScatterers(); ++i) {
       BraggScattererInCrystalStructure_sptr current =
           boost::dynamic_pointer_cast<BraggScattererInCrystalStructure>(
@@ -61,16 +162,42 @@ void StructureFactorCalculatorSummation::updateUnitCellScatterers(
         std::vector<V3D> positions =
             spaceGroup->getEquivalentPositions(current->getPosition());
 
+        auto atom =
+            boost::dynamic_pointer_cast<IsotropicAtomBraggScatterer>(current);
+        allIsotropicAtoms = allIsotropicAtoms && atom;
+
         for (auto &position : positions) {
           BraggScatterer_sptr clone = current->clone();
           clone->setProperty("Position", getV3DasString(position));
 
           braggScatterers.push_back(clone);
+
+          if (atom) {
+            const V3D atomPosition =
+                boost::static_pointer_cast<BraggScattererInCrystalStructure>(
+                    clone)
+                    ->getPosition();
+            m_atomX.push_back(atomPosition.X());
+            m_atomY.push_back(atomPosition.Y());
+            m_atomZ.push_back(atomPosition.Z());
+          }
+        }
+
+        if (atom) {
+          m_siteOffsets.push_back(m_atomX.size());
+          m_siteAmplitudes.push_back(
+              atom->getOccupancy() *
+              atom->getNeutronAtom().coh_scatt_length_real);
+          m_siteU.push_back(atom->getU());
+          m_siteB.push_back(atom->getCell().getB());
         }
+      } else {
+        allIsotropicAtoms = false;
       }
     }
 
     m_unitCellScatterers->setScatterers(braggScatterers);
+    m_hasAtomArrays = allIsotropicAtoms;
   }
 }
 
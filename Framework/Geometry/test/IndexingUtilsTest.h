@@ -15,6 +15,8 @@
 #include "MantidKernel/V3D.h"
 #include <cxxtest/TestSuite.h>
 
+#include <algorithm>
+
 using namespace Mantid::Geometry;
 using Mantid::Kernel::Matrix;
 using Mantid::Kernel::V3D;
@@ -825,4 +827,76 @@ public:
   }
 };
 
+// -----------------------------------------------------------------------------
+// Performance tests
+// -----------------------------------------------------------------------------
+class IndexingUtilsTestPerformance : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static IndexingUtilsTestPerformance *createSuite() {
+    return new IndexingUtilsTestPerformance();
+  }
+  static void destroySuite(IndexingUtilsTestPerformance *suite) {
+    delete suite;
+  }
+
+  IndexingUtilsTestPerformance() : m_q_vectors(makeSyntheticQs(10000)) {}
+
+  void test_Find_UB_using_FFT_100_peaks() { findUBUsingFFT(100); }
+
+  void test_Find_UB_using_FFT_1000_peaks() { findUBUsingFFT(1000); }
+
+  void test_Find_UB_using_FFT_10000_peaks() { findUBUsingFFT(10000); }
+
+  void test_Find_UB_given_d_min_d_max_1000_peaks() {
+    Matrix<double> UB(3, 3, false);
+    const std::vector<V3D> q_vectors(m_q_vectors.begin(),
+                                     m_q_vectors.begin() + 1000);
+
+    IndexingUtils::Find_UB(UB, q_vectors, 6, 20, 0.12, -1, 15, 1);
+    TS_ASSERT_EQUALS(IndexingUtils::NumberIndexed(UB, q_vectors, 0.12), 1000);
+  }
+
+  void test_ScanFor_Directions_10000_peaks() {
+    std::vector<V3D> directions;
+    IndexingUtils::ScanFor_Directions(directions, m_q_vectors, 6, 20, 0.12,
+                                      2);
+    TS_ASSERT(!directions.empty());
+  }
+
+private:
+  void findUBUsingFFT(size_t num_peaks) {
+    Matrix<double> UB(3, 3, false);
+    const std::vector<V3D> q_vectors(m_q_vectors.begin(),
+                                     m_q_vectors.begin() + num_peaks);
+
+    IndexingUtils::Find_UB(UB, q_vectors, 6, 20, 0.12, 1);
+    TS_ASSERT_EQUALS(IndexingUtils::NumberIndexed(UB, q_vectors, 0.12),
+                     static_cast<int>(num_peaks));
+  }
+
+  /// Q vectors of the num_peaks lowest |Q| reflections of natrolite
+  static std::vector<V3D> makeSyntheticQs(size_t num_peaks) {
+    const Matrix<double> UB = IndexingUtilsTest::getNatroliteUB();
+    std::vector<V3D> q_vectors;
+    const int max_index = 15;
+    for (int h = -max_index; h <= max_index; h++) {
+      for (int k = -max_index; k <= max_index; k++) {
+        for (int l = -max_index; l <= max_index; l++) {
+          if (h != 0 || k != 0 || l != 0) {
+            q_vectors.push_back(UB * V3D(h, k, l) * (2.0 * M_PI));
+          }
+        }
+      }
+    }
+
+    std::sort(q_vectors.begin(), q_vectors.end(), V3D::compareMagnitude);
+    q_vectors.resize(num_peaks);
+    return q_vectors;
+  }
+
+  const std::vector<V3D> m_q_vectors;
+};
+
 #endif /* MANTID_GEOMETRY_INDEXING_UTILS_TEST_H_ */
@@ -12,8 +12,12 @@
 #include "MantidGeometry/Crystal/StructureFactorCalculatorSummation.h"
 
 #include "MantidGeometry/Crystal/BraggScattererFactory.h"
+#include "MantidGeometry/Crystal/BraggScattererInCrystalStructure.h"
 #include "MantidGeometry/Crystal/SpaceGroupFactory.h"
 
+#include <iomanip>
+#include <sstream>
+
 using namespace Mantid::Geometry;
 using namespace Mantid::Kernel;
 
@@ -64,6 +68,68 @@ public:
     TS_ASSERT_LESS_THAN(calculator->getFSquared(V3D(2, 2, 2)), 1e-9);
   }
 
+  void testBatchedStructureFactorsMatchScatterers() {
+    CompositeBraggScatterer_sptr scatterers = CompositeBraggScatterer::create();
+    scatterers->addScatterer(BraggScattererFactory::Instance().createScatterer(
+        "IsotropicAtomBraggScatterer",
+        R"({"Element":"Si","Position":"0.1,0.2,0.3","U":"0.01"})"));
+    scatterers->addScatterer(BraggScattererFactory::Instance().createScatterer(
+        "IsotropicAtomBraggScatterer",
+        R"({"Element":"O","Position":"0.4,0.15,0.05","U":"0.02",)"
+        R"("Occupancy":"0.5"})"));
+
+    CrystalStructure structure(
+        UnitCell(5.1, 6.2, 7.3, 90.0, 105.0, 90.0),
+        SpaceGroupFactory::Instance().createSpaceGroup("P 1 21/c 1"),
+        scatterers);
+
+    StructureFactorCalculatorSummation calculator;
+    calculator.setCrystalStructure(structure);
+
+    // Reference: sum over the scatterer objects of the unit cell
+    CompositeBraggScatterer_sptr unitCell = CompositeBraggScatterer::create();
+    auto spaceGroup = structure.spaceGroup();
+    for (size_t i = 0; i < scatterers->nScatterers(); ++i) {
+      auto scatterer =
+          boost::dynamic_pointer_cast<BraggScattererInCrystalStructure>(
+              scatterers->getScatterer(i));
+      for (const auto &position :
+           spaceGroup->getEquivalentPositions(scatterer->getPosition())) {
+        auto clone = scatterer->clone();
+        std::ostringstream positionString;
+        positionString << std::setprecision(17) << position;
+        clone->setProperty("Position", positionString.str());
+        unitCell->addScatterer(clone);
+      }
+    }
+
+    std::vector<V3D> hkls;
+    for (int h = -3; h <= 3; ++h) {
+      for (int k = -3; k <= 3; ++k) {
+        for (int l = -3; l <= 3; ++l) {
+          hkls.emplace_back(h, k, l);
+        }
+      }
+    }
+
+    std::vector<StructureFactor> fs = calculator.getFs(hkls);
+    std::vector<double> fSquareds = calculator.getFsSquared(hkls);
+
+    TS_ASSERT_EQUALS(fs.size(), hkls.size());
+    TS_ASSERT_EQUALS(fSquareds.size(), hkls.size());
+
+    for (size_t i = 0; i < hkls.size(); ++i) {
+      StructureFactor reference = unitCell->calculateStructureFactor(hkls[i]);
+      StructureFactor single = calculator.getF(hkls[i]);
+
+      TS_ASSERT_DELTA(single.real(), reference.real(), 1e-10);
+      TS_ASSERT_DELTA(single.imag(), reference.imag(), 1e-10);
+      TS_ASSERT_DELTA(fs[i].real(), reference.real(), 1e-10);
+      TS_ASSERT_DELTA(fs[i].imag(), reference.imag(), 1e-10);
+      TS_ASSERT_DELTA(fSquareds[i], std::norm(reference), 1e-10);
+    }
+  }
+
 private:
   CrystalStructure getCrystalStructure() {
     CompositeBraggScatterer_sptr scatterers = CompositeBraggScatterer::create();
@@ -19,7 +19,10 @@
 #include "MantidKernel/Logger.h"
 #include <Poco/Notification.h>
 #include <Poco/NotificationCenter.h>
+#include <map>
 #include <mutex>
+#include <shared_mutex>
+#include <thread>
 
 #ifdef _WIN32
 #define strcasecmp _stricmp
@@ -191,6 +194,47 @@ public:
     std::string m_newName; ///< New object name
   };
 
+  /// BatchEndNotification is sent, on the thread that closes it, whenever a
+  /// NotificationBatch is closed. Observers that hold back the notifications
+  /// of a thread while isBatching() is true should deliver them on receipt
+  /// of this notification.
+  class BatchEndNotification : public NamedObjectNotification {
+  public:
+    /// Constructor
+    BatchEndNotification() : NamedObjectNotification("") {}
+  };
+
+  /** Marks the changes made to the service by the current thread, e.g. by
+   * an algorithm, as one batch for the lifetime of the object. Notifications
+   * are still posted as the changes are made; observers may use
+   * isBatching() and the BatchEndNotification to coalesce them into a
+   * single update. Batches are tracked per thread, so a batch never holds
+   * back the changes made by other threads. They may be nested, and the end
+   * of each one is notified.
+   */
+  class NotificationBatch {
+  public:
+    explicit NotificationBatch(DataService &service) : m_service(service) {
+      m_service.changeBatchDepth(1);
+    }
+    ~NotificationBatch() {
+      m_service.changeBatchDepth(-1);
+      // Must not throw from a destructor
+      try {
+        m_service.notificationCenter.postNotification(
+            new BatchEndNotification());
+      } catch (std::exception &ex) {
+        m_service.g_log.error()
+            << "Error notifying the end of a batch: " << ex.what() << '\n';
+      }
+    }
+    NotificationBatch(const NotificationBatch &) = delete;
+    NotificationBatch &operator=(const NotificationBatch &) = delete;
+
+  private:
+    DataService &m_service;
+  };
+
   //--------------------------------------------------------------------------
   /** Add an object to the service
    * @param name :: name of the object
@@ -207,7 +251,7 @@ public:
     bool success = false;
     {
       // Make DataService access thread-safe
-      std::lock_guard<std::recursive_mutex> lock(m_mutex);
+      std::lock_guard<std::shared_timed_mutex> lock(m_mutex);
       // At the moment, you can't overwrite an object (i.e. pass in a name
       // that's already in the map with a pointer to a different object).
       // Also, there's nothing to stop the same object from being added
@@ -238,7 +282,7 @@ public:
     checkForNullPointer(Tobject);
 
     // Make DataService access thread-safe
-    std::unique_lock<std::recursive_mutex> lock(m_mutex);
+    std::unique_lock<std::shared_timed_mutex> lock(m_mutex);
 
     // find if the Tobject already exists
     auto it = datamap.find(name);
@@ -267,7 +311,7 @@ public:
    * @param name :: name of the object */
   void remove(const std::string &name) {
     // Make DataService access thread-safe
-    std::unique_lock<std::recursive_mutex> lock(m_mutex);
+    std::unique_lock<std::shared_timed_mutex> lock(m_mutex);
 
     auto it = datamap.find(name);
     if (it == datamap.end()) {
@@ -304,7 +348,7 @@ public:
     }
 
     // Make DataService access thread-safe
-    std::unique_lock<std::recursive_mutex> lock(m_mutex);
+    std::unique_lock<std::shared_timed_mutex> lock(m_mutex);
 
     auto existingNameIter = datamap.find(oldName);
     if (existingNameIter == datamap.end()) {
@@ -355,7 +399,7 @@ public:
   void clear() {
     {
       // Make DataService access thread-safe
-      std::lock_guard<std::recursive_mutex> lock(m_mutex);
+      std::lock_guard<std::shared_timed_mutex> lock(m_mutex);
       datamap.clear();
     }
     notificationCenter.postNotification(new ClearNotification());
@@ -370,7 +414,7 @@ public:
    * @param name :: name of the object */
   boost::shared_ptr<T> retrieve(const std::string &name) const {
     // Make DataService access thread-safe
-    std::lock_guard<std::recursive_mutex> _lock(m_mutex);
+    std::shared_lock<std::shared_timed_mutex> _lock(m_mutex);
 
     auto it = datamap.find(name);
     if (it != datamap.end()) {
@@ -395,14 +439,14 @@ public:
   /// Check to see if a data object exists in the store
   bool doesExist(const std::string &name) const {
     // Make DataService access thread-safe
-    std::lock_guard<std::recursive_mutex> _lock(m_mutex);
+    std::shared_lock<std::shared_timed_mutex> _lock(m_mutex);
     auto it = datamap.find(name);
     return it != datamap.end();
   }
 
   /// Return the number of objects stored by the data service
   size_t size() const {
-    std::lock_guard<std::recursive_mutex> _lock(m_mutex);
+    std::shared_lock<std::shared_timed_mutex> _lock(m_mutex);
 
     if (showingHiddenObjects()) {
       return datamap.size();
@@ -442,14 +486,14 @@ public:
     // Use the scoping of an if to handle our lock for duration
     if (hiddenState == DataServiceHidden::Include) {
       // Getting hidden items
-      std::lock_guard<std::recursive_mutex> _lock(m_mutex);
+      std::shared_lock<std::shared_timed_mutex> _lock(m_mutex);
       foundNames.reserve(datamap.size());
       for (const auto &item : datamap) {
         foundNames.push_back(item.first);
       }
       // Lock released at end of scope here
     } else {
-      std::lock_guard<std::recursive_mutex> _lock(m_mutex);
+      std::shared_lock<std::shared_timed_mutex> _lock(m_mutex);
       foundNames.reserve(datamap.size());
       for (const auto &item : datamap) {
         if (!isHiddenDataServiceObject(item.first)) {
@@ -471,7 +515,7 @@ public:
   /// Get a vector of the pointers to the data objects stored by the service
   std::vector<boost::shared_ptr<T>>
   getObjects(DataServiceHidden includeHidden = DataServiceHidden::Auto) const {
-    std::lock_guard<std::recursive_mutex> _lock(m_mutex);
+    std::shared_lock<std::shared_timed_mutex> _lock(m_mutex);
 
     const bool alwaysIncludeHidden =
         includeHidden == DataServiceHidden::Include;
@@ -490,6 +534,13 @@ public:
     return objects;
   }
 
+  /// Returns true while the calling thread has a NotificationBatch open on
+  /// the service
+  bool isBatching() const {
+    std::lock_guard<std::mutex> lock(m_batchMutex);
+    return m_batchDepths.count(std::this_thread::get_id()) > 0;
+  }
+
   inline static std::string prefixToHide() { return "__"; }
 
   inline static bool isHiddenDataServiceObject(const std::string &name) {
@@ -518,6 +569,14 @@ protected:
   virtual ~DataService() = default;
 
 private:
+  /// Open or close a NotificationBatch on the calling thread
+  void changeBatchDepth(const int change) {
+    std::lock_guard<std::mutex> lock(m_batchMutex);
+    const auto thread = std::this_thread::get_id();
+    if ((m_batchDepths[thread] += change) == 0)
+      m_batchDepths.erase(thread);
+  }
+
   void checkForEmptyName(const std::string &name) {
     if (name.empty()) {
       const std::string error = "Add Data Object with empty name";
@@ -539,8 +598,12 @@ private:
   const std::string svcName;
   /// Map of objects in the data service
   svcmap datamap;
-  /// Recursive mutex to avoid simultaneous access or notifications
-  mutable std::recursive_mutex m_mutex;
+  /// Guards the map. Lookups take a shared lock so that readers on
+  /// different threads do not serialise; modifications take it exclusively
+  mutable std::shared_timed_mutex m_mutex;
+  /// The number of open NotificationBatch objects of each thread
+  std::map<std::thread::id, int> m_batchDepths;
+  mutable std::mutex m_batchMutex;
   /// Logger for this DataService
   Logger g_log;
 }; // End Class Data service
@@ -43,13 +43,13 @@ public:
   /// destructor
   virtual ~PropertyHistory() = default;
   /// get name of algorithm parameter const
-  const std::string &name() const { return m_name; };
+  const std::string &name() const { return *m_name; };
   /// get value of algorithm parameter const
   const std::string &value() const { return m_value; };
   /// set value of algorithm parameter
   void setValue(const std::string &value) { m_value = value; };
   /// get type of algorithm parameter const
-  const std::string &type() const { return m_type; };
+  const std::string &type() const { return *m_type; };
   /// get isdefault flag of algorithm parameter const
   bool isDefault() const { return m_isDefault; };
   /// get direction flag of algorithm parameter const
@@ -68,12 +68,13 @@ public:
   }
 
 private:
-  /// The name of the parameter
-  std::string m_name;
+  /// The name of the parameter. Names and types repeat across every
+  /// history record, so they are interned and shared by all records.
+  const std::string *m_name;
   /// The value of the parameter
   std::string m_value;
-  /// The type of the parameter
-  std::string m_type;
+  /// The type of the parameter, interned like the name
+  const std::string *m_type;
   /// flag defining if the parameter is a default or a user-defined parameter
   bool m_isDefault;
   /// direction of parameter
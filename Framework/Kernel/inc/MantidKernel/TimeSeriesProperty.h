@@ -15,6 +15,7 @@
 #include "MantidKernel/ITimeSeriesProperty.h"
 #include "MantidKernel/Property.h"
 #include "MantidKernel/Statistics.h"
+#include "MantidKernel/cow_ptr.h"
 #include <cstdint>
 #include <utility>
 
@@ -102,6 +103,10 @@ public:
 
 /**
    A specialised Property class for holding a series of time-value pairs.
+
+   The times and the values are held in two separate columns, the times as
+   64-bit nanoseconds since the DateAndTime epoch. Filtering and statistics run
+   as single passes over the columns.
  */
 template <typename TYPE>
 class DLLExport TimeSeriesProperty : public Property,
@@ -308,7 +313,15 @@ public:
   /**Reserve memory for efficient adding values to existing property
    * makes sense only when you have reasonably precise estimate of the
    * total size you'll need easily available in advance.  */
-  void reserve(size_t size) { m_values.reserve(size); };
+  void reserve(size_t size) {
+    m_times.access().reserve(size);
+    m_values.access().reserve(size);
+  };
+
+  /// The times of the series, sorted, as nanoseconds since the epoch
+  const std::vector<int64_t> &timeColumn() const;
+  /// The values of the series, in the order of timeColumn()
+  const std::vector<TYPE> &valueColumn() const;
 
   /// If filtering by log, get the time intervals for splitting
   std::vector<Mantid::Kernel::SplittingInterval> getSplittingIntervals() const;
@@ -321,6 +334,8 @@ private:
   void sortIfNecessary() const;
   ///  Find the index of the entry of time t in the mP vector (sorted)
   int findIndex(Types::Core::DateAndTime t) const;
+  /// Find the first entry at or after time t in [first, last) (sorted)
+  size_t lowerBoundIndex(int64_t t, size_t first, size_t last) const;
   ///  Find the upper_bound of time t in container.
   int upperBound(Types::Core::DateAndTime t, int istart, int iend) const;
   /// Apply a filter
@@ -330,13 +345,14 @@ private:
   size_t findNthIndexFromQuickRef(int n) const;
   /// Set a value from another property
   std::string setValueFromProperty(const Property &right) override;
-  /// Find if time lies in a filtered region
-  bool isTimeFiltered(const Types::Core::DateAndTime &time) const;
   /// Time weighted mean and standard deviation
   std::pair<double, double> timeAverageValueAndStdDev() const;
 
-  /// Holds the time series data
-  mutable std::vector<TimeValueUnit<TYPE>> m_values;
+  /// Holds the times of the series as nanoseconds since the DateAndTime epoch.
+  /// The columns are shared by copies of the property until either is changed
+  mutable Kernel::cow_ptr<std::vector<int64_t>> m_times;
+  /// Holds the values of the series, each matching the entry of m_times
+  mutable Kernel::cow_ptr<std::vector<TYPE>> m_values;
 
   /// The number of values (or time intervals) in the time series. It can be
   /// different from m_propertySeries.size()
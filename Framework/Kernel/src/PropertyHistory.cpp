@@ -15,22 +15,40 @@
 #include <algorithm>
 #include <boost/lexical_cast.hpp>
 #include <cstdint>
+#include <mutex>
 #include <ostream>
+#include <unordered_set>
 
 namespace Mantid {
 namespace Kernel {
+namespace {
+/** Return the single shared copy of a string. The pool only grows, which is
+ * fine for the small vocabulary of property names and types.
+ * @param str :: The string to look up or add
+ * @return A pointer to the pooled copy, valid for the lifetime of the program
+ */
+const std::string *intern(const std::string &str) {
+  static std::mutex mutex;
+  // Never destroyed, so that histories outliving static destruction are safe
+  static auto *pool = new std::unordered_set<std::string>();
+  std::lock_guard<std::mutex> lock(mutex);
+  return &*pool->insert(str).first;
+}
+} // namespace
 
 /// Constructor
 PropertyHistory::PropertyHistory(const std::string &name,
                                  const std::string &value,
                                  const std::string &type, const bool isdefault,
                                  const unsigned int direction)
-    : m_name(name), m_value(value), m_type(type), m_isDefault(isdefault),
+    : m_name(intern(name)), m_value(value), m_type(intern(type)),
+      m_isDefault(isdefault),
       m_direction(direction) {}
 
 PropertyHistory::PropertyHistory(Property const *const prop)
-    : m_name(prop->name()), m_value(prop->valueAsPrettyStr(0, true)),
-      m_type(prop->type()), m_isDefault(prop->isDefault()),
+    : m_name(intern(prop->name())),
+      m_value(prop->valueAsPrettyStr(0, true)), m_type(intern(prop->type())),
+      m_isDefault(prop->isDefault()),
       m_direction(prop->direction()) {}
 
 /** Prints a text representation of itself
@@ -42,7 +60,7 @@ PropertyHistory::PropertyHistory(Property const *const prop)
  */
 void PropertyHistory::printSelf(std::ostream &os, const int indent,
                                 const size_t maxPropertyLength) const {
-  os << std::string(indent, ' ') << "Name: " << m_name;
+  os << std::string(indent, ' ') << "Name: " << *m_name;
   if ((maxPropertyLength > 0) && (m_value.size() > maxPropertyLength)) {
     os << ", Value: " << Strings::shorten(m_value, maxPropertyLength);
   } else {
@@ -85,7 +103,7 @@ bool PropertyHistory::isEmptyDefault() const {
 
   // If default, input, number type and matches empty value then return true
   if (m_isDefault && m_direction != Direction::Output) {
-    if (std::find(numberTypes.begin(), numberTypes.end(), m_type) !=
+    if (std::find(numberTypes.begin(), numberTypes.end(), *m_type) !=
         numberTypes.end()) {
       if (std::find(emptyValues.begin(), emptyValues.end(), m_value) !=
           emptyValues.end()) {
@@ -22,6 +22,34 @@ namespace Kernel {
 namespace {
 /// static Logger definition
 Logger g_log("TimeSeriesProperty");
+
+/**
+ * Integrate a function of the values of a sorted log over [start, stop), with
+ * each value held from its time until the time of the next entry. The terms
+ * of the inner entries are independent of each other, so the loop vectorises.
+ * @param times :: The time column in nanoseconds
+ * @param values :: The value column
+ * @param first :: The index of the entry in effect at start
+ * @param last :: One past the index of the last entry before stop
+ * @param start :: The start of the range in nanoseconds
+ * @param stop :: The end of the range in nanoseconds
+ * @param func :: The function of the value to integrate
+ * @return The integral, with the time in seconds
+ */
+template <typename TYPE, typename Func>
+double integrateSteps(const std::vector<int64_t> &times,
+                      const std::vector<TYPE> &values, const size_t first,
+                      const size_t last, const int64_t start,
+                      const int64_t stop, Func func) {
+  if (last <= first + 1)
+    return static_cast<double>(stop - start) * 1e-9 * func(values[first]);
+  double sum =
+      static_cast<double>(times[first + 1] - start) * func(values[first]);
+  for (size_t i = first + 1; i + 1 < last; ++i)
+    sum += static_cast<double>(times[i + 1] - times[i]) * func(values[i]);
+  sum += static_cast<double>(stop - times[last - 1]) * func(values[last - 1]);
+  return sum * 1e-9;
+}
 } // namespace
 
 /**
@@ -30,7 +58,8 @@ Logger g_log("TimeSeriesProperty");
  */
 template <typename TYPE>
 TimeSeriesProperty<TYPE>::TimeSeriesProperty(const std::string &name)
-    : Property(name, typeid(std::vector<TimeValueUnit<TYPE>>)), m_values(),
+    : Property(name, typeid(std::vector<TimeValueUnit<TYPE>>)), m_times(),
+      m_values(),
       m_size(), m_propSortedFlag(), m_filterApplied() {}
 
 /**
@@ -91,23 +120,21 @@ template <typename TYPE>
 std::unique_ptr<TimeSeriesProperty<double>>
 TimeSeriesProperty<TYPE>::getDerivative() const {
 
-  if (this->m_values.size() < 2) {
+  if (this->m_values->size() < 2) {
     throw std::runtime_error("Derivative is not defined for a time-series "
                              "property with less then two values");
   }
 
   this->sortIfNecessary();
-  auto it = this->m_values.begin();
-  int64_t t0 = it->time().totalNanoseconds();
-  TYPE v0 = it->value();
+  int64_t t0 = m_times->front();
+  TYPE v0 = m_values->front();
 
-  it++;
   auto timeSeriesDeriv = std::make_unique<TimeSeriesProperty<double>>(
       this->name() + "_derivative");
-  timeSeriesDeriv->reserve(this->m_values.size() - 1);
-  for (; it != m_values.end(); it++) {
-    TYPE v1 = it->value();
-    int64_t t1 = it->time().totalNanoseconds();
+  timeSeriesDeriv->reserve(this->m_values->size() - 1);
+  for (size_t i = 1; i < m_values->size(); ++i) {
+    TYPE v1 = (*m_values)[i];
+    int64_t t1 = (*m_times)[i];
     if (t1 != t0) {
       double deriv = 1.e+9 * (double(v1 - v0) / double(t1 - t0));
       auto tm = static_cast<int64_t>((t1 + t0) / 2);
@@ -132,7 +159,7 @@ TimeSeriesProperty<std::string>::getDerivative() const {
 template <typename TYPE>
 size_t TimeSeriesProperty<TYPE>::getMemorySize() const {
   // Rough estimate
-  return m_values.size() * (sizeof(TYPE) + sizeof(DateAndTime));
+  return m_values->size() * (sizeof(TYPE) + sizeof(int64_t));
 }
 
 /**
@@ -157,8 +184,11 @@ operator+=(Property const *right) {
 
   if (rhs) {
     if (this->operator!=(*rhs)) {
-      m_values.insert(m_values.end(), rhs->m_values.begin(),
-                      rhs->m_values.end());
+      auto &times = m_times.access();
+      auto &values = m_values.access();
+      times.insert(times.end(), rhs->m_times->begin(), rhs->m_times->end());
+      values.insert(values.end(), rhs->m_values->begin(),
+                    rhs->m_values->end());
       m_propSortedFlag = TimeSeriesSortStatus::TSUNKNOWN;
     } else {
       // Do nothing if appending yourself to yourself. The net result would be
@@ -167,7 +197,7 @@ operator+=(Property const *right) {
     }
 
     // Count the REAL size.
-    m_size = static_cast<int>(m_values.size());
+    m_size = static_cast<int>(m_values->size());
 
   } else
     g_log.warning() << "TimeSeriesProperty " << this->name()
@@ -199,15 +229,8 @@ operator==(const TimeSeriesProperty<TYPE> &right) const {
   if (this->realSize() != right.realSize()) {
     return false;
   } else {
-    const std::vector<DateAndTime> lhsTimes = this->timesAsVector();
-    const std::vector<DateAndTime> rhsTimes = right.timesAsVector();
-    if (!std::equal(lhsTimes.begin(), lhsTimes.end(), rhsTimes.begin())) {
-      return false;
-    }
-
-    const std::vector<TYPE> lhsValues = this->valuesAsVector();
-    const std::vector<TYPE> rhsValues = right.valuesAsVector();
-    if (!std::equal(lhsValues.begin(), lhsValues.end(), rhsValues.begin())) {
+    right.sortIfNecessary();
+    if (*m_times != *right.m_times || *m_values != *right.m_values) {
       return false;
     }
   }
@@ -287,28 +310,28 @@ void TimeSeriesProperty<TYPE>::filterByTime(
   sortIfNecessary();
 
   // 1. Do nothing for single (constant) value
-  if (m_values.size() <= 1)
+  if (m_values->size() <= 1)
     return;
 
-  typename std::vector<TimeValueUnit<TYPE>>::iterator iterhead, iterend;
-
   // 2. Determine index for start and remove  Note erase is [...)
   int istart = this->findIndex(start);
-  if (istart >= 0 && static_cast<size_t>(istart) < m_values.size()) {
+  if (istart >= 0 && static_cast<size_t>(istart) < m_values->size()) {
     // "start time" is behind time-series's starting time
-    iterhead = m_values.begin() + istart;
 
     // False - The filter time is on the mark.  Erase [begin(),  istart)
     // True - The filter time is larger than T[istart]. Erase[begin(), istart)
     // ...
     //       filter start(time) and move istart to filter startime
-    bool useprefiltertime = !(m_values[istart].time() == start);
+    bool useprefiltertime = (*m_times)[istart] != start.totalNanoseconds();
 
     // Remove the series
-    m_values.erase(m_values.begin(), iterhead);
+    auto &times = m_times.access();
+    auto &values = m_values.access();
+    times.erase(times.begin(), times.begin() + istart);
+    values.erase(values.begin(), values.begin() + istart);
 
     if (useprefiltertime) {
-      m_values[0].setTime(start);
+      times[0] = start.totalNanoseconds();
     }
   } else {
     // "start time" is before/after time-series's starting time: do nothing
@@ -317,20 +340,22 @@ void TimeSeriesProperty<TYPE>::filterByTime(
 
   // 3. Determine index for end and remove  Note erase is [...)
   int iend = this->findIndex(stop);
-  if (static_cast<size_t>(iend) < m_values.size()) {
-    if (m_values[iend].time() == stop) {
+  if (static_cast<size_t>(iend) < m_values->size()) {
+    size_t newSize;
+    if ((*m_times)[iend] == stop.totalNanoseconds()) {
       // Filter stop is on a log.  Delete that log
-      iterend = m_values.begin() + iend;
+      newSize = static_cast<size_t>(iend);
     } else {
       // Filter stop is behind iend. Keep iend
-      iterend = m_values.begin() + iend + 1;
+      newSize = static_cast<size_t>(iend) + 1;
     }
     // Delete from [iend to mp.end)
-    m_values.erase(iterend, m_values.end());
+    m_times.access().resize(newSize);
+    m_values.access().resize(newSize);
   }
 
   // 4. Make size consistent
-  m_size = static_cast<int>(m_values.size());
+  m_size = static_cast<int>(m_values->size());
 }
 
 /**
@@ -345,15 +370,16 @@ void TimeSeriesProperty<TYPE>::filterByTimes(
   sortIfNecessary();
 
   // 2. Return for single value
-  if (m_values.size() <= 1) {
+  if (m_values->size() <= 1) {
     return;
   }
 
   // 3. Prepare a copy
-  std::vector<TimeValueUnit<TYPE>> mp_copy;
+  std::vector<int64_t> times_copy;
+  std::vector<TYPE> values_copy;
 
-  g_log.debug() << "DB541  mp_copy Size = " << mp_copy.size()
-                << "  Original MP Size = " << m_values.size() << "\n";
+  g_log.debug() << "DB541  mp_copy Size = " << values_copy.size()
+                << "  Original MP Size = " << m_values->size() << "\n";
 
   // 4. Create new
   for (const auto &splitter : splittervec) {
@@ -364,49 +390,47 @@ void TimeSeriesProperty<TYPE>::filterByTimes(
     if (tstartindex < 0) {
       // The splitter is not well defined, and use the first
       tstartindex = 0;
-    } else if (tstartindex >= int(m_values.size())) {
+    } else if (tstartindex >= int(m_values->size())) {
       // The splitter is not well defined, adn use the last
-      tstartindex = int(m_values.size()) - 1;
+      tstartindex = int(m_values->size()) - 1;
     }
 
     int tstopindex = findIndex(t_stop);
 
     if (tstopindex < 0) {
       tstopindex = 0;
-    } else if (tstopindex >= int(m_values.size())) {
-      tstopindex = int(m_values.size()) - 1;
+    } else if (tstopindex >= int(m_values->size())) {
+      tstopindex = int(m_values->size()) - 1;
     } else {
-      if (t_stop == m_values[size_t(tstopindex)].time() &&
+      if (t_stop.totalNanoseconds() == (*m_times)[size_t(tstopindex)] &&
           size_t(tstopindex) > 0) {
         tstopindex--;
       }
     }
 
     /* Check */
-    if (tstartindex < 0 || tstopindex >= int(m_values.size())) {
+    if (tstartindex < 0 || tstopindex >= int(m_values->size())) {
       g_log.warning() << "Memory Leak In SplitbyTime!\n";
     }
 
-    if (tstartindex == tstopindex) {
-      TimeValueUnit<TYPE> temp(t_start, m_values[tstartindex].value());
-      mp_copy.push_back(temp);
-    } else {
-      mp_copy.emplace_back(t_start, m_values[tstartindex].value());
-      for (auto im = size_t(tstartindex + 1); im <= size_t(tstopindex); ++im) {
-        mp_copy.emplace_back(m_values[im].time(), m_values[im].value());
-      }
+    times_copy.push_back(t_start.totalNanoseconds());
+    values_copy.push_back((*m_values)[tstartindex]);
+    if (tstopindex > tstartindex) {
+      times_copy.insert(times_copy.end(), m_times->begin() + tstartindex + 1,
+                        m_times->begin() + tstopindex + 1);
+      values_copy.insert(values_copy.end(), m_values->begin() + tstartindex + 1,
+                         m_values->begin() + tstopindex + 1);
     }
   } // ENDFOR
 
-  g_log.debug() << "DB530  Filtered Log Size = " << mp_copy.size()
-                << "  Original Log Size = " << m_values.size() << "\n";
+  g_log.debug() << "DB530  Filtered Log Size = " << values_copy.size()
+                << "  Original Log Size = " << m_values->size() << "\n";
 
-  // 5. Clear
-  m_values.clear();
-  m_values = mp_copy;
-  mp_copy.clear();
+  // 5. Replace
+  m_times = boost::make_shared<std::vector<int64_t>>(std::move(times_copy));
+  m_values = boost::make_shared<std::vector<TYPE>>(std::move(values_copy));
 
-  m_size = static_cast<int>(m_values.size());
+  m_size = static_cast<int>(m_values->size());
 }
 
 /**
@@ -441,12 +465,14 @@ void TimeSeriesProperty<TYPE>::splitByTime(
     auto *myOutput = dynamic_cast<TimeSeriesProperty<TYPE> *>(outputs[i]);
     if (myOutput) {
       outputs_tsp.push_back(myOutput);
-      if (this->m_values.size() == 1) {
+      if (this->m_values->size() == 1) {
         // Special case for TSP with a single entry = just copy.
+        myOutput->m_times = this->m_times;
         myOutput->m_values = this->m_values;
         myOutput->m_size = 1;
       } else {
-        myOutput->m_values.clear();
+        myOutput->m_times = boost::make_shared<std::vector<int64_t>>();
+        myOutput->m_values = boost::make_shared<std::vector<TYPE>>();
         myOutput->m_size = 0;
       }
     } else {
@@ -455,7 +481,7 @@ void TimeSeriesProperty<TYPE>::splitByTime(
   }
 
   // 2. Special case for TSP with a single entry = just copy.
-  if (this->m_values.size() == 1)
+  if (this->m_values->size() == 1)
     return;
 
   // 3. We will be iterating through all the entries in the the map/vector
@@ -465,12 +491,12 @@ void TimeSeriesProperty<TYPE>::splitByTime(
   auto itspl = splitter.begin();
 
   size_t counter = 0;
-  g_log.debug() << "[DB] Number of time series entries = " << m_values.size()
+  g_log.debug() << "[DB] Number of time series entries = " << m_values->size()
                 << ", Number of splitters = " << splitter.size() << "\n";
-  while (itspl != splitter.end() && i_property < m_values.size()) {
+  while (itspl != splitter.end() && i_property < m_values->size()) {
     // Get the splitting interval times and destination
-    DateAndTime start = itspl->start();
-    DateAndTime stop = itspl->stop();
+    const int64_t start = itspl->start().totalNanoseconds();
+    const int64_t stop = itspl->stop().totalNanoseconds();
 
     int output_index = itspl->index();
     // output workspace index is out of range. go to the next splitter
@@ -486,13 +512,12 @@ void TimeSeriesProperty<TYPE>::splitByTime(
     }
 
     // Skip the events before the start of the time
-    while (i_property < m_values.size() && m_values[i_property].time() < start)
-      ++i_property;
+    i_property = lowerBoundIndex(start, i_property, m_times->size());
 
-    if (i_property == m_values.size()) {
+    if (i_property == m_values->size()) {
       // i_property is out of the range. Then use the last entry
-      myOutput->addValue(m_values[i_property - 1].time(),
-                         m_values[i_property - 1].value());
+      myOutput->addValue(DateAndTime((*m_times)[i_property - 1]),
+                         (*m_values)[i_property - 1]);
 
       ++itspl;
       ++counter;
@@ -500,22 +525,33 @@ void TimeSeriesProperty<TYPE>::splitByTime(
     }
 
     // The current entry is within an interval. Record them until out
-    if (m_values[i_property].time() > start && i_property > 0 && !isPeriodic) {
+    if ((*m_times)[i_property] > start && i_property > 0 && !isPeriodic) {
       // Record the previous oneif this property is not exactly on start time
       //   and this entry is not recorded
       size_t i_prev = i_property - 1;
-      if (myOutput->size() == 0 ||
-          m_values[i_prev].time() != myOutput->lastTime())
-        myOutput->addValue(m_values[i_prev].time(), m_values[i_prev].value());
+      if (myOutput->m_values->empty() ||
+          (*m_times)[i_prev] != myOutput->m_times->back())
+        myOutput->addValue(DateAndTime((*m_times)[i_prev]),
+                           (*m_values)[i_prev]);
     }
 
-    // Loop through all the entries until out.
-    while (i_property < m_values.size() && m_values[i_property].time() < stop) {
-
-      // Copy the log out to the output
-      myOutput->addValue(m_values[i_property].time(),
-                         m_values[i_property].value());
-      ++i_property;
+    // Copy all the entries until out to the output in one go. They are
+    // sorted, and later than anything the output already holds.
+    const size_t i_end = lowerBoundIndex(stop, i_property, m_times->size());
+    if (i_end > i_property) {
+      if (myOutput->m_times->empty())
+        myOutput->m_propSortedFlag = TimeSeriesSortStatus::TSSORTED;
+      else if (myOutput->m_times->back() > (*m_times)[i_property])
+        myOutput->m_propSortedFlag = TimeSeriesSortStatus::TSUNSORTED;
+      auto &outTimes = myOutput->m_times.access();
+      auto &outValues = myOutput->m_values.access();
+      outTimes.insert(outTimes.end(), m_times->begin() + i_property,
+                      m_times->begin() + i_end);
+      outValues.insert(outValues.end(), m_values->begin() + i_property,
+                       m_values->begin() + i_end);
+      myOutput->m_size = static_cast<int>(myOutput->m_values->size());
+      myOutput->m_filterApplied = false;
+      i_property = i_end;
     }
 
     // Go to the next interval
@@ -526,7 +562,7 @@ void TimeSeriesProperty<TYPE>::splitByTime(
       break;
 
     // No need to keep looping through the filter if we are out of events
-    if (i_property == this->m_values.size())
+    if (i_property == this->m_values->size())
       break;
 
   } // Looping through entries in the splitter vector
@@ -572,14 +608,14 @@ void TimeSeriesProperty<TYPE>::splitByTimeVector(
   sortIfNecessary();
 
   // work on m_values, m_size, and m_time
-  std::vector<Types::Core::DateAndTime> tsp_time_vec = this->timesAsVector();
+  const std::vector<int64_t> &tsp_time_vec = *m_times;
 
   // go over both filter time vector and time series property time vector
   size_t index_splitter = 0;
   size_t index_tsp_time = 0;
 
   // tsp_time is start time of time series property
-  DateAndTime tsp_time = tsp_time_vec[index_tsp_time];
+  DateAndTime tsp_time(tsp_time_vec[index_tsp_time]);
   DateAndTime split_start_time = splitter_time_vec[index_splitter];
   DateAndTime split_stop_time = splitter_time_vec[index_splitter + 1];
 
@@ -609,10 +645,9 @@ void TimeSeriesProperty<TYPE>::splitByTimeVector(
   // move along the entries to find the entry inside the current splitter
   bool first_splitter_after_last_entry(false);
   if (!no_entry_in_range) {
-    std::vector<DateAndTime>::iterator tsp_time_iter;
-    tsp_time_iter = std::lower_bound(tsp_time_vec.begin(), tsp_time_vec.end(),
-                                     split_start_time);
-    if (tsp_time_iter == tsp_time_vec.end()) {
+    const size_t tsp_time_index = lowerBoundIndex(
+        split_start_time.totalNanoseconds(), 0, tsp_time_vec.size());
+    if (tsp_time_index == tsp_time_vec.size()) {
       // the first splitter's start time is LATER than the last TSP entry, then
       // there won't be any
       // TSP entry to be split into any target splitter.
@@ -622,8 +657,8 @@ void TimeSeriesProperty<TYPE>::splitByTimeVector(
       // first splitter start time is between tsp_time_iter and the one before
       // it.
       // so the index for tsp_time_iter is the first TSP entry in the splitter
-      index_tsp_time = tsp_time_iter - tsp_time_vec.begin();
-      tsp_time = *tsp_time_iter;
+      index_tsp_time = tsp_time_index;
+      tsp_time = DateAndTime(tsp_time_vec[tsp_time_index]);
     }
   } else {
     // no entry in range is true, which corresponding to the previous case
@@ -668,20 +703,22 @@ void TimeSeriesProperty<TYPE>::splitByTimeVector(
 
       // add current entry
       if (outputs[target]->size() == 0 ||
-          outputs[target]->lastTime() < tsp_time_vec[index_tsp_time]) {
+          outputs[target]->lastTime().totalNanoseconds() <
+              tsp_time_vec[index_tsp_time]) {
         // avoid to add duplicate entry
-        outputs[target]->addValue(m_values[index_tsp_time].time(),
-                                  m_values[index_tsp_time].value());
+        outputs[target]->addValue(DateAndTime((*m_times)[index_tsp_time]),
+                                  (*m_values)[index_tsp_time]);
       }
 
       const size_t nextTspIndex = index_tsp_time + 1;
       if (nextTspIndex < tspTimeVecSize) {
-        if (tsp_time_vec[nextTspIndex] > split_stop_time) {
+        if (tsp_time_vec[nextTspIndex] > split_stop_time.totalNanoseconds()) {
           // next entry is out of this splitter: add the next one and quit
-          if (outputs[target]->lastTime() < m_values[nextTspIndex].time()) {
+          if (outputs[target]->lastTime().totalNanoseconds() <
+              (*m_times)[nextTspIndex]) {
             // avoid the duplicate cases occurred in fast frequency issue
-            outputs[target]->addValue(m_values[nextTspIndex].time(),
-                                      m_values[nextTspIndex].value());
+            outputs[target]->addValue(DateAndTime((*m_times)[nextTspIndex]),
+                                      (*m_values)[nextTspIndex]);
           }
           // FIXME - in future, need to find out WHETHER there is way to
           // skip the
@@ -720,9 +757,9 @@ void TimeSeriesProperty<TYPE>::splitByTimeVector(
       int target_i = target_vec[isplitter];
       if (fill_target_set.find(target_i) == fill_target_set.end()) {
         if (outputs[target_i]->size() == 0 ||
-            outputs[target_i]->lastTime() != m_values.back().time())
-          outputs[target_i]->addValue(m_values.back().time(),
-                                      m_values.back().value());
+            outputs[target_i]->lastTime() != DateAndTime(m_times->back()))
+          outputs[target_i]->addValue(DateAndTime(m_times->back()),
+                                      m_values->back());
         fill_target_set.insert(target_i);
         // quit loop if it goes over all the targets
         if (fill_target_set.size() == target_set.size())
@@ -801,54 +838,44 @@ void TimeSeriesProperty<TYPE>::makeFilterByValue(
   split.clear();
 
   // Do nothing if the log is empty.
-  if (m_values.empty())
+  if (m_values->empty())
     return;
 
   // 1. Sort
   sortIfNecessary();
 
-  // 2. Do the rest
+  // 2. Do the rest. Only the value column is scanned, the times are only
+  // looked at where the values move in or out of the range.
   bool lastGood(false);
   time_duration tol = DateAndTime::durationFromSeconds(TimeTolerance);
-  int numgood = 0;
-  DateAndTime t;
   DateAndTime start, stop;
 
-  for (size_t i = 0; i < m_values.size(); ++i) {
-    const DateAndTime lastTime = t;
-    // The new entry
-    t = m_values[i].time();
-    TYPE val = m_values[i].value();
-
+  for (size_t i = 0; i < m_values->size(); ++i) {
     // A good value?
-    const bool isGood = ((val >= min) && (val <= max));
-    if (isGood)
-      numgood++;
-
-    if (isGood != lastGood) {
-      // We switched from bad to good or good to bad
+    const bool isGood = (((*m_values)[i] >= min) && ((*m_values)[i] <= max));
+    if (isGood == lastGood)
+      continue;
 
-      if (isGood) {
-        // Start of a good section. Subtract tolerance from the time if
-        // boundaries are centred.
-        start = centre ? t - tol : t;
-      } else {
-        // End of the good section. Add tolerance to the LAST GOOD time if
-        // boundaries are centred.
-        // Otherwise, use the first 'bad' time.
-        stop = centre ? lastTime + tol : t;
-        split.emplace_back(start, stop, 0);
-        // Reset the number of good ones, for next time
-        numgood = 0;
-      }
-      lastGood = isGood;
+    // We switched from bad to good or good to bad
+    const DateAndTime t((*m_times)[i]);
+    if (isGood) {
+      // Start of a good section. Subtract tolerance from the time if
+      // boundaries are centred.
+      start = centre ? t - tol : t;
+    } else {
+      // End of the good section. Add tolerance to the LAST GOOD time if
+      // boundaries are centred.
+      // Otherwise, use the first 'bad' time.
+      stop = centre ? DateAndTime((*m_times)[i - 1]) + tol : t;
+      split.emplace_back(start, stop, 0);
     }
+    lastGood = isGood;
   }
 
-  if (numgood > 0) {
+  if (lastGood) {
     // The log ended on "good" so we need to close it using the last time we
     // found
-    stop = t + tol;
+    stop = DateAndTime(m_times->back()) + tol;
     split.emplace_back(start, stop, 0);
   }
 }
@@ -964,7 +991,7 @@ double TimeSeriesProperty<TYPE>::averageValueInFilter(
 
   // If there's just a single value in the log, return that.
   if (realSize() == 1) {
-    return static_cast<double>(m_values.front().value());
+    return static_cast<double>(m_values->front());
   }
 
   sortIfNecessary();
@@ -975,23 +1002,15 @@ double TimeSeriesProperty<TYPE>::averageValueInFilter(
     // Calculate the total time duration (in seconds) within by the filter
     totalTime += time.duration();
 
-    // Get the log value and index at the start time of the filter
+    // Get the index of the log value at the start time of the filter
     int index;
-    double value = getSingleValue(time.start(), index);
-    DateAndTime startTime = time.start();
-
-    while (index < realSize() - 1 && m_values[index + 1].time() < time.stop()) {
-      ++index;
-      numerator +=
-          DateAndTime::secondsFromDuration(m_values[index].time() - startTime) *
-          value;
-      startTime = m_values[index].time();
-      value = static_cast<double>(m_values[index].value());
-    }
-
-    // Now close off with the end of the current filter range
-    numerator +=
-        DateAndTime::secondsFromDuration(time.stop() - startTime) * value;
+    getSingleValue(time.start(), index);
+    numerator += integrateSteps(
+        *m_times, *m_values, static_cast<size_t>(index),
+        lowerBoundIndex(time.stop().totalNanoseconds(),
+                        static_cast<size_t>(index) + 1, m_times->size()),
+        time.start().totalNanoseconds(), time.stop().totalNanoseconds(),
+        [](const TYPE &value) { return static_cast<double>(value); });
   }
 
   // 'Normalise' by the total time
@@ -1043,26 +1062,18 @@ std::pair<double, double> TimeSeriesProperty<TYPE>::averageAndStdDevInFilter(
     // Calculate the total time duration (in seconds) within by the filter
     totalTime += time.duration();
 
-    // Get the log value and index at the start time of the filter
+    // Get the index of the log value at the start time of the filter
     int index;
-    double value = getSingleValue(time.start(), index);
-    double valuestddev = (value - mean) * (value - mean);
-    DateAndTime startTime = time.start();
-
-    while (index < realSize() - 1 && m_values[index + 1].time() < time.stop()) {
-      ++index;
-
-      numerator +=
-          DateAndTime::secondsFromDuration(m_values[index].time() - startTime) *
-          valuestddev;
-      startTime = m_values[index].time();
-      value = static_cast<double>(m_values[index].value());
-      valuestddev = (value - mean) * (value - mean);
-    }
-
-    // Now close off with the end of the current filter range
-    numerator +=
-        DateAndTime::secondsFromDuration(time.stop() - startTime) * valuestddev;
+    getSingleValue(time.start(), index);
+    numerator += integrateSteps(
+        *m_times, *m_values, static_cast<size_t>(index),
+        lowerBoundIndex(time.stop().totalNanoseconds(),
+                        static_cast<size_t>(index) + 1, m_times->size()),
+        time.start().totalNanoseconds(), time.stop().totalNanoseconds(),
+        [mean](const TYPE &value) {
+          const double deviation = static_cast<double>(value) - mean;
+          return deviation * deviation;
+        });
   }
 
   // Normalise by the total time
@@ -1104,9 +1115,9 @@ TimeSeriesProperty<TYPE>::valueAsCorrectMap() const {
   // 2. Data Strcture
   std::map<DateAndTime, TYPE> asMap;
 
-  if (!m_values.empty()) {
-    for (size_t i = 0; i < m_values.size(); i++)
-      asMap[m_values[i].time()] = m_values[i].value();
+  if (!m_values->empty()) {
+    for (size_t i = 0; i < m_values->size(); i++)
+      asMap[DateAndTime((*m_times)[i])] = (*m_values)[i];
   }
 
   return asMap;
@@ -1120,13 +1131,7 @@ template <typename TYPE>
 std::vector<TYPE> TimeSeriesProperty<TYPE>::valuesAsVector() const {
   sortIfNecessary();
 
-  std::vector<TYPE> out;
-  out.reserve(m_values.size());
-
-  for (size_t i = 0; i < m_values.size(); i++)
-    out.push_back(m_values[i].value());
-
-  return out;
+  return *m_values;
 }
 
 /**
@@ -1140,10 +1145,10 @@ std::multimap<DateAndTime, TYPE>
 TimeSeriesProperty<TYPE>::valueAsMultiMap() const {
   std::multimap<DateAndTime, TYPE> asMultiMap;
 
-  if (!m_values.empty()) {
-    for (size_t i = 0; i < m_values.size(); i++)
+  if (!m_values->empty()) {
+    for (size_t i = 0; i < m_values->size(); i++)
       asMultiMap.insert(
-          std::make_pair(m_values[i].time(), m_values[i].value()));
+          std::make_pair(DateAndTime((*m_times)[i]), (*m_values)[i]));
   }
 
   return asMultiMap;
@@ -1157,14 +1162,29 @@ template <typename TYPE>
 std::vector<DateAndTime> TimeSeriesProperty<TYPE>::timesAsVector() const {
   sortIfNecessary();
 
-  std::vector<DateAndTime> out;
-  out.reserve(m_values.size());
+  return std::vector<DateAndTime>(m_times->cbegin(), m_times->cend());
+}
 
-  for (size_t i = 0; i < m_values.size(); i++) {
-    out.push_back(m_values[i].time());
-  }
+/**
+ * Return the column of times of the series, without copying it. The values
+ * are sorted first if necessary.
+ * @return The times in nanoseconds since the DateAndTime epoch
+ */
+template <typename TYPE>
+const std::vector<int64_t> &TimeSeriesProperty<TYPE>::timeColumn() const {
+  sortIfNecessary();
+  return *m_times;
+}
 
-  return out;
+/**
+ * Return the column of values of the series, without copying it. The values
+ * are sorted by time first if necessary.
+ * @return The values, in the order of timeColumn()
+ */
+template <typename TYPE>
+const std::vector<TYPE> &TimeSeriesProperty<TYPE>::valueColumn() const {
+  sortIfNecessary();
+  return *m_values;
 }
 
 /**
@@ -1178,11 +1198,11 @@ std::vector<double> TimeSeriesProperty<TYPE>::timesAsVectorSeconds() const {
 
   // 2. Output data structure
   std::vector<double> out;
-  out.reserve(m_values.size());
+  out.reserve(m_values->size());
 
-  Types::Core::DateAndTime start = m_values[0].time();
-  for (size_t i = 0; i < m_values.size(); i++) {
-    out.push_back(DateAndTime::secondsFromDuration(m_values[i].time() - start));
+  const int64_t start = (*m_times)[0];
+  for (const auto time : *m_times) {
+    out.push_back(static_cast<double>(time - start) / 1e9);
   }
 
   return out;
@@ -1196,9 +1216,9 @@ std::vector<double> TimeSeriesProperty<TYPE>::timesAsVectorSeconds() const {
 template <typename TYPE>
 void TimeSeriesProperty<TYPE>::addValue(const Types::Core::DateAndTime &time,
                                         const TYPE value) {
-  TimeValueUnit<TYPE> newvalue(time, value);
-  // Add the value to the back of the vector
-  m_values.push_back(newvalue);
+  // Add the value to the back of the columns
+  m_times.access().push_back(time.totalNanoseconds());
+  m_values.access().push_back(value);
   // Increment the separate record of the property's size
   m_size++;
 
@@ -1209,11 +1229,11 @@ void TimeSeriesProperty<TYPE>::addValue(const Types::Core::DateAndTime &time,
     // First item, must be sorted.
     m_propSortedFlag = TimeSeriesSortStatus::TSSORTED;
   } else if (m_propSortedFlag == TimeSeriesSortStatus::TSUNKNOWN &&
-             m_values.back() < *(m_values.rbegin() + 1)) {
+             m_times->back() < *(m_times->rbegin() + 1)) {
     // Previously unknown and still unknown
     m_propSortedFlag = TimeSeriesSortStatus::TSUNSORTED;
   } else if (m_propSortedFlag == TimeSeriesSortStatus::TSSORTED &&
-             m_values.back() < *(m_values.rbegin() + 1)) {
+             m_times->back() < *(m_times->rbegin() + 1)) {
     // Previously sorted but last added is not in order
     m_propSortedFlag = TimeSeriesSortStatus::TSUNSORTED;
   }
@@ -1258,9 +1278,14 @@ void TimeSeriesProperty<TYPE>::addValues(
     const std::vector<TYPE> &values) {
   size_t length = std::min(times.size(), values.size());
   m_size += static_cast<int>(length);
+  auto &timeColumn = m_times.access();
+  auto &valueColumn = m_values.access();
+  timeColumn.reserve(timeColumn.size() + length);
   for (size_t i = 0; i < length; ++i) {
-    m_values.emplace_back(times[i], values[i]);
+    timeColumn.push_back(times[i].totalNanoseconds());
   }
+  valueColumn.insert(valueColumn.end(), values.cbegin(),
+                     values.cbegin() + length);
 
   if (!values.empty())
     m_propSortedFlag = TimeSeriesSortStatus::TSUNKNOWN;
@@ -1285,7 +1310,7 @@ void TimeSeriesProperty<TYPE>::replaceValues(
  */
 template <typename TYPE>
 DateAndTime TimeSeriesProperty<TYPE>::lastTime() const {
-  if (m_values.empty()) {
+  if (m_values->empty()) {
     const std::string error("lastTime(): TimeSeriesProperty '" + name() +
                             "' is empty");
     g_log.debug(error);
@@ -1294,14 +1319,14 @@ DateAndTime TimeSeriesProperty<TYPE>::lastTime() const {
 
   sortIfNecessary();
 
-  return m_values.rbegin()->time();
+  return DateAndTime(m_times->back());
 }
 
 /** Returns the first value regardless of filter
  *  @return Value
  */
 template <typename TYPE> TYPE TimeSeriesProperty<TYPE>::firstValue() const {
-  if (m_values.empty()) {
+  if (m_values->empty()) {
     const std::string error("firstValue(): TimeSeriesProperty '" + name() +
                             "' is empty");
     g_log.debug(error);
@@ -1310,7 +1335,7 @@ template <typename TYPE> TYPE TimeSeriesProperty<TYPE>::firstValue() const {
 
   sortIfNecessary();
 
-  return m_values[0].value();
+  return (*m_values)[0];
 }
 
 /** Returns the first time regardless of filter
@@ -1318,7 +1343,7 @@ template <typename TYPE> TYPE TimeSeriesProperty<TYPE>::firstValue() const {
  */
 template <typename TYPE>
 DateAndTime TimeSeriesProperty<TYPE>::firstTime() const {
-  if (m_values.empty()) {
+  if (m_values->empty()) {
     const std::string error("firstTime(): TimeSeriesProperty '" + name() +
                             "' is empty");
     g_log.debug(error);
@@ -1327,7 +1352,7 @@ DateAndTime TimeSeriesProperty<TYPE>::firstTime() const {
 
   sortIfNecessary();
 
-  return m_values[0].time();
+  return DateAndTime((*m_times)[0]);
 }
 
 /**
@@ -1335,7 +1360,7 @@ DateAndTime TimeSeriesProperty<TYPE>::firstTime() const {
  *  @return Value
  */
 template <typename TYPE> TYPE TimeSeriesProperty<TYPE>::lastValue() const {
-  if (m_values.empty()) {
+  if (m_values->empty()) {
     const std::string error("lastValue(): TimeSeriesProperty '" + name() +
                             "' is empty");
     g_log.debug(error);
@@ -1344,19 +1369,15 @@ template <typename TYPE> TYPE TimeSeriesProperty<TYPE>::lastValue() const {
 
   sortIfNecessary();
 
-  return m_values.rbegin()->value();
+  return m_values->back();
 }
 
 template <typename TYPE> TYPE TimeSeriesProperty<TYPE>::minValue() const {
-  return std::min_element(m_values.begin(), m_values.end(),
-                          TimeValueUnit<TYPE>::valueCmp)
-      ->value();
+  return *std::min_element(m_values->begin(), m_values->end());
 }
 
 template <typename TYPE> TYPE TimeSeriesProperty<TYPE>::maxValue() const {
-  return std::max_element(m_values.begin(), m_values.end(),
-                          TimeValueUnit<TYPE>::valueCmp)
-      ->value();
+  return *std::max_element(m_values->begin(), m_values->end());
 }
 
 /// Returns the number of values at UNIQUE time intervals in the time series
@@ -1370,7 +1391,7 @@ template <typename TYPE> int TimeSeriesProperty<TYPE>::size() const {
  * the number of entries, including repeated ones.
  */
 template <typename TYPE> int TimeSeriesProperty<TYPE>::realSize() const {
-  return static_cast<int>(m_values.size());
+  return static_cast<int>(m_values->size());
 }
 
 /*
@@ -1381,10 +1402,10 @@ template <typename TYPE> std::string TimeSeriesProperty<TYPE>::value() const {
   sortIfNecessary();
 
   std::stringstream ins;
-  for (size_t i = 0; i < m_values.size(); i++) {
+  for (size_t i = 0; i < m_values->size(); i++) {
     try {
-      ins << m_values[i].time().toSimpleString();
-      ins << "  " << m_values[i].value() << "\n";
+      ins << DateAndTime((*m_times)[i]).toSimpleString();
+      ins << "  " << (*m_values)[i] << "\n";
     } catch (...) {
       // Some kind of error; for example, invalid year, can occur when
       // converting boost time.
@@ -1405,11 +1426,12 @@ std::vector<std::string> TimeSeriesProperty<TYPE>::time_tValue() const {
   sortIfNecessary();
 
   std::vector<std::string> values;
-  values.reserve(m_values.size());
+  values.reserve(m_values->size());
 
-  for (size_t i = 0; i < m_values.size(); i++) {
+  for (size_t i = 0; i < m_values->size(); i++) {
     std::stringstream line;
-    line << m_values[i].time().toSimpleString() << " " << m_values[i].value();
+    line << DateAndTime((*m_times)[i]).toSimpleString() << " "
+         << (*m_values)[i];
     values.push_back(line.str());
   }
 
@@ -1431,17 +1453,17 @@ std::map<DateAndTime, TYPE> TimeSeriesProperty<TYPE>::valueAsMap() const {
   // 2. Build map
 
   std::map<DateAndTime, TYPE> asMap;
-  if (m_values.empty())
+  if (m_values->empty())
     return asMap;
 
-  TYPE d = m_values[0].value();
-  asMap[m_values[0].time()] = d;
+  TYPE d = (*m_values)[0];
+  asMap[DateAndTime((*m_times)[0])] = d;
 
-  for (size_t i = 1; i < m_values.size(); i++) {
-    if (m_values[i].value() != d) {
+  for (size_t i = 1; i < m_values->size(); i++) {
+    if ((*m_values)[i] != d) {
       // Only put entry with different value from last entry to map
-      asMap[m_values[i].time()] = m_values[i].value();
-      d = m_values[i].value();
+      asMap[DateAndTime((*m_times)[i])] = (*m_values)[i];
+      d = (*m_values)[i];
     }
   }
   return asMap;
@@ -1488,7 +1510,8 @@ std::string TimeSeriesProperty<TYPE>::setDataItem(
  */
 template <typename TYPE> void TimeSeriesProperty<TYPE>::clear() {
   m_size = 0;
-  m_values.clear();
+  m_times = boost::make_shared<std::vector<int64_t>>();
+  m_values = boost::make_shared<std::vector<TYPE>>();
 
   m_propSortedFlag = TimeSeriesSortStatus::TSSORTED;
   m_filterApplied = false;
@@ -1503,9 +1526,11 @@ template <typename TYPE> void TimeSeriesProperty<TYPE>::clear() {
  */
 template <typename TYPE> void TimeSeriesProperty<TYPE>::clearOutdated() {
   if (realSize() > 1) {
-    auto lastValue = m_values.back();
+    const auto lastTime = m_times->back();
+    const TYPE lastValue = m_values->back();
     clear();
-    m_values.push_back(lastValue);
+    m_times.access().push_back(lastTime);
+    m_values.access().push_back(lastValue);
     m_size = 1;
   }
 }
@@ -1551,23 +1576,24 @@ void TimeSeriesProperty<TYPE>::create(
                                 "for the time and values vectors.");
 
   clear();
-  m_values.reserve(new_times.size());
+  auto &times = m_times.access();
+  times.reserve(new_times.size());
 
   std::size_t num = new_values.size();
 
   m_propSortedFlag = TimeSeriesSortStatus::TSSORTED;
   for (std::size_t i = 0; i < num; i++) {
-    TimeValueUnit<TYPE> newentry(new_times[i], new_values[i]);
-    m_values.push_back(newentry);
+    times.push_back(new_times[i].totalNanoseconds());
     if (m_propSortedFlag == TimeSeriesSortStatus::TSSORTED && i > 0 &&
-        new_times[i - 1] > new_times[i]) {
+        times[i - 1] > times[i]) {
       // Status gets to unsorted
       m_propSortedFlag = TimeSeriesSortStatus::TSUNSORTED;
     }
   }
+  m_values = boost::make_shared<std::vector<TYPE>>(new_values);
 
   // reset the size
-  m_size = static_cast<int>(m_values.size());
+  m_size = static_cast<int>(m_values->size());
 }
 
 /** Returns the value at a particular time
@@ -1577,7 +1603,7 @@ void TimeSeriesProperty<TYPE>::create(
 template <typename TYPE>
 TYPE TimeSeriesProperty<TYPE>::getSingleValue(
     const Types::Core::DateAndTime &t) const {
-  if (m_values.empty()) {
+  if (m_values->empty()) {
     const std::string error("getSingleValue(): TimeSeriesProperty '" + name() +
                             "' is empty");
     g_log.debug(error);
@@ -1589,12 +1615,12 @@ TYPE TimeSeriesProperty<TYPE>::getSingleValue(
 
   // 2.
   TYPE value;
-  if (t < m_values[0].time()) {
+  if (t < DateAndTime((*m_times)[0])) {
     // 1. Out side of lower bound
-    value = m_values[0].value();
-  } else if (t >= m_values.back().time()) {
+    value = (*m_values)[0];
+  } else if (t >= DateAndTime(m_times->back())) {
     // 2. Out side of upper bound
-    value = m_values.back().value();
+    value = m_values->back();
   } else {
     // 3. Within boundary
     int index = this->findIndex(t);
@@ -1602,17 +1628,17 @@ TYPE TimeSeriesProperty<TYPE>::getSingleValue(
     if (index < 0) {
       // If query time "t" is earlier than the begin time of the series
       index = 0;
-    } else if (index == int(m_values.size())) {
+    } else if (index == int(m_values->size())) {
       // If query time "t" is later than the end time of the  series
-      index = static_cast<int>(m_values.size()) - 1;
-    } else if (index > int(m_values.size())) {
+      index = static_cast<int>(m_values->size()) - 1;
+    } else if (index > int(m_values->size())) {
       std::stringstream errss;
       errss << "TimeSeriesProperty.findIndex() returns index (" << index
-            << " ) > maximum defined value " << m_values.size();
+            << " ) > maximum defined value " << m_values->size();
       throw std::logic_error(errss.str());
     }
 
-    value = m_values[static_cast<size_t>(index)].value();
+    value = (*m_values)[static_cast<size_t>(index)];
   }
 
   return value;
@@ -1626,7 +1652,7 @@ TYPE TimeSeriesProperty<TYPE>::getSingleValue(
 template <typename TYPE>
 TYPE TimeSeriesProperty<TYPE>::getSingleValue(const Types::Core::DateAndTime &t,
                                               int &index) const {
-  if (m_values.empty()) {
+  if (m_values->empty()) {
     const std::string error("getSingleValue(): TimeSeriesProperty '" + name() +
                             "' is empty");
     g_log.debug(error);
@@ -1638,14 +1664,14 @@ TYPE TimeSeriesProperty<TYPE>::getSingleValue(const Types::Core::DateAndTime &t,
 
   // 2.
   TYPE value;
-  if (t < m_values[0].time()) {
+  if (t < DateAndTime((*m_times)[0])) {
     // 1. Out side of lower bound
-    value = m_values[0].value();
+    value = (*m_values)[0];
     index = 0;
-  } else if (t >= m_values.back().time()) {
+  } else if (t >= DateAndTime(m_times->back())) {
     // 2. Out side of upper bound
-    value = m_values.back().value();
-    index = int(m_values.size()) - 1;
+    value = m_values->back();
+    index = int(m_values->size()) - 1;
   } else {
     // 3. Within boundary
     index = this->findIndex(t);
@@ -1653,17 +1679,17 @@ TYPE TimeSeriesProperty<TYPE>::getSingleValue(const Types::Core::DateAndTime &t,
     if (index < 0) {
       // If query time "t" is earlier than the begin time of the series
       index = 0;
-    } else if (index == int(m_values.size())) {
+    } else if (index == int(m_values->size())) {
       // If query time "t" is later than the end time of the  series
-      index = static_cast<int>(m_values.size()) - 1;
-    } else if (index > int(m_values.size())) {
+      index = static_cast<int>(m_values->size()) - 1;
+    } else if (index > int(m_values->size())) {
       std::stringstream errss;
       errss << "TimeSeriesProperty.findIndex() returns index (" << index
-            << " ) > maximum defined value " << m_values.size();
+            << " ) > maximum defined value " << m_values->size();
       throw std::logic_error(errss.str());
     }
 
-    value = m_values[static_cast<size_t>(index)].value();
+    value = (*m_values)[static_cast<size_t>(index)];
   }
 
   return value;
@@ -1682,7 +1708,7 @@ TYPE TimeSeriesProperty<TYPE>::getSingleValue(const Types::Core::DateAndTime &t,
 template <typename TYPE>
 TimeInterval TimeSeriesProperty<TYPE>::nthInterval(int n) const {
   // 0. Throw exception
-  if (m_values.empty()) {
+  if (m_values->empty()) {
     const std::string error("nthInterval(): TimeSeriesProperty '" + name() +
                             "' is empty");
     g_log.debug(error);
@@ -1698,21 +1724,23 @@ TimeInterval TimeSeriesProperty<TYPE>::nthInterval(int n) const {
 
   if (m_filter.empty()) {
     // I. No filter
-    if (n >= static_cast<int>(m_values.size()) ||
-        (n == static_cast<int>(m_values.size()) - 1 && m_values.size() == 1)) {
+    if (n >= static_cast<int>(m_values->size()) ||
+        (n == static_cast<int>(m_values->size()) - 1 &&
+         m_values->size() == 1)) {
       // 1. Out of bound
       ;
-    } else if (n == static_cast<int>(m_values.size()) - 1) {
+    } else if (n == static_cast<int>(m_values->size()) - 1) {
       // 2. Last one by making up an end time.
       time_duration d =
-          m_values.rbegin()->time() - (m_values.rbegin() + 1)->time();
-      DateAndTime endTime = m_values.rbegin()->time() + d;
-      Kernel::TimeInterval dt(m_values.rbegin()->time(), endTime);
+          DateAndTime(m_times->back()) - DateAndTime(*(m_times->rbegin() + 1));
+      DateAndTime endTime = DateAndTime(m_times->back()) + d;
+      Kernel::TimeInterval dt(DateAndTime(m_times->back()), endTime);
       deltaT = dt;
     } else {
       // 3. Regular
-      DateAndTime startT = m_values[static_cast<std::size_t>(n)].time();
-      DateAndTime endT = m_values[static_cast<std::size_t>(n) + 1].time();
+      const auto index = static_cast<std::size_t>(n);
+      DateAndTime startT = DateAndTime((*m_times)[index]);
+      DateAndTime endT = DateAndTime((*m_times)[index + 1]);
       TimeInterval dt(startT, endT);
       deltaT = dt;
     }
@@ -1728,8 +1756,8 @@ TimeInterval TimeSeriesProperty<TYPE>::nthInterval(int n) const {
       // 2. n = size of the allowed region, duplicate the last one
       auto ind_t1 = static_cast<long>(m_filterQuickRef.back().first);
       long ind_t2 = ind_t1 - 1;
-      Types::Core::DateAndTime t1 = (m_values.begin() + ind_t1)->time();
-      Types::Core::DateAndTime t2 = (m_values.begin() + ind_t2)->time();
+      Types::Core::DateAndTime t1(*(m_times->begin() + ind_t1));
+      Types::Core::DateAndTime t2(*(m_times->begin() + ind_t2));
       time_duration d = t1 - t2;
       Types::Core::DateAndTime t3 = t1 + d;
       Kernel::TimeInterval dt(t1, t3);
@@ -1752,7 +1780,7 @@ TimeInterval TimeSeriesProperty<TYPE>::nthInterval(int n) const {
           m_filter[m_filterQuickRef[refindex].first].first;
       size_t iStartIndex =
           m_filterQuickRef[refindex + 1].first + static_cast<size_t>(diff);
-      Types::Core::DateAndTime ltime0 = m_values[iStartIndex].time();
+      Types::Core::DateAndTime ltime0 = DateAndTime((*m_times)[iStartIndex]);
       if (iStartIndex == 0 && ftime0 < ltime0) {
         // a) Special case that True-filter time starts before log time
         t0 = ltime0;
@@ -1767,14 +1795,14 @@ TimeInterval TimeSeriesProperty<TYPE>::nthInterval(int n) const {
 
       // ii) end time
       size_t iStopIndex = iStartIndex + 1;
-      if (iStopIndex >= m_values.size()) {
+      if (iStopIndex >= m_values->size()) {
         // a) Last log entry is for the start
         Types::Core::DateAndTime ftimef =
             m_filter[m_filterQuickRef[refindex + 3].first].first;
         tf = ftimef;
       } else {
         // b) Using the earlier value of next log entry and next filter entry
-        Types::Core::DateAndTime ltimef = m_values[iStopIndex].time();
+        Types::Core::DateAndTime ltimef = DateAndTime((*m_times)[iStopIndex]);
         Types::Core::DateAndTime ftimef =
             m_filter[m_filterQuickRef[refindex + 3].first].first;
         if (ltimef < ftimef)
@@ -1801,7 +1829,7 @@ template <typename TYPE> TYPE TimeSeriesProperty<TYPE>::nthValue(int n) const {
   TYPE value;
 
   // 1. Throw error if property is empty
-  if (m_values.empty()) {
+  if (m_values->empty()) {
     const std::string error("nthValue(): TimeSeriesProperty '" + name() +
                             "' is empty");
     g_log.debug(error);
@@ -1813,13 +1841,10 @@ template <typename TYPE> TYPE TimeSeriesProperty<TYPE>::nthValue(int n) const {
 
   if (m_filter.empty()) {
     // 3. Situation 1:  No filter
-    if (static_cast<size_t>(n) < m_values.size()) {
-      TimeValueUnit<TYPE> entry = m_values[static_cast<std::size_t>(n)];
-      value = entry.value();
+    if (static_cast<size_t>(n) < m_values->size()) {
+      value = (*m_values)[static_cast<std::size_t>(n)];
     } else {
-      TimeValueUnit<TYPE> entry =
-          m_values[static_cast<std::size_t>(m_size) - 1];
-      value = entry.value();
+      value = (*m_values)[static_cast<std::size_t>(m_size) - 1];
     }
   } else {
     // 4. Situation 2: There is filter
@@ -1828,7 +1853,7 @@ template <typename TYPE> TYPE TimeSeriesProperty<TYPE>::nthValue(int n) const {
     if (static_cast<size_t>(n) > m_filterQuickRef.back().second + 1) {
       // 1. n >= size of the allowed region
       size_t ilog = (m_filterQuickRef.rbegin() + 1)->first;
-      value = m_values[ilog].value();
+      value = (*m_values)[ilog];
     } else {
       // 2. n < size
       Types::Core::DateAndTime t0;
@@ -1841,7 +1866,7 @@ template <typename TYPE> TYPE TimeSeriesProperty<TYPE>::nthValue(int n) const {
       size_t ilog =
           m_filterQuickRef[refindex + 1].first +
           (static_cast<std::size_t>(n) - m_filterQuickRef[refindex].second);
-      value = m_values[ilog].value();
+      value = (*m_values)[ilog];
     } // END-IF-ELSE Cases
   }
 
@@ -1857,17 +1882,17 @@ template <typename TYPE>
 Types::Core::DateAndTime TimeSeriesProperty<TYPE>::nthTime(int n) const {
   sortIfNecessary();
 
-  if (m_values.empty()) {
+  if (m_values->empty()) {
     const std::string error("nthTime(): TimeSeriesProperty '" + name() +
                             "' is empty");
     g_log.debug(error);
     throw std::runtime_error(error);
   }
 
-  if (n < 0 || n >= static_cast<int>(m_values.size()))
-    n = static_cast<int>(m_values.size()) - 1;
+  if (n < 0 || n >= static_cast<int>(m_values->size()))
+    n = static_cast<int>(m_values->size()) - 1;
 
-  return m_values[static_cast<size_t>(n)].time();
+  return DateAndTime((*m_times)[static_cast<size_t>(n)]);
 }
 
 /* Divide the property into  allowed and disallowed time intervals according to
@@ -1925,12 +1950,13 @@ void TimeSeriesProperty<TYPE>::filterWith(
   // 2b) Get a clean finish
   if (filtervalues.back()) {
     DateAndTime lastTime, nextLastT;
-    if (m_values.back().time() > filtertimes.back()) {
-      const size_t nvalues(m_values.size());
+    if (DateAndTime(m_times->back()) > filtertimes.back()) {
+      const size_t nvalues(m_values->size());
       // Last log time is later than last filter time
-      lastTime = m_values.back().time();
-      if (nvalues > 1 && m_values[nvalues - 2].time() > filtertimes.back())
-        nextLastT = m_values[nvalues - 2].time();
+      lastTime = DateAndTime(m_times->back());
+      if (nvalues > 1 &&
+          DateAndTime((*m_times)[nvalues - 2]) > filtertimes.back())
+        nextLastT = DateAndTime((*m_times)[nvalues - 2]);
       else
         nextLastT = filtertimes.back();
     } else {
@@ -1941,10 +1967,10 @@ void TimeSeriesProperty<TYPE>::filterWith(
       // this
       // else it is the last value time
       if (nfilterValues > 1 &&
-          m_values.back().time() > filtertimes[nfilterValues - 2])
+          DateAndTime(m_times->back()) > filtertimes[nfilterValues - 2])
         nextLastT = filtertimes[nfilterValues - 2];
       else
-        nextLastT = m_values.back().time();
+        nextLastT = DateAndTime(m_times->back());
     }
 
     time_duration dtime = lastTime - nextLastT;
@@ -1970,20 +1996,20 @@ template <typename TYPE> void TimeSeriesProperty<TYPE>::clearFilter() {
 template <typename TYPE> void TimeSeriesProperty<TYPE>::countSize() const {
   if (m_filter.empty()) {
     // 1. Not filter
-    m_size = int(m_values.size());
+    m_size = int(m_values->size());
   } else {
     // 2. With Filter
     if (!m_filterApplied) {
       this->applyFilter();
     }
-    size_t nvalues = m_filterQuickRef.empty() ? m_values.size()
+    size_t nvalues = m_filterQuickRef.empty() ? m_values->size()
                                               : m_filterQuickRef.back().second;
     // The filter logic can end up with the quick ref having a duplicate of the
     // last time and value at the end if the last filter time is past the log
     // time See "If it is out of upper boundary, still record it.  but make the
     // log entry to mP.size()+1" in applyFilter
     // Make the log seem the full size
-    if (nvalues == m_values.size() + 1) {
+    if (nvalues == m_values->size() + 1) {
       --nvalues;
     }
     m_size = static_cast<int>(nvalues);
@@ -2071,27 +2097,34 @@ template <typename TYPE> void TimeSeriesProperty<TYPE>::eliminateDuplicates() {
 
   // 2. Detect and Remove Duplicated
   size_t numremoved = 0;
-
-  typename std::vector<TimeValueUnit<TYPE>>::iterator vit;
-  vit = m_values.begin() + 1;
-  Types::Core::DateAndTime prevtime = m_values.begin()->time();
-  while (vit != m_values.end()) {
-    Types::Core::DateAndTime currtime = vit->time();
-    if (prevtime == currtime) {
-      // Print out warning
-      g_log.debug() << "Entry @ Time = " << prevtime
-                    << "has duplicate time stamp.  Remove entry with Value = "
-                    << (vit - 1)->value() << "\n";
-
-      // A duplicated entry!
-      vit = m_values.erase(vit - 1);
-
-      numremoved++;
+  // Columns shared with copies of the property are left alone if there is
+  // nothing to remove
+  if (std::adjacent_find(m_times->cbegin(), m_times->cend()) !=
+      m_times->cend()) {
+    // Of the entries with the same time only the last one is kept. The kept
+    // entries are moved forward in place.
+    auto &times = m_times.access();
+    auto &values = m_values.access();
+    const size_t nvalues = values.size();
+    size_t nkept = 0;
+    for (size_t i = 0; i < nvalues; ++i) {
+      if (i + 1 < nvalues && times[i] == times[i + 1]) {
+        // Print out warning
+        g_log.debug()
+            << "Entry @ Time = " << DateAndTime(times[i])
+            << "has duplicate time stamp.  Remove entry with Value = "
+            << values[i] << "\n";
+        numremoved++;
+        continue;
+      }
+      if (nkept != i) {
+        times[nkept] = times[i];
+        values[nkept] = values[i];
+      }
+      ++nkept;
     }
-
-    // b) progress
-    prevtime = currtime;
-    ++vit;
+    times.resize(nkept);
+    values.resize(nkept);
   }
 
   // update m_size
@@ -2109,8 +2142,8 @@ template <typename TYPE> void TimeSeriesProperty<TYPE>::eliminateDuplicates() {
 template <typename TYPE>
 std::string TimeSeriesProperty<TYPE>::toString() const {
   std::stringstream ss;
-  for (size_t i = 0; i < m_values.size(); ++i)
-    ss << m_values[i].time() << "\t\t" << m_values[i].value() << "\n";
+  for (size_t i = 0; i < m_values->size(); ++i)
+    ss << DateAndTime((*m_times)[i]) << "\t\t" << (*m_values)[i] << "\n";
 
   return ss.str();
 }
@@ -2127,7 +2160,7 @@ std::string TimeSeriesProperty<TYPE>::toString() const {
 template <typename TYPE>
 void TimeSeriesProperty<TYPE>::sortIfNecessary() const {
   if (m_propSortedFlag == TimeSeriesSortStatus::TSUNKNOWN) {
-    bool sorted = is_sorted(m_values.begin(), m_values.end());
+    bool sorted = std::is_sorted(m_times->begin(), m_times->end());
     if (sorted)
       m_propSortedFlag = TimeSeriesSortStatus::TSSORTED;
     else
@@ -2137,7 +2170,25 @@ void TimeSeriesProperty<TYPE>::sortIfNecessary() const {
   if (m_propSortedFlag == TimeSeriesSortStatus::TSUNSORTED) {
     g_log.information(
         "TimeSeriesProperty is not sorted.  Sorting is operated on it. ");
-    std::stable_sort(m_values.begin(), m_values.end());
+    // Sort an index by time, then gather both columns in that order
+    const size_t nvalues = m_times->size();
+    std::vector<size_t> order(nvalues);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [this](size_t a, size_t b) {
+      return (*m_times)[a] < (*m_times)[b];
+    });
+    std::vector<int64_t> times;
+    std::vector<TYPE> values;
+    times.reserve(nvalues);
+    values.reserve(nvalues);
+    for (const auto i : order) {
+      times.push_back((*m_times)[i]);
+      values.push_back((*m_values)[i]);
+    }
+    // The sorted columns are new, so copies of the property sharing the old
+    // ones are not disturbed
+    m_times = boost::make_shared<std::vector<int64_t>>(std::move(times));
+    m_values = boost::make_shared<std::vector<TYPE>>(std::move(values));
     m_propSortedFlag = TimeSeriesSortStatus::TSSORTED;
   }
 }
@@ -2151,31 +2202,89 @@ void TimeSeriesProperty<TYPE>::sortIfNecessary() const {
 template <typename TYPE>
 int TimeSeriesProperty<TYPE>::findIndex(Types::Core::DateAndTime t) const {
   // 0. Return with an empty container
-  if (m_values.empty())
+  if (m_values->empty())
     return 0;
 
   // 1. Sort
   sortIfNecessary();
 
   // 2. Extreme value
-  if (t <= m_values[0].time()) {
+  const int64_t time = t.totalNanoseconds();
+  if (time <= (*m_times)[0]) {
     return -1;
-  } else if (t >= m_values.back().time()) {
-    return (int(m_values.size()));
+  } else if (time >= m_times->back()) {
+    return (int(m_values->size()));
   }
 
-  // 3. Find by lower_bound()
-  typename std::vector<TimeValueUnit<TYPE>>::const_iterator fid;
-  TimeValueUnit<TYPE> temp(t, m_values[0].value());
-  fid = std::lower_bound(m_values.begin(), m_values.end(), temp);
-
-  int newindex = int(fid - m_values.begin());
-  if (fid->time() > t)
+  // 3. Find by lower bound
+  int newindex = int(lowerBoundIndex(time, 0, m_times->size()));
+  if ((*m_times)[newindex] > time)
     newindex--;
 
   return newindex;
 }
 
+/** Find the first entry at or after a time in a range of the sorted series.
+ * Sample environment logs are mostly recorded at a steady rate, so the search
+ * starts from the position interpolated between the times at the ends of the
+ * range. It then gallops away from there in steps of doubling size until the
+ * time is bracketed, and finishes with a binary search.
+ * @param t :: The time in nanoseconds
+ * @param first :: The start of the range to search
+ * @param last :: One past the end of the range to search
+ * @return The index of the first entry in [first, last) with a time not
+ * earlier than t, or last if there is none
+ */
+template <typename TYPE>
+size_t TimeSeriesProperty<TYPE>::lowerBoundIndex(const int64_t t,
+                                                 const size_t first,
+                                                 const size_t last) const {
+  if (first >= last || t <= (*m_times)[first])
+    return first;
+  if (t > (*m_times)[last - 1])
+    return last;
+
+  // (*m_times)[first] < t <= (*m_times)[last - 1], so the guess is in range
+  const auto fraction =
+      static_cast<double>(t - (*m_times)[first]) /
+      static_cast<double>((*m_times)[last - 1] - (*m_times)[first]);
+  const size_t guess = first + static_cast<size_t>(
+                                   fraction *
+                                   static_cast<double>(last - 1 - first));
+
+  // Bracket the answer with lo <= answer <= hi
+  size_t lo, hi;
+  size_t step = 1;
+  if ((*m_times)[guess] < t) {
+    lo = guess + 1;
+    hi = last - 1;
+    while (guess + step < last - 1) {
+      const size_t probe = guess + step;
+      if ((*m_times)[probe] >= t) {
+        hi = probe;
+        break;
+      }
+      lo = probe + 1;
+      step *= 2;
+    }
+  } else {
+    lo = first;
+    hi = guess;
+    while (guess > first + step) {
+      const size_t probe = guess - step;
+      if ((*m_times)[probe] < t) {
+        lo = probe + 1;
+        break;
+      }
+      hi = probe;
+      step *= 2;
+    }
+  }
+  return static_cast<size_t>(
+      std::lower_bound(m_times->begin() + lo, m_times->begin() + hi + 1, t) -
+      m_times->begin());
+}
+
 /** Find the upper_bound of time t in container.
  * Search range:  begin+istart to begin+iend
  * Return C[ir] == t or C[ir] > t and C[ir-1] < t
@@ -2189,7 +2298,7 @@ int TimeSeriesProperty<TYPE>::upperBound(Types::Core::DateAndTime t, int istart,
   if (istart < 0) {
     throw std::invalid_argument("Start Index cannot be less than 0");
   }
-  if (iend >= static_cast<int>(m_values.size())) {
+  if (iend >= static_cast<int>(m_values->size())) {
     throw std::invalid_argument("End Index cannot exceed the boundary");
   }
   if (istart > iend) {
@@ -2197,28 +2306,20 @@ int TimeSeriesProperty<TYPE>::upperBound(Types::Core::DateAndTime t, int istart,
   }
 
   // 1. Return instantly if it is out of boundary
-  if (t < (m_values.begin() + istart)->time()) {
+  const int64_t time = t.totalNanoseconds();
+  if (time < (*m_times)[istart]) {
     return -1;
   }
-  if (t > (m_values.begin() + iend)->time()) {
-    return static_cast<int>(m_values.size());
+  if (time > (*m_times)[iend]) {
+    return static_cast<int>(m_values->size());
   }
 
   // 2. Sort
   sortIfNecessary();
 
-  // 3. Construct the pair for comparison and do lower_bound()
-  TimeValueUnit<TYPE> temppair(t, m_values[0].value());
-  typename std::vector<TimeValueUnit<TYPE>>::iterator fid;
-  fid = std::lower_bound((m_values.begin() + istart),
-                         (m_values.begin() + iend + 1), temppair);
-  if (fid == m_values.end())
-    throw std::runtime_error("Cannot find data");
-
-  // 4. Calculate return value
-  size_t index = size_t(fid - m_values.begin());
-
-  return int(index);
+  // 3. Do lower bound and return the index
+  return static_cast<int>(lowerBoundIndex(time, static_cast<size_t>(istart),
+                                          static_cast<size_t>(iend) + 1));
 }
 
 /*
@@ -2247,9 +2348,9 @@ template <typename TYPE> void TimeSeriesProperty<TYPE>::applyFilter() const {
       if (icurlog > 0)
         istart = icurlog - 1;
 
-      if (icurlog < static_cast<int>(m_values.size()))
+      if (icurlog < static_cast<int>(m_values->size()))
         icurlog = this->upperBound(m_filter[ift].first, istart,
-                                   static_cast<int>(m_values.size()) - 1);
+                                   static_cast<int>(m_values->size()) - 1);
 
       if (icurlog < 0) {
         // i. If it is out of lower boundary, add filter time, add 0 time
@@ -2261,14 +2362,14 @@ template <typename TYPE> void TimeSeriesProperty<TYPE>::applyFilter() const {
         m_filterQuickRef.emplace_back(0, 0);
 
         icurlog = 0;
-      } else if (icurlog >= static_cast<int>(m_values.size())) {
+      } else if (icurlog >= static_cast<int>(m_values->size())) {
         // ii.  If it is out of upper boundary, still record it.  but make the
         // log entry to mP.size()+1
         size_t ip = 0;
         if (m_filterQuickRef.size() >= 4)
           ip = m_filterQuickRef.back().second;
         m_filterQuickRef.emplace_back(ift, ip);
-        m_filterQuickRef.emplace_back(m_values.size() + 1, ip);
+        m_filterQuickRef.emplace_back(m_values->size() + 1, ip);
       } else {
         // iii. The returned value is in the boundary.
         size_t numintervals = 0;
@@ -2276,7 +2377,7 @@ template <typename TYPE> void TimeSeriesProperty<TYPE>::applyFilter() const {
           numintervals = m_filterQuickRef.back().second;
         }
         if (m_filter[ift].first <
-            m_values[static_cast<std::size_t>(icurlog)].time()) {
+            DateAndTime((*m_times)[static_cast<std::size_t>(icurlog)])) {
           if (icurlog == 0) {
             throw std::logic_error("In this case, icurlog won't be zero! ");
           }
@@ -2291,10 +2392,10 @@ template <typename TYPE> void TimeSeriesProperty<TYPE>::applyFilter() const {
       // b) Filter == False: indicating the end of a quick reference region
       int ilastlog = icurlog;
 
-      if (ilastlog < static_cast<int>(m_values.size())) {
+      if (ilastlog < static_cast<int>(m_values->size())) {
         // B1: Last TRUE entry is still within log
         icurlog = this->upperBound(m_filter[ift].first, icurlog,
-                                   static_cast<int>(m_values.size()) - 1);
+                                   static_cast<int>(m_values->size()) - 1);
 
         if (icurlog < 0) {
           // i.   Some false filter is before the first log entry.  The previous
@@ -2385,6 +2486,7 @@ TimeSeriesProperty<TYPE>::setValueFromProperty(const Property &right) {
   if (!prop) {
     return "Could not set value: properties have different type.";
   }
+  m_times = prop->m_times;
   m_values = prop->m_values;
   m_size = prop->m_size;
   m_propSortedFlag = prop->m_propSortedFlag;
@@ -2398,13 +2500,11 @@ TimeSeriesProperty<TYPE>::setValueFromProperty(const Property &right) {
 /** Saves the time vector has time + start attribute */
 template <typename TYPE>
 void TimeSeriesProperty<TYPE>::saveTimeVector(::NeXus::File *file) {
-  std::vector<DateAndTime> times = this->timesAsVector();
-  const DateAndTime &start = times.front();
-  std::vector<double> timeSec(times.size());
-  for (size_t i = 0; i < times.size(); i++)
-    timeSec[i] = static_cast<double>(times[i].totalNanoseconds() -
-                                     start.totalNanoseconds()) *
-                 1e-9;
+  sortIfNecessary();
+  const DateAndTime start(m_times->front());
+  std::vector<double> timeSec(m_times->size());
+  for (size_t i = 0; i < m_times->size(); i++)
+    timeSec[i] = static_cast<double>((*m_times)[i] - m_times->front()) * 1e-9;
   file->writeData("time", timeSec);
   file->openData("time");
   file->putAttr("start", start.toISO8601String());
@@ -2513,12 +2613,12 @@ void TimeSeriesProperty<TYPE>::histogramData(
 
   double dt = (t1 - t0) / static_cast<double>(nPoints);
 
-  for (auto &ev : m_values) {
-    auto time = static_cast<double>(ev.time().totalNanoseconds());
+  for (size_t i = 0; i < m_times->size(); ++i) {
+    auto time = static_cast<double>((*m_times)[i]);
     if (time < t0 || time >= t1)
       continue;
     auto ind = static_cast<size_t>((time - t0) / dt);
-    counts[ind] += static_cast<double>(ev.value());
+    counts[ind] += static_cast<double>((*m_values)[i]);
   }
 }
 
@@ -2549,53 +2649,26 @@ std::vector<TYPE> TimeSeriesProperty<TYPE>::filteredValuesAsVector() const {
   }
   sortIfNecessary();
 
+  // Both the log and the filter are sorted, so walk along them together. An
+  // entry belongs to the filter region that starts at or before its time;
+  // before the first filter time the region is the inverse of the first one.
   std::vector<TYPE> filteredValues;
-  for (const auto &value : m_values) {
-    if (isTimeFiltered(value.time())) {
-      filteredValues.emplace_back(value.value());
+  auto filterEntry = m_filter.cbegin();
+  bool included = !filterEntry->second;
+  for (size_t i = 0; i < m_times->size(); ++i) {
+    while (filterEntry != m_filter.cend() &&
+           filterEntry->first.totalNanoseconds() <= (*m_times)[i]) {
+      included = filterEntry->second;
+      ++filterEntry;
+    }
+    if (included) {
+      filteredValues.emplace_back((*m_values)[i]);
     }
   }
 
   return filteredValues;
 }
 
-/**
- * Find out if the given time is included in the filtered data
- * i.e. it does not lie in an excluded region. This function assumes
- * the filter is not empty, it has been applied and the values are
- * sorted by time.
- * @param time :: [input] Time to check
- * @returns :: True if time is in an included region, false if the filter
- * excludes it.
- */
-template <typename TYPE>
-bool TimeSeriesProperty<TYPE>::isTimeFiltered(
-    const Types::Core::DateAndTime &time) const {
-  // Each time/value pair in the filter defines a point where the region defined
-  // after that time is either included/excluded depending on the boolean value.
-  // By definition of the filter construction the region before a given filter
-  // time must have the opposite value. For times outside the filter region:
-  //   1. time < first filter time: inverse of the first filter value
-  //   2. time > last filter time: value of the last filter value
-  // If time == a filter time then the value is taken to belong to that filter
-  // region and not the previous
-
-  // Find first fitler time strictly greater than time
-  auto filterEntry = std::lower_bound(
-      m_filter.begin(), m_filter.end(), time,
-      [](const std::pair<Types::Core::DateAndTime, bool> &filterEntry,
-         const Types::Core::DateAndTime &t) { return filterEntry.first <= t; });
-
-  if (filterEntry == m_filter.begin()) {
-    return !filterEntry->second;
-  } else {
-    // iterator points to filter greater than time and but we want the previous
-    // region
-    --filterEntry;
-    return filterEntry->second;
-  }
-}
-
 /**
  * Get a list of the splitting intervals, if filtering is enabled.
  * Otherwise the interval is just first time - last time.
@@ -15,6 +15,7 @@
 
 #include <mutex>
 #include <sstream>
+#include <thread>
 
 using namespace Mantid;
 using namespace Mantid::Kernel;
@@ -526,6 +527,87 @@ public:
                                         "^~");
     TS_ASSERT(!FakeDataService::showingHiddenObjects());
   }
+
+  void test_notification_batches_nest() {
+    Poco::NObserver<DataServiceTest, FakeDataService::BatchEndNotification>
+        observer(*this, &DataServiceTest::handleBatchEndNotification);
+    svc.notificationCenter.addObserver(observer);
+    TS_ASSERT(!svc.isBatching());
+    {
+      FakeDataService::NotificationBatch outer(svc);
+      {
+        FakeDataService::NotificationBatch inner(svc);
+        TS_ASSERT(svc.isBatching());
+      }
+      // The end of every batch is notified
+      TS_ASSERT(svc.isBatching());
+      TS_ASSERT_EQUALS(notificationFlag, 1);
+    }
+    TS_ASSERT(!svc.isBatching());
+    TS_ASSERT_EQUALS(notificationFlag, 2);
+    svc.notificationCenter.removeObserver(observer);
+  }
+
+  void test_notification_batches_belong_to_one_thread() {
+    FakeDataService::NotificationBatch batch(svc);
+    TS_ASSERT(svc.isBatching());
+    bool otherThreadBatching = true;
+    std::thread other([this, &otherThreadBatching]() {
+      otherThreadBatching = svc.isBatching();
+    });
+    other.join();
+    TS_ASSERT(!otherThreadBatching);
+  }
+
+  // Handler for an observer, called each time a batch of changes ends
+  void handleBatchEndNotification(
+      const Poco::AutoPtr<FakeDataService::BatchEndNotification> &) {
+    ++notificationFlag;
+  }
+};
+
+class DataServiceTestPerformance : public CxxTest::TestSuite {
+public:
+  static DataServiceTestPerformance *createSuite() {
+    return new DataServiceTestPerformance();
+  }
+  static void destroySuite(DataServiceTestPerformance *suite) {
+    delete suite;
+  }
+
+  DataServiceTestPerformance() {
+    for (int i = 0; i < NUMBER_OF_OBJECTS; ++i) {
+      m_names.emplace_back("object" + std::to_string(i));
+      m_svc.add(m_names.back(), boost::make_shared<int>(i));
+    }
+  }
+
+  void test_retrieve_from_many_threads() {
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int i = 0; i < NUMBER_OF_OPERATIONS; ++i) {
+      const auto &name = m_names[i % NUMBER_OF_OBJECTS];
+      if (m_svc.doesExist(name))
+        m_svc.retrieve(name);
+    }
+  }
+
+  void test_add_retrieve_and_remove_from_many_threads() {
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int i = 0; i < NUMBER_OF_OPERATIONS; ++i) {
+      const std::string name = "temporary" + std::to_string(i);
+      m_svc.add(name, boost::make_shared<int>(i));
+      // Mostly lookups, as in a workflow, around each add and remove
+      for (int j = 0; j < 8; ++j)
+        m_svc.retrieve(m_names[(i + j) % NUMBER_OF_OBJECTS]);
+      m_svc.remove(name);
+    }
+  }
+
+private:
+  static constexpr int NUMBER_OF_OBJECTS = 1000;
+  static constexpr int NUMBER_OF_OPERATIONS = 1000000;
+  FakeDataService m_svc;
+  std::vector<std::string> m_names;
 };
 
 #endif /* MANTID_KERNEL_DATASERVICETEST_H_ */
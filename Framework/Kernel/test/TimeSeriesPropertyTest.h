@@ -1212,6 +1212,69 @@ public:
     delete p;
   }
 
+  void test_columns_are_sorted_together() {
+    TimeSeriesProperty<int> log("intProp");
+    DateAndTime startTime("2007-11-30T16:17:00");
+    log.addValue(startTime + 20.0, 3);
+    log.addValue(startTime, 1);
+    log.addValue(startTime + 30.0, 4);
+    log.addValue(startTime + 10.0, 2);
+
+    const auto &times = log.timeColumn();
+    const auto &values = log.valueColumn();
+    TS_ASSERT_EQUALS(times.size(), 4);
+    TS_ASSERT_EQUALS(values.size(), 4);
+    for (size_t i = 0; i < times.size(); ++i) {
+      TS_ASSERT_EQUALS(times[i], (startTime + 10.0 * static_cast<double>(i))
+                                     .totalNanoseconds());
+      TS_ASSERT_EQUALS(values[i], static_cast<int>(i) + 1);
+    }
+  }
+
+  void test_copies_share_columns_until_changed() {
+    TimeSeriesProperty<int> log("intProp");
+    DateAndTime startTime("2007-11-30T16:17:00");
+    log.addValue(startTime, 1);
+    log.addValue(startTime + 10.0, 2);
+    std::unique_ptr<TimeSeriesProperty<int>> copy(log.clone());
+    TS_ASSERT_EQUALS(&copy->timeColumn(), &log.timeColumn());
+    TS_ASSERT_EQUALS(&copy->valueColumn(), &log.valueColumn());
+
+    copy->addValue(startTime + 20.0, 3);
+    TS_ASSERT_DIFFERS(&copy->valueColumn(), &log.valueColumn());
+    TS_ASSERT_EQUALS(copy->size(), 3);
+    TS_ASSERT_EQUALS(log.size(), 2);
+    TS_ASSERT_EQUALS(log.lastValue(), 2);
+
+    // Sorting an unsorted copy leaves the original as it was
+    copy->addValue(startTime - 10.0, 0);
+    std::unique_ptr<TimeSeriesProperty<int>> unsorted(copy->clone());
+    TS_ASSERT_EQUALS(copy->firstValue(), 0);
+    TS_ASSERT_EQUALS(unsorted->valueColumn().size(), 4);
+    TS_ASSERT_EQUALS(unsorted->firstValue(), 0);
+    TS_ASSERT_EQUALS(log.firstValue(), 1);
+  }
+
+  void test_getSingleValue_on_irregular_log() {
+    // Bursts of closely spaced entries with long gaps in between, so that
+    // the interpolated starting guess of the search is far off
+    TimeSeriesProperty<int> log("intProp");
+    DateAndTime startTime("2007-11-30T16:17:00");
+    std::vector<DateAndTime> times;
+    for (int burst = 0; burst < 20; ++burst) {
+      const double burstStart = 1000. * burst * burst;
+      for (int i = 0; i < 50; ++i) {
+        times.push_back(startTime + (burstStart + 0.01 * i));
+        log.addValue(times.back(), static_cast<int>(times.size()) - 1);
+      }
+    }
+    for (size_t i = 1; i < times.size(); ++i) {
+      TS_ASSERT_EQUALS(log.getSingleValue(times[i]), static_cast<int>(i));
+      TS_ASSERT_EQUALS(log.getSingleValue(times[i] - 0.001),
+                       static_cast<int>(i) - 1);
+    }
+  }
+
   void test_getSingleValue_emptyPropertyThrows() {
     const TimeSeriesProperty<int> empty("Empty");
 
@@ -2502,4 +2565,72 @@ private:
   TimeSeriesProperty<std::string> *sProp;
 };
 
+class TimeSeriesPropertyTestPerformance : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static TimeSeriesPropertyTestPerformance *createSuite() {
+    return new TimeSeriesPropertyTestPerformance();
+  }
+  static void destroySuite(TimeSeriesPropertyTestPerformance *suite) {
+    delete suite;
+  }
+
+  TimeSeriesPropertyTestPerformance() : m_log("DoubleLog") {
+    // A temperature-like log recorded at 1 kHz
+    const DateAndTime startTime("2007-11-30T16:17:00");
+    std::vector<DateAndTime> times;
+    std::vector<double> values;
+    times.reserve(NUMBER_OF_ENTRIES);
+    values.reserve(NUMBER_OF_ENTRIES);
+    for (size_t i = 0; i < NUMBER_OF_ENTRIES; ++i) {
+      times.emplace_back(startTime.totalNanoseconds() +
+                         static_cast<int64_t>(i) * 1000000);
+      values.push_back(300. + std::sin(static_cast<double>(i) * 1e-4));
+    }
+    m_log.create(times, values);
+    m_splitter.reserve(NUMBER_OF_INTERVALS);
+    const double interval = 1e-3 * NUMBER_OF_ENTRIES / NUMBER_OF_INTERVALS;
+    for (size_t i = 0; i < NUMBER_OF_INTERVALS; i += 2) {
+      m_splitter.emplace_back(startTime + static_cast<double>(i) * interval,
+                              startTime + static_cast<double>(i + 1) * interval,
+                              0);
+    }
+  }
+
+  void test_timeAverageValue() {
+    TS_ASSERT_DELTA(m_log.timeAverageValue(), 300., 1.);
+  }
+
+  void test_averageAndStdDevInFilter() {
+    const auto result = m_log.averageAndStdDevInFilter(m_splitter);
+    TS_ASSERT_DELTA(result.first, 300., 1.);
+  }
+
+  void test_makeFilterByValue() {
+    std::vector<SplittingInterval> split;
+    m_log.makeFilterByValue(split, 299.5, 300.5);
+    TS_ASSERT(!split.empty());
+  }
+
+  void test_splitByTime() {
+    TimeSeriesProperty<double> output("DoubleLog");
+    auto splitter = m_splitter;
+    m_log.splitByTime(splitter, {&output}, false);
+    TS_ASSERT(output.size() > 0);
+  }
+
+  void test_filterByTime() {
+    auto log = std::unique_ptr<TimeSeriesProperty<double>>(m_log.clone());
+    log->filterByTime(m_splitter.front().start(), m_splitter.back().stop());
+    TS_ASSERT(log->realSize() > 0);
+  }
+
+private:
+  static constexpr size_t NUMBER_OF_ENTRIES = 10000000;
+  static constexpr size_t NUMBER_OF_INTERVALS = 1000;
+  TimeSeriesProperty<double> m_log;
+  std::vector<SplittingInterval> m_splitter;
+};
+
 #endif /*TIMESERIESPROPERTYTEST_H_*/
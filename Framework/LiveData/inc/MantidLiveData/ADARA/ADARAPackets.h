@@ -11,6 +11,7 @@
 #include <cstring>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #include "ADARA.h"
 #include "MantidKernel/System.h"
@@ -236,6 +237,20 @@ public:
   uint32_t getSourceTOFOffset() const { return m_TOFOffset; }
   uint32_t curBankId() const { return m_bankId; }
 
+  // The events of one bank, together with the flags of its source section
+  struct Bank {
+    uint32_t bankId;
+    uint32_t eventCount;
+    const Event *events;
+    bool isCorrected;
+    uint32_t tofOffset;
+  };
+
+  // All the banks that contain events, in the order firstEvent() and
+  // nextEvent() visit them.  The events of each bank are contiguous, so the
+  // banks can be processed independently of each other.
+  std::vector<Bank> banks() const;
+
   //        uint32_t curEventCount() const { return ((uint32_t *)m_curBank)[1];
   //        }
 
@@ -13,6 +13,8 @@
 #include "MantidLiveData/Kafka/IKafkaStreamDecoder.h"
 #include "MantidLiveData/Kafka/IKafkaStreamSubscriber.h"
 
+#include <atomic>
+#include <future>
 #include <vector>
 
 namespace Mantid {
@@ -23,6 +25,12 @@ namespace LiveData {
 
   A call to capture() starts the process of capturing the stream on a separate
   thread.
+
+  Event messages are queued on the capture thread without copying and decoded
+  in batches on a second thread while the next batch is consumed. Each batch
+  is decoded in parallel, with the events written directly into buffers that
+  are partitioned by workspace index, so the partitions can be inserted into
+  the EventWorkspace(s) in parallel without sorting.
 */
 class DLLExport KafkaEventStreamDecoder : public IKafkaStreamDecoder {
 public:
@@ -59,8 +67,12 @@ public:
 private:
   void captureImplExcept() override;
 
-  void eventDataFromMessage(const std::string &buffer, size_t &eventCount,
-                            uint64_t &pulseTimeRet);
+  void queueEventMessage(std::string &buffer);
+  void decodeQueuedEventMessages();
+  void waitForDecodedEventMessages();
+  void decodeAllQueuedEventMessages();
+  void eventDataFromMessages(const std::vector<std::string> &buffers);
+  size_t partitionOf(size_t wsIdx) const;
 
   void flushIntermediateBuffer();
 
@@ -76,10 +88,21 @@ private:
   /// Local event workspace buffers
   std::vector<DataObjects::EventWorkspace_sptr> m_localEvents;
 
+  /// Event messages that have been consumed but not decoded yet
+  std::vector<std::string> m_queuedEventMessages;
+  /// The number of queued event messages that are decoded as one batch
+  const std::size_t m_decodeBatchSize;
+  /// Completion of the batch of event messages currently being decoded
+  std::future<void> m_decodedEventMessages;
+
   /// Intermediate buffer for received events yet to be populated in
-  /// m_localEvents
-  std::vector<BufferedEvent> m_receivedEventBuffer;
+  /// m_localEvents, one buffer per range of workspace indices
+  std::vector<std::vector<BufferedEvent>> m_receivedEventBuffer;
   std::vector<BufferedPulse> m_receivedPulseBuffer;
+  /// Total number of events in the intermediate buffer
+  std::atomic<std::size_t> m_receivedEventCount;
+  /// Number of workspace indices covered by each intermediate event buffer
+  std::size_t m_partitionWidth;
   /// Mutex protecting intermediate buffers
   mutable std::mutex m_intermediateBufferMutex;
   /// The number of events above which the intermediate buffer will be flushed
@@ -18,12 +18,24 @@
 #include <Poco/Runnable.h>
 #include <Poco/Timer.h>
 
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <thread>
+
 namespace Mantid {
 namespace LiveData {
 
 /** An implementation of ILiveListener for use at SNS.  Connects to the Stream
    Management
     Service and receives events from it.
+
+    Reading from the network, parsing and adding events to the workspace form
+    a pipeline: a reader thread receives data from the socket while the
+    background thread parses what was received before.  Banked event packets
+    are staged as they are parsed and decoded in parallel once per read, see
+    flushStagedEvents().
  */
 class SNSLiveEventDataListener : public API::LiveListener,
                                  public Poco::Runnable,
@@ -55,7 +67,7 @@ public:
                        // call POCO::Thread::start()
 protected:
   using ADARA::Parser::rxPacket;
-  // virtual bool rxPacket( const ADARA::Packet &pkt);
+  bool rxPacket(const ADARA::Packet &pkt) override;
   // virtual bool rxPacket( const ADARA::RawDataPkt &pkt);
   bool rxPacket(const ADARA::BankedEventPkt &pkt) override;
   bool rxPacket(const ADARA::BeamMonitorPkt &pkt) override;
@@ -101,15 +113,16 @@ private:
   // Returns true if we've got a value for every log listed in m_requiredLogs
   bool haveRequiredLogs();
 
-  void appendEvent(const uint32_t pixelId, const double tof,
-                   const Mantid::Types::Core::DateAndTime pulseTime);
-  // tof is "Time Of Flight" and is in units of microsecondss relative to the
-  // start of the pulse
-  // (There's some documentation that says nanoseconds, but Russell Taylor
-  // assures me it's really is microseconds!)
-  // pulseTime is the start of the pulse relative to Jan 1, 1990.
-  // Both values are designed to be passed straight into the TofEvent
-  // constructor.
+  // Decodes the staged banked event packets and adds their events to the
+  // workspace.  Called once per read and before any packet that may change
+  // the workspace or the run status is processed.
+  void flushStagedEvents();
+
+  // The body of the network reader thread, and its counterparts in the
+  // background thread
+  void readNetwork();
+  void fillParserBuffer();
+  void stopNetworkReader();
 
   ILiveListener::RunStatus m_status{RunStatus::NoRun};
   int m_runNumber{0};
@@ -118,9 +131,15 @@ private:
 
   bool m_workspaceInitialized{false};
   std::string m_wsName;
-  detid2index_map m_indexMap;        // maps pixel id's to workspace indexes
+  // maps pixel id's (plus m_pixelIdOffset) to workspace indexes
+  std::vector<size_t> m_pixelIdToIndex;
+  detid_t m_pixelIdOffset{0};
   detid2index_map m_monitorIndexMap; // Same as above for the monitor workspace
 
+  // Banked event packets that have been parsed but whose events have not been
+  // added to m_eventBuffer yet.  Only used by the background thread.
+  std::vector<std::unique_ptr<ADARA::BankedEventPkt>> m_stagedPackets;
+
   // We need these 2 strings to initialize m_buffer
   std::string m_instrumentName;
   std::string m_instrumentXML;
@@ -138,6 +157,16 @@ private:
 
   Poco::Thread m_thread;
   std::mutex m_mutex; // protects m_buffer & m_status
+
+  // The network reader thread and the blocks of data it has received, which
+  // the background thread copies into the parser's buffer
+  std::thread m_readerThread;
+  std::mutex m_readMutex; // protects everything down to m_readerException
+  std::condition_variable m_readCondition;
+  std::deque<std::vector<uint8_t>> m_readBlocks;
+  size_t m_readBlockOffset{0}; // bytes of the front block already copied
+  bool m_stopReader{false};
+  std::exception_ptr m_readerException;
   bool m_pauseNetRead{false};
   bool m_stopThread{false}; // background thread checks this periodically.
                             // If true, the thread exits
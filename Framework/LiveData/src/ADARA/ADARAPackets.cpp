@@ -215,6 +215,24 @@ const Event *BankedEventPkt::nextEvent() const {
   return m_curEvent;
 }
 
+// Walks the packet with firstEvent() & nextEvent(), but jumps straight to
+// the last event of each bank so only the bank headers are visited.
+std::vector<BankedEventPkt::Bank> BankedEventPkt::banks() const {
+  std::vector<Bank> banks;
+  const Event *event = firstEvent();
+  while (event != nullptr) {
+    if (m_bankStartIndex + 2 * m_eventCount + 1 > m_lastFieldIndex)
+      throw invalid_packet("BankedEvent packet has oversize bank");
+
+    banks.push_back({m_bankId, m_eventCount, event, m_isCorrected, m_TOFOffset});
+
+    m_curFieldIndex = m_bankStartIndex + 2 * m_eventCount;
+    event = nextEvent();
+  }
+
+  return banks;
+}
+
 // Helper functions for firstEvent() & nextEvent()
 
 // Assumes m_curFieldIndex points to the start of a source section.
@@ -30,7 +30,6 @@ GNU_DIAG_ON("conversion")
 #include <chrono>
 #include <json/json.h>
 #include <numeric>
-#include <tbb/parallel_sort.h>
 
 using namespace Mantid::Types;
 using namespace LogSchema;
@@ -76,27 +75,6 @@ void appendToLog(Mantid::API::Run &mutableRunInfo, const std::string &name,
     mutableRunInfo.addLogData(property);
   }
 }
-
-void sortIntermediateEventBuffer(
-    std::vector<Mantid::LiveData::KafkaEventStreamDecoder::BufferedEvent>
-        &eventBuffer,
-    const std::vector<Mantid::LiveData::KafkaEventStreamDecoder::BufferedPulse>
-        &pulseBuffer) {
-  tbb::parallel_sort(
-      eventBuffer.begin(), eventBuffer.end(),
-      [&](const Mantid::LiveData::KafkaEventStreamDecoder::BufferedEvent &lhs,
-          const Mantid::LiveData::KafkaEventStreamDecoder::BufferedEvent &rhs)
-          -> bool {
-        const auto &lhsPulse = pulseBuffer[lhs.pulseIndex];
-        const auto &rhsPulse = pulseBuffer[rhs.pulseIndex];
-
-        /* If events are from different periods compare the period
-         * numbers, otherwise compare the workspace index */
-        return (lhsPulse.periodNumber != rhsPulse.periodNumber)
-                   ? lhsPulse.periodNumber < rhsPulse.periodNumber
-                   : lhs.wsIdx < rhs.wsIdx;
-      });
-}
 } // namespace
 
 namespace Mantid {
@@ -121,6 +99,9 @@ KafkaEventStreamDecoder::KafkaEventStreamDecoder(
     const std::size_t bufferThreshold)
     : IKafkaStreamDecoder(broker, eventTopic, runInfoTopic, spDetTopic,
                           sampleEnvTopic, chopperTopic),
+      m_decodeBatchSize(2 * static_cast<size_t>(PARALLEL_GET_MAX_THREADS)),
+      m_receivedEventBuffer(static_cast<size_t>(PARALLEL_GET_MAX_THREADS)),
+      m_receivedEventCount(0), m_partitionWidth(1),
       m_intermediateBufferFlushThreshold(bufferThreshold) {
 #ifndef _OPENMP
   g_log.warning() << "Multithreading is not available on your system. This "
@@ -132,7 +113,13 @@ KafkaEventStreamDecoder::KafkaEventStreamDecoder(
  * Destructor.
  * Stops capturing from the stream
  */
-KafkaEventStreamDecoder::~KafkaEventStreamDecoder() {}
+KafkaEventStreamDecoder::~KafkaEventStreamDecoder() {
+  stopCapture();
+  // A batch may still be decoding if capture stopped with an error
+  if (m_decodedEventMessages.valid()) {
+    m_decodedEventMessages.wait();
+  }
+}
 
 /**
  * Check if there is data available to extract
@@ -212,6 +199,13 @@ void KafkaEventStreamDecoder::captureImplExcept() {
   auto runStartStruct = getRunStartMessage(runBuffer);
   initLocalCaches(buffer, runStartStruct);
 
+  // Discard messages left over from a capture that stopped with an error
+  if (m_decodedEventMessages.valid()) {
+    m_decodedEventMessages.wait();
+    m_decodedEventMessages = std::future<void>();
+  }
+  m_queuedEventMessages.clear();
+
   m_interrupt = false; // Allow MonitorLiveData or user to interrupt
   m_endRun = false; // Indicates to MonitorLiveData that end of run is reached
   m_runStatusSeen = false; // Flag to ensure MonitorLiveData observes end of run
@@ -239,6 +233,7 @@ void KafkaEventStreamDecoder::captureImplExcept() {
     if (m_endRun) {
       /* Ensure the intermediate buffer is flushed so as to prevent
        * EventWorksapces containing events from other runs. */
+      decodeAllQueuedEventMessages();
       flushIntermediateBuffer();
 
       waitForRunEndObservation();
@@ -251,6 +246,12 @@ void KafkaEventStreamDecoder::captureImplExcept() {
     m_dataStream->consumeMessage(&buffer, offset, partition, topicName);
     // No events, wait for some to come along...
     if (buffer.empty()) {
+      /* Use the wait to decode what is already queued */
+      decodeAllQueuedEventMessages();
+      if (m_receivedEventCount > m_intermediateBufferFlushThreshold) {
+        flushIntermediateBuffer();
+      }
+
       start = std::chrono::system_clock::now();
       globstart = std::chrono::system_clock::now();
       g_log.notice() << "Waiting to start..." << std::endl;
@@ -272,9 +273,14 @@ void KafkaEventStreamDecoder::captureImplExcept() {
                        static_cast<double>(pulseTimeCount);
       g_log.debug() << mpp << " event messages per pulse\n";
       g_log.debug() << "Achievable pulse rate is " << rate / mpp << "Hz\n";
+      double averageEventFromMessageDuration;
+      {
+        std::lock_guard<std::mutex> bufferLock(m_intermediateBufferMutex);
+        averageEventFromMessageDuration =
+            totalEventFromMessageDuration / numEventFromMessageCalls;
+      }
       g_log.debug() << "Average time taken to convert event messages "
-                    << totalEventFromMessageDuration / numEventFromMessageCalls
-                    << " seconds\n";
+                    << averageEventFromMessageDuration << " seconds\n";
       g_log.debug() << "Average time taken to populate workspace "
                     << totalPopulateWorkspaceDuration /
                            numPopulateWorkspaceCalls
@@ -298,8 +304,13 @@ void KafkaEventStreamDecoder::captureImplExcept() {
     if (flatbuffers::BufferHasIdentifier(
             reinterpret_cast<const uint8_t *>(buffer.c_str()),
             EVENT_MESSAGE_ID.c_str())) {
-      uint64_t currentPulseTime(-1);
-      eventDataFromMessage(buffer, nEvents, currentPulseTime);
+      const auto eventMsg =
+          GetEventMessage(reinterpret_cast<const uint8_t *>(buffer.c_str()));
+      const auto currentPulseTime =
+          static_cast<uint64_t>(eventMsg->pulse_time());
+      nEvents += eventMsg->time_of_flight()->size();
+
+      queueEventMessage(buffer);
 
       if (lastPulseTime == 0)
         lastPulseTime = currentPulseTime;
@@ -317,7 +328,7 @@ void KafkaEventStreamDecoder::captureImplExcept() {
 
       /* If there are enough events in the receive buffer then empty it into
        * the EventWorkspace(s) */
-      if (m_receivedEventBuffer.size() > m_intermediateBufferFlushThreshold) {
+      if (m_receivedEventCount > m_intermediateBufferFlushThreshold) {
         flushIntermediateBuffer();
       }
 
@@ -338,6 +349,7 @@ void KafkaEventStreamDecoder::captureImplExcept() {
   }
 
   /* Flush any remaining events when capture is terminated */
+  decodeAllQueuedEventMessages();
   flushIntermediateBuffer();
 
   const auto globend = std::chrono::system_clock::now();
@@ -356,90 +368,175 @@ void KafkaEventStreamDecoder::captureImplExcept() {
   numEventFromMessageCalls = 0;
 }
 
-void KafkaEventStreamDecoder::eventDataFromMessage(const std::string &buffer,
-                                                   size_t &eventCount,
-                                                   uint64_t &pulseTimeRet) {
-  /* Parse message */
-  const auto eventMsg =
-      GetEventMessage(reinterpret_cast<const uint8_t *>(buffer.c_str()));
-
-  /* Parse pulse time */
-  pulseTimeRet = static_cast<uint64_t>(eventMsg->pulse_time());
-  const DateAndTime pulseTime(pulseTimeRet);
+/**
+ * Queue an event message for decoding. The message is moved out of the
+ * buffer, which is left empty.
+ * @param buffer : Raw event message
+ */
+void KafkaEventStreamDecoder::queueEventMessage(std::string &buffer) {
+  m_queuedEventMessages.emplace_back();
+  m_queuedEventMessages.back().swap(buffer);
 
-  /* Get TOF and detector ID buffers */
-  const auto &tofData = *(eventMsg->time_of_flight());
-  const auto &detData = *(eventMsg->detector_id());
+  if (m_queuedEventMessages.size() >= m_decodeBatchSize) {
+    decodeQueuedEventMessages();
+  }
+}
 
-  /* Increment event count */
-  const auto nEvents = tofData.size();
-  eventCount += nEvents;
+/**
+ * Start decoding the queued event messages on a separate thread. The previous
+ * batch is finished first, so that the pulses stay in message order.
+ */
+void KafkaEventStreamDecoder::decodeQueuedEventMessages() {
+  waitForDecodedEventMessages();
+  if (m_queuedEventMessages.empty()) {
+    return;
+  }
 
-  /* Create buffered pulse */
-  BufferedPulse pulse{pulseTime, 0};
+  std::vector<std::string> buffers;
+  buffers.swap(m_queuedEventMessages);
+  m_decodedEventMessages =
+      std::async(std::launch::async, [this, buffers = std::move(buffers)]() {
+        eventDataFromMessages(buffers);
+      });
+}
 
-  /* Perform facility specific operations */
-  if (eventMsg->facility_specific_data_type() == FacilityData_ISISData) {
-    std::lock_guard<std::mutex> workspaceLock(m_mutex);
-    const auto ISISMsg =
-        static_cast<const ISISData *>(eventMsg->facility_specific_data());
-    pulse.periodNumber = static_cast<int>(ISISMsg->period_number());
-    auto periodWs = m_localEvents[pulse.periodNumber];
-    auto &mutableRunInfo = periodWs->mutableRun();
-    mutableRunInfo.getTimeSeriesProperty<double>(PROTON_CHARGE_PROPERTY)
-        ->addValue(pulseTime, ISISMsg->proton_charge());
+/**
+ * Wait for the batch that is being decoded, rethrowing any error raised while
+ * decoding it.
+ */
+void KafkaEventStreamDecoder::waitForDecodedEventMessages() {
+  if (m_decodedEventMessages.valid()) {
+    m_decodedEventMessages.get();
   }
+}
+
+/// Decode all queued event messages and wait until they are buffered.
+void KafkaEventStreamDecoder::decodeAllQueuedEventMessages() {
+  decodeQueuedEventMessages();
+  waitForDecodedEventMessages();
+}
+
+/// Returns the intermediate event buffer for the given workspace index.
+size_t KafkaEventStreamDecoder::partitionOf(size_t wsIdx) const {
+  return std::min(wsIdx / m_partitionWidth, m_receivedEventBuffer.size() - 1);
+}
 
+/**
+ * Decode a batch of event messages into the intermediate buffers
+ *
+ * The pulses are stored in message order. The events of all messages are then
+ * counted and written in parallel straight into the partition of the
+ * intermediate buffer that holds their workspace index, at positions that
+ * preserve the message order.
+ *
+ * @param buffers : Raw event messages
+ */
+void KafkaEventStreamDecoder::eventDataFromMessages(
+    const std::vector<std::string> &buffers) {
   const auto starttime = std::chrono::system_clock::now();
 
-  {
-    std::lock_guard<std::mutex> bufferLock(m_intermediateBufferMutex);
+  const auto nMessages = buffers.size();
+  const auto nPartitions = m_receivedEventBuffer.size();
+
+  /* Parse messages */
+  std::vector<const EventMessage *> eventMsgs;
+  eventMsgs.reserve(nMessages);
+  for (const auto &buffer : buffers) {
+    eventMsgs.push_back(
+        GetEventMessage(reinterpret_cast<const uint8_t *>(buffer.c_str())));
+  }
+
+  std::lock_guard<std::mutex> bufferLock(m_intermediateBufferMutex);
+
+  /* Store the buffered pulses */
+  const auto firstPulseIndex = m_receivedPulseBuffer.size();
+  for (const auto eventMsg : eventMsgs) {
+    const DateAndTime pulseTime(static_cast<uint64_t>(eventMsg->pulse_time()));
+    BufferedPulse pulse{pulseTime, 0};
+
+    /* Perform facility specific operations */
+    if (eventMsg->facility_specific_data_type() == FacilityData_ISISData) {
+      std::lock_guard<std::mutex> workspaceLock(m_mutex);
+      const auto ISISMsg =
+          static_cast<const ISISData *>(eventMsg->facility_specific_data());
+      pulse.periodNumber = static_cast<int>(ISISMsg->period_number());
+      auto periodWs = m_localEvents[pulse.periodNumber];
+      auto &mutableRunInfo = periodWs->mutableRun();
+      mutableRunInfo.getTimeSeriesProperty<double>(PROTON_CHARGE_PROPERTY)
+          ->addValue(pulseTime, ISISMsg->proton_charge());
+    }
 
-    /* Store the buffered pulse */
     m_receivedPulseBuffer.push_back(pulse);
-    const auto pulseIndex = m_receivedPulseBuffer.size() - 1;
-
-    /* Ensure storage for newly received events */
-    const auto oldBufferSize(m_receivedEventBuffer.size());
-    m_receivedEventBuffer.reserve(oldBufferSize + nEvents);
-
-    /* Store the buffered events */
-    std::transform(detData.begin(), detData.end(), tofData.begin(),
-                   std::back_inserter(m_receivedEventBuffer),
-                   [&](uint64_t detId, uint64_t tof) -> BufferedEvent {
-                     const auto workspaceIndex =
-                         m_specToIdx[detId + m_specToIdxOffset];
-                     return {workspaceIndex, tof, pulseIndex};
-                   });
   }
 
+  /* Count the events of each message in each partition */
+  std::vector<std::vector<size_t>> positions(
+      nMessages, std::vector<size_t>(nPartitions, 0));
+
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int64_t i = 0; i < static_cast<int64_t>(nMessages); ++i) {
+    auto &counts = positions[i];
+    for (const uint64_t detId : *(eventMsgs[i]->detector_id())) {
+      ++counts[partitionOf(m_specToIdx[detId + m_specToIdxOffset])];
+    }
+  }
+
+  /* Turn the counts into the position of each message's first event in each
+   * partition and ensure storage for the newly received events */
+  size_t nEvents = 0;
+  for (size_t partition = 0; partition < nPartitions; ++partition) {
+    auto &eventBuffer = m_receivedEventBuffer[partition];
+    auto position = eventBuffer.size();
+    for (size_t i = 0; i < nMessages; ++i) {
+      const auto count = positions[i][partition];
+      positions[i][partition] = position;
+      position += count;
+    }
+    nEvents += position - eventBuffer.size();
+    eventBuffer.resize(position);
+  }
+
+  /* Store the buffered events */
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int64_t i = 0; i < static_cast<int64_t>(nMessages); ++i) {
+    const auto &tofData = *(eventMsgs[i]->time_of_flight());
+    const auto &detData = *(eventMsgs[i]->detector_id());
+    const auto pulseIndex = firstPulseIndex + static_cast<size_t>(i);
+    auto &position = positions[i];
+
+    for (flatbuffers::uoffset_t j = 0; j < detData.size(); ++j) {
+      const uint64_t detId = detData[j];
+      const auto workspaceIndex = m_specToIdx[detId + m_specToIdxOffset];
+      const auto partition = partitionOf(workspaceIndex);
+      m_receivedEventBuffer[partition][position[partition]++] = {
+          workspaceIndex, tofData[j], pulseIndex};
+    }
+  }
+
+  m_receivedEventCount += nEvents;
+
   const auto endTime = std::chrono::system_clock::now();
   const std::chrono::duration<double> dur = endTime - starttime;
   totalEventFromMessageDuration += dur.count();
-  numEventFromMessageCalls += 1;
+  numEventFromMessageCalls += static_cast<double>(nMessages);
 }
 
 void KafkaEventStreamDecoder::flushIntermediateBuffer() {
   /* Do nothing if there are no buffered events */
-  if (m_receivedEventBuffer.empty()) {
+  if (m_receivedEventCount == 0) {
     return;
   }
 
-  g_log.debug() << "Populating event workspace with "
-                << m_receivedEventBuffer.size() << " events\n";
+  g_log.debug() << "Populating event workspace with " << m_receivedEventCount
+                << " events\n";
 
   const auto startTime = std::chrono::system_clock::now();
 
   std::lock_guard<std::mutex> bufferLock(m_intermediateBufferMutex);
 
-  sortIntermediateEventBuffer(m_receivedEventBuffer, m_receivedPulseBuffer);
-
-  /* Compute groups for parallel insertion */
-  const auto numberOfGroups = PARALLEL_GET_MAX_THREADS;
-  const auto groupBoundaries =
-      computeGroupBoundaries(m_receivedEventBuffer, numberOfGroups);
-
-  /* Insert events into EventWorkspace(s) */
+  /* Insert events into EventWorkspace(s). Each partition holds a distinct
+   * range of workspace indices so the partitions can be inserted in
+   * parallel. */
   {
     std::lock_guard<std::mutex> workspaceLock(m_mutex);
 
@@ -447,11 +544,11 @@ void KafkaEventStreamDecoder::flushIntermediateBuffer() {
       ws->invalidateCommonBinsFlag();
     }
 
+    const auto numberOfPartitions =
+        static_cast<int64_t>(m_receivedEventBuffer.size());
     PARALLEL_FOR_NO_WSP_CHECK()
-    for (auto group = 0; group < numberOfGroups; ++group) {
-      for (auto idx = groupBoundaries[group]; idx < groupBoundaries[group + 1];
-           ++idx) {
-        const auto &event = m_receivedEventBuffer[idx];
+    for (int64_t partition = 0; partition < numberOfPartitions; ++partition) {
+      for (const auto &event : m_receivedEventBuffer[partition]) {
         const auto &pulse = m_receivedPulseBuffer[event.pulseIndex];
 
         auto *spectrum =
@@ -466,7 +563,10 @@ void KafkaEventStreamDecoder::flushIntermediateBuffer() {
 
   /* Clear buffers */
   m_receivedPulseBuffer.clear();
-  m_receivedEventBuffer.clear();
+  for (auto &eventBuffer : m_receivedEventBuffer) {
+    eventBuffer.clear();
+  }
+  m_receivedEventCount = 0;
 
   const auto endTime = std::chrono::system_clock::now();
   const std::chrono::duration<double> dur = endTime - startTime;
@@ -474,7 +574,7 @@ void KafkaEventStreamDecoder::flushIntermediateBuffer() {
 
   totalPopulateWorkspaceDuration += dur.count();
   numPopulateWorkspaceCalls += 1;
-} // namespace LiveData
+}
 
 /**
  * Get sample environment log data from the flatbuffer and append it to the
@@ -604,6 +704,13 @@ void KafkaEventStreamDecoder::initLocalCaches(
   // Cache spec->index mapping. We assume it is the same across all periods
   m_specToIdx =
       eventBuffer->getSpectrumToWorkspaceIndexVector(m_specToIdxOffset);
+  {
+    std::lock_guard<std::mutex> bufferLock(m_intermediateBufferMutex);
+    const auto nPartitions = m_receivedEventBuffer.size();
+    m_partitionWidth = std::max<size_t>(
+        1, (eventBuffer->getNumberHistograms() + nPartitions - 1) /
+               nPartitions);
+  }
 
   // Buffers for each period
   const size_t nperiods = runStartData.nPeriods;
@@ -142,6 +142,18 @@ void LiveDataAlgorithm::initProps() {
                                      FileProperty::OptionalLoad, "py"),
       " Python script that will be run to process the accumulated data.");
 
+  std::vector<std::string> postProcessingOptions{"Full", "Incremental"};
+  declareProperty(
+      "PostProcessingMode", "Full",
+      boost::make_shared<StringListValidator>(postProcessingOptions),
+      "How the post-processing is applied at each update.\n"
+      " - Full: the whole accumulated data is post-processed (default).\n"
+      " - Incremental: only the new chunk is post-processed and the result "
+      "is added to the previous output. Only valid if post-processing the "
+      "sum of two chunks gives the sum of the post-processed chunks, e.g. "
+      "rebinning or unit conversion. Falls back to Full when the chunks are "
+      "not added or the result does not match the previous output.");
+
   std::vector<std::string> runOptions{"Restart", "Stop", "Rename"};
   declareProperty("RunTransitionBehavior", "Restart",
                   boost::make_shared<StringListValidator>(runOptions),
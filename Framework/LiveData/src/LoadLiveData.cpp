@@ -8,6 +8,7 @@
 #include "MantidAPI/AlgorithmManager.h"
 #include "MantidAPI/Workspace.h"
 #include "MantidAPI/WorkspaceGroup.h"
+#include "MantidAPI/WorkspaceOpOverloads.h"
 #include "MantidDataObjects/EventWorkspace.h"
 #include "MantidKernel/CPUTimer.h"
 #include "MantidKernel/ReadLock.h"
@@ -67,6 +68,44 @@ void copyInstrument(const API::Workspace *source, API::Workspace *target) {
     }
   }
 }
+
+/**
+ * Check whether a post-processed chunk can be summed into the previous
+ * post-processed output.
+ *
+ * Groups must match item by item. Event workspaces can always be summed if
+ * they have the same number of spectra, histograms must also share the bins.
+ *
+ * @param outputWS : The previous post-processed output
+ * @param chunkWS : The post-processed chunk
+ * @return true if Plus gives the post-processed sum of the chunks
+ */
+bool canBeAdded(const API::Workspace &outputWS, const API::Workspace &chunkWS) {
+  const auto *outputGroup = dynamic_cast<const WorkspaceGroup *>(&outputWS);
+  const auto *chunkGroup = dynamic_cast<const WorkspaceGroup *>(&chunkWS);
+  if (outputGroup || chunkGroup) {
+    if (!outputGroup || !chunkGroup ||
+        outputGroup->size() != chunkGroup->size())
+      return false;
+    for (size_t index = 0; index < outputGroup->size(); ++index) {
+      if (!canBeAdded(*outputGroup->getItem(index),
+                      *chunkGroup->getItem(index)))
+        return false;
+    }
+    return true;
+  }
+
+  const auto *outputMW = dynamic_cast<const MatrixWorkspace *>(&outputWS);
+  const auto *chunkMW = dynamic_cast<const MatrixWorkspace *>(&chunkWS);
+  if (!outputMW || !chunkMW ||
+      outputMW->getNumberHistograms() != chunkMW->getNumberHistograms())
+    return false;
+  if (dynamic_cast<const EventWorkspace *>(outputMW) &&
+      dynamic_cast<const EventWorkspace *>(chunkMW))
+    return true;
+  return outputMW->blocksize() == chunkMW->blocksize() &&
+         WorkspaceHelpers::matchingBins(*outputMW, *chunkMW);
+}
 } // namespace
 
 // Register the algorithm into the AlgorithmFactory
@@ -94,12 +133,15 @@ void LoadLiveData::init() { this->initProps(); }
  *
  * @param inputWS :: workspace being processed
  * @param PostProcess :: flag, TRUE if doing the post-processing
+ * @param InPlace :: flag, TRUE to process inputWS under an anonymous name
+ *        instead of the AccumulationWorkspace/OutputWorkspace names. Always
+ *        used for chunk processing and for incremental post-processing.
  * @return the processed workspace. Will point to inputWS if no processing is to
  *do
  */
 Mantid::API::Workspace_sptr
 LoadLiveData::runProcessing(Mantid::API::Workspace_sptr inputWS,
-                            bool PostProcess) {
+                            bool PostProcess, bool InPlace) {
   if (!inputWS)
     throw std::runtime_error(
         "LoadLiveData::runProcessing() called for an empty input workspace.");
@@ -123,8 +165,8 @@ LoadLiveData::runProcessing(Mantid::API::Workspace_sptr inputWS,
     // Transform the chunk in-place
     std::string outputName = inputName;
 
-    // Except, no need for anonymous names with the post-processing
-    if (PostProcess) {
+    // Except, no need for anonymous names with the full post-processing
+    if (!InPlace) {
       inputName = this->getPropertyValue("AccumulationWorkspace");
       outputName = this->getPropertyValue("OutputWorkspace");
     }
@@ -175,7 +217,7 @@ LoadLiveData::runProcessing(Mantid::API::Workspace_sptr inputWS,
           " Algorithm's OutputWorkspace property is not a WorkspaceProperty!");
     Workspace_sptr temp = wsProp->getWorkspace();
 
-    if (!PostProcess) {
+    if (InPlace) {
       if (!temp) {
         // a group workspace cannot be returned by wsProp
         temp = AnalysisDataService::Instance().retrieve(inputName);
@@ -204,7 +246,7 @@ LoadLiveData::runProcessing(Mantid::API::Workspace_sptr inputWS,
 Mantid::API::Workspace_sptr
 LoadLiveData::processChunk(Mantid::API::Workspace_sptr chunkWS) {
   try {
-    return runProcessing(chunkWS, false);
+    return runProcessing(chunkWS, false, true);
   } catch (...) {
     g_log.error("While processing chunk:");
     throw;
@@ -218,30 +260,71 @@ LoadLiveData::processChunk(Mantid::API::Workspace_sptr chunkWS) {
  */
 void LoadLiveData::runPostProcessing() {
   try {
-    m_outputWS = runProcessing(m_accumWS, true);
+    m_outputWS = runProcessing(m_accumWS, true, false);
   } catch (...) {
     g_log.error("While post processing:");
     throw;
   }
 }
 
+//----------------------------------------------------------------------------------------------
+/** Perform the PostProcessing steps on the latest chunk only and add the
+ * result to the previous output, so the cost of an update does not grow with
+ * the length of the run.
+ * Falls back to runPostProcessing() if the chunks are not summed or the
+ * post-processed chunk cannot be added to the previous output.
+ * Sets the m_outputWS member to the processed result.
+ *
+ * @param chunkWS :: processed live data chunk workspace
+ * @param accum :: the accumulation method used for this chunk
+ */
+void LoadLiveData::runIncrementalPostProcessing(
+    Mantid::API::Workspace_sptr chunkWS, const std::string &accum) {
+  std::string reason;
+  if (accum != "Add") {
+    reason = "the chunk was accumulated using " + accum;
+  } else if (!m_outputWS) {
+    reason = "there is no previous output";
+  } else {
+    Workspace_sptr processedChunk;
+    try {
+      processedChunk = runProcessing(chunkWS, true, true);
+    } catch (...) {
+      g_log.error("While post processing chunk:");
+      throw;
+    }
+    if (canBeAdded(*m_outputWS, *processedChunk)) {
+      this->addChunk(m_outputWS, processedChunk);
+      return;
+    }
+    reason = "the post-processed chunk does not match the previous output";
+  }
+  g_log.information() << "Post-processing the whole accumulation workspace "
+                         "because "
+                      << reason << ".\n";
+  this->runPostProcessing();
+}
+
 //----------------------------------------------------------------------------------------------
 /** Accumulate the data by adding (summing) to the output workspace.
  * Calls the Plus algorithm
- * Sets m_accumWS.
+ * Sets accumWS.
  *
+ * @param accumWS :: accumulation workspace, m_accumWS or, when
+ *        post-processing incrementally, m_outputWS
  * @param chunkWS :: processed live data chunk workspace
  */
-void LoadLiveData::addChunk(Mantid::API::Workspace_sptr chunkWS) {
+void LoadLiveData::addChunk(API::Workspace_sptr &accumWS,
+                            API::Workspace_sptr chunkWS) {
   // Acquire locks on the workspaces we use
-  WriteLock _lock1(*m_accumWS);
+  WriteLock _lock1(*accumWS);
   ReadLock _lock2(*chunkWS);
 
   // ISIS multi-period data come in workspace groups
   if (WorkspaceGroup_sptr gws =
           boost::dynamic_pointer_cast<WorkspaceGroup>(chunkWS)) {
     WorkspaceGroup_sptr accum_gws =
-        boost::dynamic_pointer_cast<WorkspaceGroup>(m_accumWS);
+        boost::dynamic_pointer_cast<WorkspaceGroup>(accumWS);
     if (!accum_gws) {
       throw std::runtime_error("Two workspace groups are expected.");
     }
@@ -258,10 +341,10 @@ void LoadLiveData::addChunk(Mantid::API::Workspace_sptr chunkWS) {
   } else if (MatrixWorkspace_sptr mws =
                  boost::dynamic_pointer_cast<MatrixWorkspace>(chunkWS)) {
     // If workspace is a Matrix workspace just add the chunk
-    addMatrixWSChunk(m_accumWS, chunkWS);
+    addMatrixWSChunk(accumWS, chunkWS);
   } else {
     // Assume MD Workspace
-    addMDWSChunk(m_accumWS, chunkWS);
+    addMDWSChunk(accumWS, chunkWS);
   }
 }
 
@@ -578,7 +661,7 @@ void LoadLiveData::exec() {
     this->appendChunk(processed);
   } else {
     // Default to Add.
-    this->addChunk(processed);
+    this->addChunk(m_accumWS, processed);
 
     // When adding events, the default bin boundaries may need to be updated.
     // The function itself checks to see if it is appropriate
@@ -591,7 +674,10 @@ void LoadLiveData::exec() {
 
   if (this->hasPostProcessing()) {
     // ----------- Run post-processing -------------
-    this->runPostProcessing();
+    if (this->getPropertyValue("PostProcessingMode") == "Incremental")
+      this->runIncrementalPostProcessing(processed, accum);
+    else
+      this->runPostProcessing();
     // Set both output workspaces
     this->setProperty("AccumulationWorkspace", m_accumWS);
     this->setProperty("OutputWorkspace", m_outputWS);
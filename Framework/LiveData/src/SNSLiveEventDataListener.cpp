@@ -4,8 +4,12 @@
 //     NScD Oak Ridge National Laboratory, European Spallation Source
 //     & Institut Laue - Langevin
 // SPDX - License - Identifier: GPL - 3.0 +
+#include <chrono>
+#include <cstring>
 #include <ctime>
 #include <exception>
+#include <limits>
+#include <numeric>
 #include <sstream> // for ostringstream
 #include <string>
 
@@ -18,6 +22,7 @@
 #include "MantidGeometry/Instrument.h"
 #include "MantidKernel/ConfigService.h"
 #include "MantidKernel/DateAndTime.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/OptionalBool.h"
 #include "MantidKernel/Strings.h"
 #include "MantidKernel/TimeSeriesProperty.h"
@@ -51,6 +56,11 @@ namespace { // anonymous namespace
 // Also used when shutting down the thread so we know how long to wait there
 const int64_t RECV_TIMEOUT = 30;
 
+// Size of the blocks the network reader thread receives, and how many of them
+// it may queue up before it waits for the background thread to catch up.
+const size_t READ_BLOCK_SIZE = 1024 * 1024;
+const size_t MAX_READ_BLOCKS = 64;
+
 // Names for a couple of time series properties
 const std::string PAUSE_PROPERTY("pause");
 const std::string SCAN_PROPERTY("scan_index");
@@ -243,6 +253,8 @@ void SNSLiveEventDataListener::run() {
       g_log.error("SNSLiveEventDataListener::run(): Failed to send client "
                   "hello packet. Thread exiting.");
       m_stopThread = true;
+    } else {
+      m_readerThread = std::thread(&SNSLiveEventDataListener::readNetwork, this);
     }
 
     while (!m_stopThread) // loop until the foreground thread tells us to stop
@@ -260,38 +272,21 @@ void SNSLiveEventDataListener::run() {
         break;
       }
 
-      // Get some more data from our socket and put it in the parser's buffer
-      unsigned int bufFillLen = bufferFillLength();
-      if (bufFillLen) {
-        uint8_t *bufFillAddr = bufferFillAddress();
-        int bytesRead = 0;
-        try {
-          bytesRead = m_socket.receiveBytes(bufFillAddr, bufFillLen);
-        } catch (Poco::TimeoutException &) {
-          // Don't need to stop processing or anything - just log a warning
-          g_log.warning(
-              "Timeout reading from the network.  Is SMS still sending?");
-        } catch (Poco::Net::NetException &e) {
-          std::string msg("Parser::read(): ");
-          msg += e.name();
-          throw std::runtime_error(msg);
-        }
-
-        if (bytesRead > 0) {
-          bufferBytesAppended(bytesRead);
-        }
+      // Get the data the reader thread has received and put it in the
+      // parser's buffer.  (Waits a little if there isn't any, which keeps us
+      // from spinlocking the cpu...)
+      if (bufferFillLength()) {
+        fillParserBuffer();
       }
 
       std::string bufferParseLog;
       // bufferParse() wants a string where it can save log messages.
       // We don't actually use the messages for anything, though.
-      int packetsParsed = bufferParse(bufferParseLog);
+      bufferParse(bufferParseLog);
       bufferParseLog.clear(); // keep the string from growing without bound
-      if (packetsParsed == 0) {
-        // No packets were parsed.  Sleep a little to let some data accumulate
-        // before calling read again.  (Keeps us from spinlocking the cpu...)
-        Poco::Thread::sleep(10); // 10 milliseconds
-      }
+
+      // Add the events from all the packets we just parsed
+      flushStagedEvents();
     }
 
     // If we've gotten here, it's because the thread has thrown an otherwise
@@ -343,6 +338,106 @@ void SNSLiveEventDataListener::run() {
     m_backgroundException = boost::make_shared<std::runtime_error>(
         "Unknown error in backgound thread");
   }
+
+  stopNetworkReader();
+}
+
+/// The main function for the network reader thread
+
+/// Receives data from the socket into blocks that the background thread
+/// picks up in fillParserBuffer().  At most MAX_READ_BLOCKS blocks are
+/// queued, after that the reader waits and the data backs up in the socket
+/// as it used to when the background thread was busy parsing.
+void SNSLiveEventDataListener::readNetwork() {
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(m_readMutex);
+      m_readCondition.wait(lock, [this] {
+        return m_stopReader || m_readBlocks.size() < MAX_READ_BLOCKS;
+      });
+      if (m_stopReader)
+        return;
+    }
+
+    std::vector<uint8_t> block(READ_BLOCK_SIZE);
+    int bytesRead = 0;
+    try {
+      bytesRead = m_socket.receiveBytes(block.data(),
+                                        static_cast<int>(block.size()));
+    } catch (Poco::TimeoutException &) {
+      // Don't need to stop processing or anything - just log a warning
+      g_log.warning("Timeout reading from the network.  Is SMS still sending?");
+    } catch (Poco::Net::NetException &e) {
+      std::string msg("Parser::read(): ");
+      msg += e.name();
+      std::lock_guard<std::mutex> lock(m_readMutex);
+      m_readerException = std::make_exception_ptr(std::runtime_error(msg));
+      m_readCondition.notify_all();
+      return;
+    }
+
+    if (bytesRead > 0) {
+      block.resize(static_cast<size_t>(bytesRead));
+      std::lock_guard<std::mutex> lock(m_readMutex);
+      m_readBlocks.push_back(std::move(block));
+      m_readCondition.notify_all();
+    } else {
+      // Nothing to read (or the connection was closed).  Don't spinlock.
+      Poco::Thread::sleep(10); // 10 milliseconds
+    }
+  }
+}
+
+/// Copies received data into the parser's buffer
+
+/// Waits up to 10 milliseconds for the reader thread if it hasn't received
+/// anything, and re-throws any exception the reader thread ran into.
+void SNSLiveEventDataListener::fillParserBuffer() {
+  std::unique_lock<std::mutex> lock(m_readMutex);
+  m_readCondition.wait_for(lock, std::chrono::milliseconds(10), [this] {
+    return !m_readBlocks.empty() || m_readerException;
+  });
+  if (m_readerException) {
+    std::rethrow_exception(m_readerException);
+  }
+
+  bool blockReleased = false;
+  while (!m_readBlocks.empty() && bufferFillLength()) {
+    const auto &block = m_readBlocks.front();
+    const auto length = std::min(static_cast<size_t>(bufferFillLength()),
+                                 block.size() - m_readBlockOffset);
+    std::memcpy(bufferFillAddress(), block.data() + m_readBlockOffset, length);
+    bufferBytesAppended(static_cast<unsigned int>(length));
+
+    m_readBlockOffset += length;
+    if (m_readBlockOffset == block.size()) {
+      m_readBlocks.pop_front();
+      m_readBlockOffset = 0;
+      blockReleased = true;
+    }
+  }
+  if (blockReleased) {
+    m_readCondition.notify_all();
+  }
+}
+
+/// Stops and joins the network reader thread
+void SNSLiveEventDataListener::stopNetworkReader() {
+  {
+    std::lock_guard<std::mutex> lock(m_readMutex);
+    m_stopReader = true;
+  }
+  m_readCondition.notify_all();
+
+  if (m_readerThread.joinable()) {
+    // Wake the reader up if it's blocked in receiveBytes()
+    try {
+      m_socket.shutdownReceive();
+    } catch (...) {
+      // The socket is already closed, so the reader isn't blocked on it
+    }
+    m_readerThread.join();
+  }
 }
 
 /// Parse a banked event packet
@@ -387,9 +482,6 @@ bool SNSLiveEventDataListener::rxPacket(const ADARA::BankedEventPkt &pkt) {
     }
   }
 
-  // A counter that we use for logging purposes
-  unsigned totalEvents = 0;
-
   // First, check to see if the run has been paused.  We don't process
   // the events if we're paused unless the user has specifically overridden
   // this behavior with the livelistener.keeppausedevents property.
@@ -397,58 +489,163 @@ bool SNSLiveEventDataListener::rxPacket(const ADARA::BankedEventPkt &pkt) {
     return false;
   }
 
-  // Append the events
+  // Keep a copy of the packet.  Its events are decoded together with the
+  // rest of the packets from the same read in flushStagedEvents().
   g_log.debug() << "----- Pulse ID: " << pkt.pulseId() << " -----\n";
-  // Scope braces
-  {
-    std::lock_guard<std::mutex> scopedLock(m_mutex);
+  m_stagedPackets.push_back(std::make_unique<ADARA::BankedEventPkt>(pkt));
+
+  return false;
+}
 
-    // Timestamp for the events
-    Mantid::Types::Core::DateAndTime eventTime = timeFromPacket(pkt);
+/// Dispatch a packet to the rxPacket() function for its type
 
-    // Save the pulse charge in the logs (*10 because we want the units to be
-    // picoCulombs, and ADARA sends them out in units of 10pC)
-    m_eventBuffer->mutableRun()
-        .getTimeSeriesProperty<double>(PROTON_CHARGE_PROPERTY)
-        ->addValue(eventTime, pkt.pulseCharge() * 10);
-
-    // Iterate through each event
-    const ADARA::Event *event = pkt.firstEvent();
-    unsigned lastBankID = pkt.curBankId();
-    // A counter that we use for logging purposes
-    unsigned eventsPerBank = 0;
-    while (event != nullptr) {
-      eventsPerBank++;
-      totalEvents++;
-      if (lastBankID < 0xFFFFFFFE) // Bank ID -1 & -2 are special cases and are
-                                   // not valid pixels
-      {
-        // appendEvent needs tof to be in units of microseconds, but it comes
-        // from the ADARA stream in units of 100ns.
-        if (pkt.getSourceCORFlag()) {
-          appendEvent(event->pixel, event->tof / 10.0, eventTime);
-        } else {
-          appendEvent(event->pixel,
-                      (event->tof + pkt.getSourceTOFOffset()) / 10.0,
-                      eventTime);
-        }
+/// Overrides the default function defined in ADARA::Parser.  Banked event
+/// packets are only staged when they're received, so the staged events are
+/// added to the workspace before a packet of any other type is processed,
+/// as those may change the run status, the logs or the workspace itself.
+/// Beam monitor packets arrive with every pulse and only touch the monitor
+/// workspace, so they don't need to wait for the staged events.
+/// @param pkt The packet to be parsed
+/// @return Returns false if there were no problems.  Returns true if there
+/// was an error and packet parsing should be interrupted
+bool SNSLiveEventDataListener::rxPacket(const ADARA::Packet &pkt) {
+  if (pkt.base_type() != ADARA::PacketType::BANKED_EVENT_TYPE &&
+      pkt.base_type() != ADARA::PacketType::BEAM_MONITOR_EVENT_TYPE) {
+    flushStagedEvents();
+  }
+  return ADARA::Parser::rxPacket(pkt);
+}
+
+/// Add the events of the staged banked event packets to the workspace
+
+/// The banks of all the staged packets are decoded in parallel.  Every event
+/// is written straight into its slot in a buffer partitioned by workspace
+/// index, keeping the order of the packets within each spectrum.  Each
+/// partition is then added to its spectra by a single thread, so no locking
+/// is needed apart from holding the mutex against extractData().
+void SNSLiveEventDataListener::flushStagedEvents() {
+  if (m_stagedPackets.empty()) {
+    return;
+  }
+
+  struct BankEvents {
+    const ADARA::Event *events;
+    uint32_t eventCount;
+    uint32_t tofOffset;
+    DateAndTime pulseTime;
+  };
+  std::vector<BankEvents> banks;
+  for (const auto &pkt : m_stagedPackets) {
+    const DateAndTime pulseTime = timeFromPacket(*pkt);
+    for (const auto &bank : pkt->banks()) {
+      // Bank ID -1 & -2 are special cases and are not valid pixels
+      if (bank.bankId < 0xFFFFFFFE) {
+        banks.push_back({bank.events, bank.eventCount,
+                         bank.isCorrected ? 0 : bank.tofOffset, pulseTime});
       }
+    }
+  }
 
-      event = pkt.nextEvent();
-      if (pkt.curBankId() != lastBankID) {
-        g_log.debug() << "BankID " << lastBankID << " had " << eventsPerBank
-                      << " events\n";
+  const auto invalidIndex = std::numeric_limits<size_t>::max();
+  const auto workspaceIndexOf = [this, invalidIndex](const uint32_t pixelId) {
+    const auto id = static_cast<int64_t>(pixelId) + m_pixelIdOffset;
+    if (id < 0 || id >= static_cast<int64_t>(m_pixelIdToIndex.size()))
+      return invalidIndex;
+    return m_pixelIdToIndex[static_cast<size_t>(id)];
+  };
+
+  // Count the events of each bank in each partition
+  const auto numberOfBanks = static_cast<int64_t>(banks.size());
+  const auto numberOfPartitions =
+      static_cast<size_t>(PARALLEL_GET_MAX_THREADS);
+  std::vector<std::vector<size_t>> positions(
+      banks.size(), std::vector<size_t>(numberOfPartitions, 0));
+  std::vector<size_t> invalidEvents(banks.size(), 0);
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int64_t i = 0; i < numberOfBanks; ++i) {
+    const auto &bank = banks[i];
+    auto &counts = positions[i];
+    for (uint32_t j = 0; j < bank.eventCount; ++j) {
+      const auto workspaceIndex = workspaceIndexOf(bank.events[j].pixel);
+      if (workspaceIndex != invalidIndex) {
+        ++counts[workspaceIndex % numberOfPartitions];
+      } else {
+        ++invalidEvents[i];
+      }
+    }
+  }
+
+  // Turn the counts into the position of each bank's first event in each
+  // partition
+  using IndexedEvent = std::pair<size_t, TofEvent>;
+  std::vector<std::vector<IndexedEvent>> partitions(numberOfPartitions);
+  for (size_t partition = 0; partition < numberOfPartitions; ++partition) {
+    size_t position = 0;
+    for (auto &bankPositions : positions) {
+      const auto count = bankPositions[partition];
+      bankPositions[partition] = position;
+      position += count;
+    }
+    partitions[partition].resize(position);
+  }
 
-        lastBankID = pkt.curBankId();
-        eventsPerBank = 0;
+  // Decode the events.  TofEvent needs tof to be in units of microseconds,
+  // but it comes from the ADARA stream in units of 100ns.
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int64_t i = 0; i < numberOfBanks; ++i) {
+    const auto &bank = banks[i];
+    auto &position = positions[i];
+    for (uint32_t j = 0; j < bank.eventCount; ++j) {
+      const auto &event = bank.events[j];
+      const auto workspaceIndex = workspaceIndexOf(event.pixel);
+      if (workspaceIndex != invalidIndex) {
+        const auto partition = workspaceIndex % numberOfPartitions;
+        partitions[partition][position[partition]++] = {
+            workspaceIndex,
+            TofEvent((event.tof + bank.tofOffset) / 10.0, bank.pulseTime)};
+      }
+    }
+  }
+
+  size_t totalEvents = 0;
+  for (const auto &partition : partitions) {
+    totalEvents += partition.size();
+  }
+  const auto totalInvalid =
+      std::accumulate(invalidEvents.cbegin(), invalidEvents.cend(), size_t(0));
+  if (totalInvalid > 0) {
+    g_log.warning() << "Ignored " << totalInvalid
+                    << " events with invalid pixel IDs\n";
+  }
+
+  // Scope braces
+  {
+    std::lock_guard<std::mutex> scopedLock(m_mutex);
+
+    // Save the pulse charges in the logs (*10 because we want the units to
+    // be picoCulombs, and ADARA sends them out in units of 10pC)
+    auto *protonCharge = m_eventBuffer->mutableRun()
+                             .getTimeSeriesProperty<double>(
+                                 PROTON_CHARGE_PROPERTY);
+    for (const auto &pkt : m_stagedPackets) {
+      protonCharge->addValue(timeFromPacket(*pkt), pkt->pulseCharge() * 10);
+    }
+
+    m_eventBuffer->invalidateCommonBinsFlag();
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int64_t partition = 0;
+         partition < static_cast<int64_t>(numberOfPartitions); ++partition) {
+      for (const auto &event : partitions[partition]) {
+        m_eventBuffer->getSpectrumUnsafe(event.first)
+            ->addEventQuickly(event.second);
       }
     }
   } // mutex automatically unlocks here
 
+  m_stagedPackets.clear();
+
   g_log.debug() << "Total Events: " << totalEvents << "\n";
   g_log.debug("-------------------------------");
-
-  return false;
 }
 
 /// Parse a beam monitor event packet
@@ -1344,8 +1541,8 @@ void SNSLiveEventDataListener::initWorkspacePart2() {
   m_eventBuffer->getAxis(0)->unit() = UnitFactory::Instance().create("TOF");
   m_eventBuffer->setYUnit("Counts");
 
-  m_indexMap = m_eventBuffer->getDetectorIDToWorkspaceIndexMap(
-      true /* bool throwIfMultipleDets */);
+  m_pixelIdToIndex = m_eventBuffer->getDetectorIDToWorkspaceIndexVector(
+      m_pixelIdOffset, true /* bool throwIfMultipleDets */);
 
   // We always want to have at least one value for the the scan index time
   // series.  We may have already gotten a scan start packet by the time we
@@ -1404,26 +1601,6 @@ bool SNSLiveEventDataListener::haveRequiredLogs() {
   return allFound;
 }
 
-/// Adds an event to the workspace
-void SNSLiveEventDataListener::appendEvent(
-    const uint32_t pixelId, const double tof,
-    const Mantid::Types::Core::DateAndTime pulseTime)
-// NOTE: This function does NOT lock the mutex!  Make sure you do that
-// before calling this function!
-{
-  // It'd be nice to use operator[], but we might end up inserting a value....
-  // Have to use find() instead.
-  const auto it = m_indexMap.find(pixelId);
-  if (it != m_indexMap.end()) {
-    const std::size_t workspaceIndex = it->second;
-    Types::Event::TofEvent event(tof, pulseTime);
-    m_eventBuffer->getSpectrum(workspaceIndex).addEventQuickly(event);
-  } else {
-    g_log.warning() << "Invalid pixel ID: " << pixelId << " (TofF: " << tof
-                    << " microseconds)\n";
-  }
-}
-
 /// Retrieve buffered data
 
 /// Called by the foreground thread to fetch data that's accumulated in
@@ -73,6 +73,18 @@ public:
       // Get the next event and verify it's null
       event = pkt->nextEvent();
       TS_ASSERT(!event);
+
+      // The same two banks, one event each
+      const auto banks = pkt->banks();
+      TS_ASSERT_EQUALS(banks.size(), 2);
+      if (banks.size() == 2) {
+        TS_ASSERT_EQUALS(banks[0].bankId, 0x02);
+        TS_ASSERT_EQUALS(banks[0].eventCount, 1);
+        TS_ASSERT_EQUALS(banks[0].events[0].tof, 0x00023BD9);
+        TS_ASSERT_EQUALS(banks[0].events[0].pixel, 0x043C);
+        TS_ASSERT_EQUALS(banks[1].bankId, 0x13);
+        TS_ASSERT_EQUALS(banks[1].eventCount, 1);
+      }
     }
   }
 
@@ -0,0 +1,289 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_LIVEDATA_ADARAREPLAY_H_
+#define MANTID_LIVEDATA_ADARAREPLAY_H_
+
+#include "MantidLiveData/ADARA/ADARA.h"
+
+#include <Poco/Net/NetException.h>
+#include <Poco/Net/ServerSocket.h>
+#include <Poco/Net/StreamSocket.h>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <fstream>
+#include <iterator>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/// Helpers to build ADARA packet streams and serve them to a
+/// SNSLiveEventDataListener over a local socket, in place of a real SMS.
+namespace ADARAReplay {
+
+using Stream = std::vector<uint8_t>;
+
+/// A banked event as it appears in the stream: tof in units of 100ns
+struct Event {
+  uint32_t tof;
+  uint32_t pixel;
+};
+
+// -----------------------------------------------------------------------------
+// Packet builders
+// -----------------------------------------------------------------------------
+namespace detail {
+inline void appendWord(Stream &stream, const uint32_t word) {
+  const auto *bytes = reinterpret_cast<const uint8_t *>(&word);
+  stream.insert(stream.end(), bytes, bytes + sizeof(word));
+}
+
+inline void appendString(Stream &stream, const std::string &str) {
+  stream.insert(stream.end(), str.begin(), str.end());
+}
+
+/// Appends a packet header and the payload, padded to a multiple of 4 bytes
+inline void appendPacket(Stream &stream, const uint32_t type,
+                         const uint32_t seconds, const uint32_t nanoseconds,
+                         Stream payload) {
+  payload.resize((payload.size() + 3) / 4 * 4, 0);
+  appendWord(stream, static_cast<uint32_t>(payload.size()));
+  appendWord(stream, type);
+  appendWord(stream, seconds);
+  appendWord(stream, nanoseconds);
+  stream.insert(stream.end(), payload.begin(), payload.end());
+}
+} // namespace detail
+
+/// Appends a run status packet. Times are seconds since the EPICS epoch.
+inline void appendRunStatus(Stream &stream, const uint32_t seconds,
+                            const uint32_t runNumber,
+                            const ADARA::RunStatus::Enum status) {
+  Stream payload;
+  detail::appendWord(payload, runNumber);
+  detail::appendWord(payload, seconds);
+  detail::appendWord(payload, static_cast<uint32_t>(status) << 24);
+  detail::appendPacket(
+      stream,
+      ADARA_PKT_TYPE(ADARA::PacketType::RUN_STATUS_TYPE,
+                     ADARA::PacketType::RUN_STATUS_VERSION),
+      seconds, 0, std::move(payload));
+}
+
+/// Appends a beamline info packet carrying the instrument name
+inline void appendBeamlineInfo(Stream &stream, const uint32_t seconds,
+                               const std::string &name) {
+  Stream payload;
+  const auto length = static_cast<uint32_t>(name.size());
+  detail::appendWord(payload, length | (length << 8) | (length << 16));
+  for (int i = 0; i < 3; ++i) // id, short name and long name
+    detail::appendString(payload, name);
+  detail::appendPacket(
+      stream,
+      ADARA_PKT_TYPE(ADARA::PacketType::BEAMLINE_INFO_TYPE,
+                     ADARA::PacketType::BEAMLINE_INFO_VERSION),
+      seconds, 0, std::move(payload));
+}
+
+/// Appends a geometry packet carrying an instrument definition
+inline void appendGeometry(Stream &stream, const uint32_t seconds,
+                           const std::string &xml) {
+  Stream payload;
+  detail::appendWord(payload, static_cast<uint32_t>(xml.size()));
+  detail::appendString(payload, xml);
+  detail::appendPacket(stream,
+                       ADARA_PKT_TYPE(ADARA::PacketType::GEOMETRY_TYPE,
+                                      ADARA::PacketType::GEOMETRY_VERSION),
+                       seconds, 0, std::move(payload));
+}
+
+/// Appends a banked event packet for one pulse. Each element of banks holds
+/// the (already corrected) events of one bank, numbered from 0.
+inline void appendBankedEvents(Stream &stream, const uint32_t seconds,
+                               const uint32_t nanoseconds,
+                               const uint32_t pulseCharge,
+                               const std::vector<std::vector<Event>> &banks) {
+  Stream payload;
+  detail::appendWord(payload, pulseCharge);
+  detail::appendWord(payload, 0); // energy
+  detail::appendWord(payload, 0); // cycle
+  detail::appendWord(payload, 0); // flags
+  // A single source section holding all the banks
+  detail::appendWord(payload, 0);          // source id
+  detail::appendWord(payload, 0);          // intra-pulse time
+  detail::appendWord(payload, 0x80000000); // corrected, no tof offset
+  detail::appendWord(payload, static_cast<uint32_t>(banks.size()));
+  for (size_t bank = 0; bank < banks.size(); ++bank) {
+    detail::appendWord(payload, static_cast<uint32_t>(bank));
+    detail::appendWord(payload, static_cast<uint32_t>(banks[bank].size()));
+    for (const auto &event : banks[bank]) {
+      detail::appendWord(payload, event.tof);
+      detail::appendWord(payload, event.pixel);
+    }
+  }
+  detail::appendPacket(
+      stream,
+      ADARA_PKT_TYPE(ADARA::PacketType::BANKED_EVENT_TYPE,
+                     ADARA::PacketType::BANKED_EVENT_VERSION),
+      seconds, nanoseconds, std::move(payload));
+}
+
+/// An instrument definition with a source, a sample, a monitor and a line of
+/// numberOfPixels pixels with the IDs 1 to numberOfPixels. The monitor has the
+/// ID numberOfPixels + 1.
+inline std::string instrumentXML(const std::string &name,
+                                 const int numberOfPixels) {
+  const std::string shape = "<sphere id=\"shape\"><centre x=\"0.0\" y=\"0.0\" "
+                            "z=\"0.0\"/><radius val=\"0.001\"/></sphere>"
+                            "<algebra val=\"shape\"/>";
+  std::string xml =
+      "<?xml version=\"1.0\" encoding=\"UTF-8\"?>"
+      "<instrument name=\"" +
+      name +
+      "\" valid-from=\"1900-01-31 23:59:59\" "
+      "valid-to=\"2100-01-31 23:59:59\" "
+      "last-modified=\"2019-01-01 00:00:00\">"
+      "<defaults><length unit=\"meter\"/><angle unit=\"degree\"/>"
+      "<reference-frame><along-beam axis=\"z\"/><pointing-up axis=\"y\"/>"
+      "<handedness val=\"right\"/></reference-frame></defaults>"
+      "<component type=\"moderator\"><location z=\"-10.0\"/></component>"
+      "<type name=\"moderator\" is=\"Source\"/>"
+      "<component type=\"sample-position\"><location/></component>"
+      "<type name=\"sample-position\" is=\"SamplePos\"/>"
+      "<component type=\"monitor\" idlist=\"monitors\">"
+      "<location z=\"-1.0\"/></component>"
+      "<type name=\"monitor\" is=\"monitor\">" +
+      shape +
+      "</type>"
+      "<idlist idname=\"monitors\"><id val=\"" +
+      std::to_string(numberOfPixels + 1) +
+      "\"/></idlist>"
+      "<component type=\"bank\" idlist=\"pixels\"><location/></component>"
+      "<type name=\"bank\"><component type=\"pixel\">";
+  for (int i = 0; i < numberOfPixels; ++i) {
+    xml += "<location x=\"" + std::to_string(0.001 * i) + "\" z=\"2.0\"/>";
+  }
+  xml += "</component></type>"
+         "<type name=\"pixel\" is=\"detector\">" +
+         shape +
+         "</type>"
+         "<idlist idname=\"pixels\"><id start=\"1\" end=\"" +
+         std::to_string(numberOfPixels) +
+         "\"/></idlist>"
+         "</instrument>";
+  return xml;
+}
+
+/// The packets an SMS sends a new client in the middle of a run: the run
+/// status, the beamline info and the geometry
+inline Stream runPreamble(const uint32_t seconds, const std::string &name,
+                          const int numberOfPixels) {
+  Stream stream;
+  appendRunStatus(stream, seconds, 1, ADARA::RunStatus::STATE);
+  appendBeamlineInfo(stream, seconds, name);
+  appendGeometry(stream, seconds, instrumentXML(name, numberOfPixels));
+  return stream;
+}
+
+/// Reads a stream previously captured from an SMS
+inline Stream loadStream(const std::string &filename) {
+  std::ifstream file(filename, std::ios::binary);
+  return Stream(std::istreambuf_iterator<char>(file),
+                std::istreambuf_iterator<char>());
+}
+
+// -----------------------------------------------------------------------------
+// Replay server
+// -----------------------------------------------------------------------------
+/// Plays the part of the SMS: accepts one connection on an ephemeral port of
+/// the loopback interface, waits for the client hello packet, sends the
+/// stream and keeps the connection open until the server is destroyed.
+class Server {
+public:
+  explicit Server(Stream stream)
+      : m_stream(std::move(stream)),
+        m_server(Poco::Net::SocketAddress("127.0.0.1", 0)),
+        m_thread(&Server::serve, this) {}
+
+  ~Server() {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_stop = true;
+    }
+    m_condition.notify_all();
+    m_thread.join();
+  }
+
+  Server(const Server &) = delete;
+  Server &operator=(const Server &) = delete;
+
+  /// The address to connect the listener to
+  std::string address() const {
+    return "127.0.0.1:" + std::to_string(m_server.address().port());
+  }
+
+  /// Whether the whole stream has been sent
+  bool finished() const { return m_finished; }
+
+private:
+  void serve() {
+    const Poco::Timespan pollInterval(0, 10000);
+    while (!stopping()) {
+      if (!m_server.poll(pollInterval, Poco::Net::Socket::SELECT_READ))
+        continue;
+
+      auto socket = m_server.acceptConnection();
+      try {
+        // The client hello packet is 5 words long
+        uint8_t hello[5 * sizeof(uint32_t)];
+        int received = 0;
+        while (received < static_cast<int>(sizeof(hello)) && !stopping()) {
+          const int bytes =
+              socket.receiveBytes(hello + received,
+                                  static_cast<int>(sizeof(hello)) - received);
+          if (bytes <= 0)
+            return;
+          received += bytes;
+        }
+
+        const size_t chunkSize = 64 * 1024;
+        for (size_t sent = 0; sent < m_stream.size() && !stopping();) {
+          const auto length = std::min(chunkSize, m_stream.size() - sent);
+          sent += static_cast<size_t>(socket.sendBytes(
+              m_stream.data() + sent, static_cast<int>(length)));
+        }
+        m_finished = true;
+      } catch (Poco::Net::NetException &) {
+        // The client went away
+      }
+
+      std::unique_lock<std::mutex> lock(m_mutex);
+      m_condition.wait(lock, [this] { return m_stop; });
+      socket.close();
+    }
+  }
+
+  bool stopping() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_stop;
+  }
+
+  const Stream m_stream;
+  Poco::Net::ServerSocket m_server;
+  std::mutex m_mutex;
+  std::condition_variable m_condition;
+  bool m_stop{false};
+  std::atomic<bool> m_finished{false};
+  std::thread m_thread;
+};
+
+} // namespace ADARAReplay
+
+#endif /* MANTID_LIVEDATA_ADARAREPLAY_H_ */
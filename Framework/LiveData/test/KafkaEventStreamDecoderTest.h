@@ -600,4 +600,90 @@ private:
   uint8_t m_niterations = 0;
 };
 
+class KafkaEventStreamDecoderTestPerformance : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static KafkaEventStreamDecoderTestPerformance *createSuite() {
+    return new KafkaEventStreamDecoderTestPerformance();
+  }
+  static void destroySuite(KafkaEventStreamDecoderTestPerformance *suite) {
+    delete suite;
+  }
+
+  void setUp() override {
+    using Mantid::Kernel::ConfigService;
+    auto &config = ConfigService::Instance();
+    auto baseInstDir = config.getInstrumentDirectory();
+    Poco::Path testFile =
+        Poco::Path(baseInstDir).resolve("unit_testing/UnitTestFacilities.xml");
+    config.updateFacilities(testFile.toString());
+    config.setFacility("TEST");
+    config.setString("instrumentDefinition.directory",
+                     baseInstDir + "/unit_testing");
+  }
+
+  void tearDown() override {
+    using Mantid::Kernel::ConfigService;
+    auto &config = ConfigService::Instance();
+    config.reset();
+    config.updateFacilities();
+  }
+
+  void test_Decode_10M_Events_In_Small_Messages() {
+    decodeEvents(10000, 1000);
+  }
+
+  void test_Decode_10M_Events_In_Large_Messages() {
+    decodeEvents(100, 100000);
+  }
+
+private:
+  void decodeEvents(uint32_t nMessages, uint32_t eventsPerMessage) {
+    using namespace ::testing;
+    using namespace KafkaTesting;
+    using Mantid::DataObjects::EventWorkspace;
+    using namespace Mantid::LiveData;
+
+    auto mockBroker = std::make_shared<MockKafkaBroker>();
+    EXPECT_CALL(*mockBroker, subscribe_(_, _))
+        .Times(Exactly(3))
+        .WillOnce(Return(new FakeHighRateEventSubscriber(eventsPerMessage)))
+        .WillOnce(Return(new FakeRunInfoStreamSubscriber(1)))
+        .WillOnce(Return(new FakeISISSpDetStreamSubscriber));
+    auto decoder = std::make_unique<KafkaEventStreamDecoder>(
+        mockBroker, "", "", "", "", "", 1000000);
+
+    uint32_t nIterations = 0;
+    auto callback = [this, &nIterations, nMessages]() {
+      std::unique_lock<std::mutex> lock(m_callbackMutex);
+      if (++nIterations == nMessages) {
+        lock.unlock();
+        m_callbackCondition.notify_one();
+      }
+    };
+    decoder->registerIterationEndCb(callback);
+    decoder->registerErrorCb(callback);
+    TS_ASSERT_THROWS_NOTHING(decoder->startCapture());
+    {
+      std::unique_lock<std::mutex> lock(m_callbackMutex);
+      m_callbackCondition.wait(
+          lock, [&nIterations, nMessages]() { return nIterations >= nMessages; });
+    }
+    TS_ASSERT_THROWS_NOTHING(decoder->stopCapture());
+
+    auto eventWksp =
+        boost::dynamic_pointer_cast<EventWorkspace>(decoder->extractData());
+    TS_ASSERT(eventWksp);
+    if (eventWksp) {
+      TS_ASSERT(eventWksp->getNumberEvents() >=
+                static_cast<size_t>(nMessages) * eventsPerMessage);
+      TS_ASSERT_EQUALS(eventWksp->getNumberEvents() % eventsPerMessage, 0);
+    }
+  }
+
+  std::mutex m_callbackMutex;
+  std::condition_variable m_callbackCondition;
+};
+
 #endif /* MANTID_LIVEDATA_KAFKAEVENTSTREAMDECODERTEST_H_ */
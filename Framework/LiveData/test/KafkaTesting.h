@@ -702,6 +702,68 @@ private:
   int64_t m_stopOffset;
 };
 
+// -----------------------------------------------------------------------------
+// Fake high rate event stream, serving the same large event message from
+// memory on every call
+// -----------------------------------------------------------------------------
+class FakeHighRateEventSubscriber
+    : public Mantid::LiveData::IKafkaStreamSubscriber {
+public:
+  explicit FakeHighRateEventSubscriber(uint32_t eventsPerMessage) {
+    // Spread the events over the spectra of FakeISISSpDetStreamSubscriber
+    std::vector<uint32_t> spec(eventsPerMessage);
+    std::vector<uint32_t> tof(eventsPerMessage);
+    for (uint32_t i = 0; i < eventsPerMessage; ++i) {
+      spec[i] = 1 + (i * 7919) % 5;
+      tof[i] = 6000 + (i * 104729) % 5000;
+    }
+
+    flatbuffers::FlatBufferBuilder builder;
+    uint64_t frameTime = 1;
+    auto messageFlatbuf = CreateEventMessage(
+        builder, builder.CreateString("KafkaTesting"), 0, frameTime,
+        builder.CreateVector(tof), builder.CreateVector(spec));
+    FinishEventMessageBuffer(builder, messageFlatbuf);
+    m_message.assign(reinterpret_cast<const char *>(builder.GetBufferPointer()),
+                     builder.GetSize());
+  }
+  void subscribe() override {}
+  void subscribe(int64_t offset) override { UNUSED_ARG(offset) }
+  void consumeMessage(std::string *buffer, int64_t &offset, int32_t &partition,
+                      std::string &topic) override {
+    assert(buffer);
+
+    buffer->assign(m_message);
+
+    UNUSED_ARG(offset);
+    UNUSED_ARG(partition);
+    UNUSED_ARG(topic);
+  }
+
+  std::unordered_map<std::string, std::vector<int64_t>>
+  getOffsetsForTimestamp(int64_t timestamp) override {
+    UNUSED_ARG(timestamp);
+    return {
+        std::pair<std::string, std::vector<int64_t>>("topic_name", {1, 2, 3})};
+  }
+
+  std::unordered_map<std::string, std::vector<int64_t>>
+  getCurrentOffsets() override {
+    std::unordered_map<std::string, std::vector<int64_t>> offsets;
+    return offsets;
+  }
+
+  void seek(const std::string &topic, uint32_t partition,
+            int64_t offset) override {
+    UNUSED_ARG(topic);
+    UNUSED_ARG(partition);
+    UNUSED_ARG(offset);
+  }
+
+private:
+  std::string m_message;
+};
+
 // -----------------------------------------------------------------------------
 // Fake ISIS spectra-detector stream
 // -----------------------------------------------------------------------------
@@ -7,6 +7,7 @@
 #ifndef MANTID_LIVEDATA_LOADLIVEDATATEST_H_
 #define MANTID_LIVEDATA_LOADLIVEDATATEST_H_
 
+#include "MantidAPI/AlgorithmManager.h"
 #include "MantidAPI/FrameworkManager.h"
 #include "MantidAPI/LiveListenerFactory.h"
 #include "MantidDataObjects/EventWorkspace.h"
@@ -59,7 +60,7 @@ public:
          std::string PostProcessingAlgorithm = "",
          std::string PostProcessingProperties = "", bool PreserveEvents = true,
          ILiveListener_sptr listener = ILiveListener_sptr(),
-         bool makeThrow = false) {
+         bool makeThrow = false, std::string PostProcessingMode = "Full") {
     FacilityHelper::ScopedFacilities loadTESTFacility(
         "unit_testing/UnitTestFacilities.xml", "TEST");
 
@@ -79,6 +80,8 @@ public:
     TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("PostProcessingProperties",
                                                   PostProcessingProperties));
     TS_ASSERT_THROWS_NOTHING(alg.setProperty("PreserveEvents", PreserveEvents));
+    TS_ASSERT_THROWS_NOTHING(
+        alg.setPropertyValue("PostProcessingMode", PostProcessingMode));
     if (!PostProcessingAlgorithm.empty())
       TS_ASSERT_THROWS_NOTHING(
           alg.setPropertyValue("AccumulationWorkspace", "fake_accum"));
@@ -305,6 +308,56 @@ public:
     TS_ASSERT_EQUALS(AnalysisDataService::Instance().size(), 2);
   }
 
+  //--------------------------------------------------------------------------------------------
+  /** Incremental post-processing adds the post-processed chunks */
+  void test_PostProcessing_Incremental() {
+    const std::string params = "Params=40e3, 1e3, 60e3;PreserveEvents=0";
+    Workspace2D_sptr ws1 =
+        doExec<Workspace2D>("Add", "", "", "Rebin", params, true,
+                            ILiveListener_sptr(), false, "Incremental");
+    Workspace2D_sptr ws2 =
+        doExec<Workspace2D>("Add", "", "", "Rebin", params, true,
+                            ILiveListener_sptr(), false, "Incremental");
+    TSM_ASSERT("The chunk was added to the previous output", ws1 == ws2);
+    TS_ASSERT_EQUALS(AnalysisDataService::Instance().size(), 2);
+
+    EventWorkspace_sptr ws_accum =
+        AnalysisDataService::Instance().retrieveWS<EventWorkspace>(
+            "fake_accum");
+    TS_ASSERT_EQUALS(ws_accum->getNumberEvents(), 400);
+
+    // Same result as post-processing the whole accumulation workspace
+    auto rebin = AlgorithmManager::Instance().createUnmanaged("Rebin");
+    rebin->initialize();
+    rebin->setChild(true);
+    rebin->setProperty("InputWorkspace", ws_accum);
+    rebin->setPropertyValue("Params", "40e3, 1e3, 60e3");
+    rebin->setProperty("PreserveEvents", false);
+    rebin->setPropertyValue("OutputWorkspace", "unused");
+    rebin->execute();
+    MatrixWorkspace_sptr full = rebin->getProperty("OutputWorkspace");
+    TS_ASSERT_EQUALS(ws2->getNumberHistograms(), 2);
+    TS_ASSERT_EQUALS(ws2->blocksize(), 20);
+    for (size_t i = 0; i < ws2->getNumberHistograms(); ++i) {
+      TS_ASSERT_EQUALS(ws2->x(i).rawData(), full->x(i).rawData());
+      TS_ASSERT_EQUALS(ws2->y(i).rawData(), full->y(i).rawData());
+    }
+  }
+
+  //--------------------------------------------------------------------------------------------
+  /** Incremental post-processing falls back to post-processing everything */
+  void test_PostProcessing_Incremental_falls_back_when_replacing() {
+    EventWorkspace_sptr ws1 = doExec<EventWorkspace>(
+        "Replace", "", "", "Rebin", "Params=40e3, 1e3, 60e3", true,
+        ILiveListener_sptr(), false, "Incremental");
+    EventWorkspace_sptr ws2 = doExec<EventWorkspace>(
+        "Replace", "", "", "Rebin", "Params=40e3, 1e3, 60e3", true,
+        ILiveListener_sptr(), false, "Incremental");
+    TS_ASSERT_EQUALS(ws2->getNumberEvents(), 200);
+    TS_ASSERT_EQUALS(ws2->blocksize(), 20);
+    TS_ASSERT_EQUALS(AnalysisDataService::Instance().size(), 2);
+  }
+
   //--------------------------------------------------------------------------------------------
   /** Do some processing that converts to a different type of workspace */
   void test_ProcessToMDWorkspace_and_Add() {
@@ -10,14 +10,76 @@
 /* This code is largely based on Russell Taylor's test for the
  * FakeEventDataLister class. */
 
+#include "ADARAReplay.h"
 #include "MantidAPI/LiveListenerFactory.h"
+#include "MantidAPI/Run.h"
 #include "MantidDataObjects/EventWorkspace.h"
 #include "MantidKernel/CPUTimer.h"
+#include "MantidKernel/LiveListenerInfo.h"
+#include "MantidKernel/TimeSeriesProperty.h"
 #include <Poco/Thread.h>
 #include <cxxtest/TestSuite.h>
 
 using namespace Mantid::API;
+using Mantid::DataObjects::EventWorkspace;
+using Mantid::DataObjects::EventWorkspace_sptr;
 using Mantid::Kernel::CPUTimer;
+using Mantid::Kernel::LiveListenerInfo;
+using Mantid::Types::Core::DateAndTime;
+
+namespace {
+const std::string INSTRUMENT_NAME = "ADARA_REPLAY";
+// Mid 2019, in seconds since the EPICS epoch
+const uint32_t RUN_START = 930000000;
+
+/// A stream of numberOfPulses pulses at 60Hz, each with two banks holding
+/// eventsPerPixel events for every pixel
+ADARAReplay::Stream createStream(const int numberOfPixels,
+                                 const int numberOfPulses,
+                                 const int eventsPerPixel,
+                                 const uint32_t pulseCharge) {
+  auto stream =
+      ADARAReplay::runPreamble(RUN_START, INSTRUMENT_NAME, numberOfPixels);
+  for (int pulse = 0; pulse < numberOfPulses; ++pulse) {
+    std::vector<std::vector<ADARAReplay::Event>> banks(2);
+    for (int event = 0; event < eventsPerPixel; ++event) {
+      for (int pixel = 1; pixel <= numberOfPixels; ++pixel) {
+        // tof in units of 100ns, so pixel microseconds
+        const auto tof = static_cast<uint32_t>(10 * pixel);
+        banks[pixel % 2].push_back({tof, static_cast<uint32_t>(pixel)});
+      }
+    }
+    const auto nanoseconds = static_cast<uint32_t>(pulse % 60) * 16666667;
+    ADARAReplay::appendBankedEvents(stream, RUN_START + 1 + pulse / 60,
+                                    nanoseconds, pulseCharge, banks);
+  }
+  return stream;
+}
+
+ILiveListener_sptr connectListener(const ADARAReplay::Server &server) {
+  auto listener = LiveListenerFactory::Instance().create(
+      LiveListenerInfo("SNSLiveEventDataListener", server.address()), true);
+  listener->start(DateAndTime(0));
+  return listener;
+}
+
+/// Extracts the data from the listener until it has returned expectedEvents
+/// events, or a few seconds have passed. Returns the extracted workspaces.
+std::vector<EventWorkspace_sptr> extractEvents(ILiveListener &listener,
+                                               const size_t expectedEvents) {
+  std::vector<EventWorkspace_sptr> chunks;
+  size_t events = 0;
+  const DateAndTime endTime = DateAndTime::getCurrentTime() + 30.0;
+  while (events < expectedEvents && DateAndTime::getCurrentTime() < endTime) {
+    Poco::Thread::sleep(50);
+    auto chunk =
+        boost::dynamic_pointer_cast<EventWorkspace>(listener.extractData());
+    events += chunk->getNumberEvents();
+    chunks.push_back(chunk);
+  }
+  return chunks;
+}
+} // namespace
 
 class SNSLiveEventDataListenerTest : public CxxTest::TestSuite {
 public:
@@ -30,64 +92,132 @@ public:
     delete suite;
   }
 
-  SNSLiveEventDataListenerTest() {
-    // Create the listener. Remember: this will call connect()
-    sns_l = LiveListenerFactory::Instance().create("SNSLiveEventDataListener");
-    // sns_l = LiveListenerFactory::Instance().create("SEQUOIA");
-  }
-
   void testProperties() {
+    // Not connecting, as that needs a server
+    auto sns_l = LiveListenerFactory::Instance().create(
+        LiveListenerInfo("SNSLiveEventDataListener", "localhost:31415"),
+        false);
     TS_ASSERT(sns_l)
     TS_ASSERT_EQUALS(sns_l->name(), "SNSLiveEventDataListener")
-    TS_ASSERT(!sns_l->supportsHistory())
+    TS_ASSERT(sns_l->supportsHistory())
     TS_ASSERT(sns_l->buffersEvents())
-    TS_ASSERT(sns_l->isConnected())
+    TS_ASSERT(!sns_l->isConnected())
+  }
+};
+
+//------------------------------------------------------------------------------
+// Performance tests
+//------------------------------------------------------------------------------
+class SNSLiveEventDataListenerTestPerformance : public CxxTest::TestSuite {
+public:
+  static SNSLiveEventDataListenerTestPerformance *createSuite() {
+    return new SNSLiveEventDataListenerTestPerformance();
   }
+  static void destroySuite(SNSLiveEventDataListenerTestPerformance *suite) {
+    delete suite;
+  }
+
+  SNSLiveEventDataListenerTestPerformance()
+      : m_stream(createStream(NUMBER_OF_PIXELS, NUMBER_OF_PULSES, 10, 1)) {}
+
+  // The tests below replay a stream to the listener through a local socket
+  // server, waiting up to 30 seconds for the events, so they are not run with
+  // the unit tests
 
-  void testStart() {
-    // Nothing much to test just yet
-    TS_ASSERT_THROWS_NOTHING(sns_l->start(0))
+  void testConnects() {
+    ADARAReplay::Server server(ADARAReplay::runPreamble(RUN_START,
+                                                        INSTRUMENT_NAME, 4));
+    auto sns_l = LiveListenerFactory::Instance().create(
+        LiveListenerInfo("SNSLiveEventDataListener", server.address()), true);
+    TS_ASSERT(sns_l->isConnected())
   }
 
   void testExtractData() {
-    using namespace Mantid::DataObjects;
-    Workspace_const_sptr buffer;
-    Poco::Thread::sleep(100);
-    TS_ASSERT_THROWS_NOTHING(buffer = sns_l->extractData())
-    // Check this is the only surviving reference to it
-    TS_ASSERT_EQUALS(buffer.use_count(), 1)
-    // Check it's an event workspace
-    EventWorkspace_const_sptr evbuf =
-        boost::dynamic_pointer_cast<const EventWorkspace>(buffer);
-    TS_ASSERT(evbuf)
-    // Check the workspace has the correct dimension
-    TS_ASSERT_EQUALS(evbuf->getNumberHistograms(), 2)
-    // Should be around 20 events, but this can vary a lot on some platforms so
-    // just check there's something
-    TS_ASSERT_LESS_THAN(1, evbuf->getNumberEvents())
+    const int numberOfPixels = 16;
+    const int numberOfPulses = 90;
+    const int eventsPerPixel = 3;
+    ADARAReplay::Server server(
+        createStream(numberOfPixels, numberOfPulses, eventsPerPixel, 5));
+    auto sns_l = connectListener(server);
 
-    Poco::Thread::sleep(100);
-    // Call it again, and check things again
-    TS_ASSERT_THROWS_NOTHING(buffer = sns_l->extractData())
-    // Check this is the only surviving reference to it
-    TS_ASSERT_EQUALS(buffer.use_count(), 1)
-    // Check it's a different workspace to last time
-    TS_ASSERT_DIFFERS(buffer.get(), evbuf.get())
-    // Check it's an event workspace
-    evbuf = boost::dynamic_pointer_cast<const EventWorkspace>(buffer);
-    TS_ASSERT(evbuf)
-    // Check the workspace has the correct dimension
-    TS_ASSERT_EQUALS(evbuf->getNumberHistograms(), 2)
-    // Should be around 20 events, but this can vary a lot on some platforms so
-    // just check there's something
-    TS_ASSERT_LESS_THAN(1, evbuf->getNumberEvents())
+    const size_t expectedEvents =
+        numberOfPixels * numberOfPulses * eventsPerPixel;
+    const auto chunks = extractEvents(*sns_l, expectedEvents);
+    TS_ASSERT(server.finished())
+    TS_ASSERT(!chunks.empty())
+
+    size_t totalEvents = 0;
+    std::vector<size_t> eventsPerSpectrum(numberOfPixels, 0);
+    for (const auto &chunk : chunks) {
+      // Check this is the only surviving reference to it
+      TS_ASSERT_EQUALS(chunk.use_count(), 1)
+      TS_ASSERT_EQUALS(chunk->getNumberHistograms(), numberOfPixels)
+      totalEvents += chunk->getNumberEvents();
+      for (size_t i = 0; i < chunk->getNumberHistograms(); ++i) {
+        const auto &eventList = chunk->getSpectrum(i);
+        const auto detectorID = *eventList.getDetectorIDs().begin();
+        eventsPerSpectrum[i] += eventList.getNumberEvents();
+        for (const auto &event : eventList.getEvents()) {
+          TS_ASSERT_DELTA(event.tof(), detectorID, 1e-10)
+        }
+      }
+    }
+    TS_ASSERT_EQUALS(totalEvents, expectedEvents)
+    for (const auto events : eventsPerSpectrum) {
+      TS_ASSERT_EQUALS(events, numberOfPulses * eventsPerPixel)
+    }
+
+    // The pulse charges arrive in units of 10pC
+    const auto &lastChunk = chunks.back();
+    auto protonCharge =
+        lastChunk->run().getTimeSeriesProperty<double>("proton_charge");
+    TS_ASSERT_EQUALS(protonCharge->lastValue(), 50.)
+    TS_ASSERT_EQUALS(lastChunk->run().getProperty("run_number")->value(), "1")
+  }
+
+  void testEventsKeepPulseOrderWithinSpectrum() {
+    const int numberOfPixels = 4;
+    const int numberOfPulses = 120;
+    ADARAReplay::Server server(
+        createStream(numberOfPixels, numberOfPulses, 1, 1));
+    auto sns_l = connectListener(server);
+
+    const auto chunks =
+        extractEvents(*sns_l, numberOfPixels * numberOfPulses);
+    for (const auto &chunk : chunks) {
+      for (size_t i = 0; i < chunk->getNumberHistograms(); ++i) {
+        const auto &events = chunk->getSpectrum(i).getEvents();
+        for (size_t j = 1; j < events.size(); ++j) {
+          TS_ASSERT_LESS_THAN(events[j - 1].pulseTime(), events[j].pulseTime())
+        }
+      }
+    }
+  }
+
+  void testInvalidPixelsAreIgnored() {
+    const int numberOfPixels = 4;
+    auto stream = ADARAReplay::runPreamble(RUN_START, INSTRUMENT_NAME,
+                                           numberOfPixels);
+    // Pixel 0 and 100 are not in the instrument
+    ADARAReplay::appendBankedEvents(stream, RUN_START + 1, 0, 1,
+                                    {{{10, 1}, {10, 0}, {20, 2}, {10, 100}}});
+    ADARAReplay::Server server(std::move(stream));
+    auto sns_l = connectListener(server);
+
+    const auto chunks = extractEvents(*sns_l, 2);
+    size_t totalEvents = 0;
+    for (const auto &chunk : chunks) {
+      totalEvents += chunk->getNumberEvents();
+    }
+    TS_ASSERT_EQUALS(totalEvents, 2)
   }
 
   /** Call the extractData very quickly to try to trip up
    * the thread.
    */
   void testThreadSafety() {
-    using namespace Mantid::DataObjects;
+    ADARAReplay::Server server(createStream(16, 600, 1, 1));
+    auto sns_l = connectListener(server);
     Workspace_const_sptr buffer;
     Poco::Thread::sleep(100);
 
@@ -102,8 +232,19 @@ public:
               << std::endl;
   }
 
+  void test_replay_dense_pulses() {
+    ADARAReplay::Server server(m_stream);
+    auto sns_l = connectListener(server);
+    const auto chunks = extractEvents(
+        *sns_l, static_cast<size_t>(NUMBER_OF_PIXELS) * NUMBER_OF_PULSES * 10);
+    TS_ASSERT(!chunks.empty())
+  }
+
 private:
-  boost::shared_ptr<ILiveListener> sns_l;
+  // 500 pulses of 20000 events
+  static constexpr int NUMBER_OF_PIXELS = 2000;
+  static constexpr int NUMBER_OF_PULSES = 500;
+  const ADARAReplay::Stream m_stream;
 };
 
 #endif /* MANTID_LIVEDATA_SNSLIVEEVENTDATALISTENERTEST_H_ */
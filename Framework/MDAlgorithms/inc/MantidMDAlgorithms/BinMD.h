@@ -63,6 +63,13 @@ private:
   void init() override;
   /// Run the algorithm
   void exec() override;
+  /// Run the algorithm on a distributed input
+  void execDistributed() override;
+  Parallel::ExecutionMode getParallelExecutionMode(
+      const std::map<std::string, Parallel::StorageMode> &storageModes)
+      const override;
+  /// Bin the input into outWS
+  void bin();
 
   //    /// Helper method
   //    template<typename MDE, size_t nd>
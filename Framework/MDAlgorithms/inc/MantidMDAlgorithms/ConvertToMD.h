@@ -63,6 +63,10 @@ private:
 
   void setupFileBackend(std::string filebackPath,
                         API::IMDEventWorkspace_sptr outputWS);
+  std::string preprocDetectorsWSName(const API::MatrixWorkspace &inWS) const;
+  Parallel::ExecutionMode getParallelExecutionMode(
+      const std::map<std::string, Parallel::StorageMode> &storageModes)
+      const override;
 
   //------------------------------------------------------------------------------------------------------------------------------------------
 protected: // for testing, otherwise private:
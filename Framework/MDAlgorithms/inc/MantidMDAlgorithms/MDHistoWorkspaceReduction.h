@@ -0,0 +1,32 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_MDALGORITHMS_MDHISTOWORKSPACEREDUCTION_H_
+#define MANTID_MDALGORITHMS_MDHISTOWORKSPACEREDUCTION_H_
+
+#include "MantidMDAlgorithms/DllConfig.h"
+
+namespace Mantid {
+namespace DataObjects {
+class MDHistoWorkspace;
+}
+namespace Parallel {
+class Communicator;
+}
+namespace MDAlgorithms {
+
+/** Sums the signal, error squared and event count arrays of rank-local
+  MDHistoWorkspaces with identical binning onto the master rank (rank 0). The
+  workspaces on the other ranks are left unchanged.
+*/
+MANTID_MDALGORITHMS_DLL void
+reduceToMaster(const Parallel::Communicator &comm,
+               DataObjects::MDHistoWorkspace &ws);
+
+} // namespace MDAlgorithms
+} // namespace Mantid
+
+#endif /* MANTID_MDALGORITHMS_MDHISTOWORKSPACEREDUCTION_H_ */
@@ -33,6 +33,13 @@ public:
 private:
   void init() override;
   void exec() override;
+  void execDistributed() override;
+  Parallel::ExecutionMode getParallelExecutionMode(
+      const std::map<std::string, Parallel::StorageMode> &storageModes)
+      const override;
+  DataObjects::MDHistoWorkspace_sptr binAndNormalize();
+  void
+  setOutputWorkspaces(const DataObjects::MDHistoWorkspace_sptr &outputDataWS);
   void validateBinningForTemporaryDataWorkspace(
       const std::map<std::string, std::string> &,
       const Mantid::API::IMDHistoWorkspace_sptr);
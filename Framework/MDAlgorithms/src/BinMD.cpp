@@ -21,6 +21,8 @@
 #include "MantidKernel/Strings.h"
 #include "MantidKernel/System.h"
 #include "MantidKernel/Utils.h"
+#include "MantidMDAlgorithms/MDHistoWorkspaceReduction.h"
+#include "MantidParallel/Communicator.h"
 #include <boost/algorithm/string.hpp>
 
 namespace Mantid {
@@ -368,6 +370,42 @@ void BinMD::binByIterating(typename MDEventWorkspace<MDE, nd>::sptr ws) {
 /** Execute the algorithm.
  */
 void BinMD::exec() {
+  bin();
+  outWS->updateSum();
+  // Save the output
+  setProperty("OutputWorkspace", boost::dynamic_pointer_cast<Workspace>(outWS));
+}
+
+/** Execute the algorithm on a distributed input: every rank bins its own
+ * events and the histograms are summed on the master rank, which is the only
+ * rank that has an output. As for an algorithm run in MasterOnly mode, the
+ * output workspace is left unset on the other ranks: a MasterOnly workspace
+ * only exists on the master rank, and WorkspaceProperty::store() accepts an
+ * unset output on the other ranks.
+ */
+void BinMD::execDistributed() {
+  bin();
+  reduceToMaster(communicator(), *outWS);
+  if (communicator().rank() == 0) {
+    outWS->setStorageMode(Parallel::StorageMode::MasterOnly);
+    outWS->updateSum();
+    setProperty("OutputWorkspace",
+                boost::dynamic_pointer_cast<Workspace>(outWS));
+  }
+}
+
+Parallel::ExecutionMode BinMD::getParallelExecutionMode(
+    const std::map<std::string, Parallel::StorageMode> &storageModes) const {
+  if (storageModes.count("TemporaryDataWorkspace"))
+    throw std::runtime_error("Using TemporaryDataWorkspace in an MPI run of " +
+                             name() + " is currently not supported.");
+  return Parallel::getCorrespondingExecutionMode(
+      storageModes.at("InputWorkspace"));
+}
+
+/** Bin the input workspace into outWS, without updating its sums.
+ */
+void BinMD::bin() {
   // Input MDEventWorkspace/MDHistoWorkspace
   m_inWS = getProperty("InputWorkspace");
   // Look at properties, create either axis-aligned or general transform.
@@ -451,10 +489,6 @@ void BinMD::exec() {
 
   // Pass on the display normalization from the input workspace
   outWS->setDisplayNormalization(m_inWS->displayNormalizationHisto());
-
-  outWS->updateSum();
-  // Save the output
-  setProperty("OutputWorkspace", boost::dynamic_pointer_cast<Workspace>(outWS));
 }
 
 } // namespace MDAlgorithms
@@ -35,6 +35,9 @@
 #include "MantidMDAlgorithms/MDTransfQ3D.h"
 #include "MantidMDAlgorithms/MDWSTransform.h"
 
+#include "MantidParallel/Collectives.h"
+#include "MantidParallel/Communicator.h"
+
 using namespace Mantid::API;
 using namespace Mantid::Kernel;
 using namespace Mantid::DataObjects;
@@ -148,6 +151,13 @@ std::map<std::string, std::string> ConvertToMD::validateInputs() {
     result["Filename"] = "Filename must be given if FileBackEnd is required.";
   }
 
+  API::MatrixWorkspace_const_sptr inputWS = getProperty("InputWorkspace");
+  if (fileBackEnd && inputWS &&
+      inputWS->storageMode() == Parallel::StorageMode::Distributed) {
+    result["FileBackEnd"] =
+        "No file back end implemented for distributed input workspaces.";
+  }
+
   if (treeBuilderType.find("Indexed") != std::string::npos) {
     if (fileBackEnd)
       result["ConverterType"] += "No file back end implemented "
@@ -268,11 +278,14 @@ void ConvertToMD::exec() {
     spws = this->createNewMDWorkspace(targWSDescr, fileBackEnd, out_filename);
   else // setup existing MD workspace as workspace target.
     m_OutWSWrapper->setMDWS(spws);
+  // Every rank converts its own spectra into a rank-local MD workspace
+  if (m_InWS2D->storageMode() == Parallel::StorageMode::Distributed)
+    spws->setStorageMode(Parallel::StorageMode::Distributed);
 
   // pre-process detectors;
   targWSDescr.m_PreprDetTable = this->preprocessDetectorsPositions(
       m_InWS2D, dEModReq, getProperty("UpdateMasks"),
-      std::string(getProperty("PreprocDetectorsWS")));
+      preprocDetectorsWSName(*m_InWS2D));
 
   /// copy & retrieve metadata, necessary to initialize convertToMD Plugin,
   /// including getting the unique number, that identifies the run, the source
@@ -704,8 +717,7 @@ void ConvertToMD::findMinMax(
   childAlg->setProperty("Q3DFrames", QFrame);
   childAlg->setProperty("OtherDimensions", otherDim);
   childAlg->setProperty("QConversionScales", ConvertTo);
-  childAlg->setProperty("PreprocDetectorsWS",
-                        std::string(getProperty("PreprocDetectorsWS")));
+  childAlg->setProperty("PreprocDetectorsWS", preprocDetectorsWSName(*inWS));
   childAlg->execute();
   if (!childAlg->isExecuted())
     throw(std::runtime_error("Can not properly execute child algorithm to find "
@@ -714,6 +726,19 @@ void ConvertToMD::findMinMax(
   minVal = childAlg->getProperty("MinValues");
   maxVal = childAlg->getProperty("MaxValues");
 
+  // A rank has only seen its own spectra, so combine the extents of all ranks
+  // to give every rank-local workspace the same dimensions
+  if (inWS->storageMode() == Parallel::StorageMode::Distributed) {
+    const auto &comm = communicator();
+    std::vector<double> extrema(comm.size());
+    for (size_t i = 0; i < nDim; ++i) {
+      Parallel::all_gather(comm, minVal[i], extrema);
+      minVal[i] = *std::min_element(extrema.begin(), extrema.end());
+      Parallel::all_gather(comm, maxVal[i], extrema);
+      maxVal[i] = *std::max_element(extrema.begin(), extrema.end());
+    }
+  }
+
   // if some min-max values for dimensions produce ws with 0 width in this
   // direction, change it to have some width;
   for (unsigned int i = 0; i < nDim; i++) {
@@ -780,5 +805,25 @@ void ConvertToMD::setupFileBackend(
   boxControllerMem->getFileIO()->setWriteBufferSize(1000000);
 }
 
+/**
+ * The name of the workspace the preprocessed detectors are cached under. The
+ * table of a distributed input holds the rank-local detectors only, so it is
+ * never stored in the (shared) analysis data service.
+ * @param inWS :: The workspace being converted
+ * @return The value of PreprocDetectorsWS, or "-" for distributed inputs
+ */
+std::string
+ConvertToMD::preprocDetectorsWSName(const API::MatrixWorkspace &inWS) const {
+  if (inWS.storageMode() == Parallel::StorageMode::Distributed)
+    return "-";
+  return getPropertyValue("PreprocDetectorsWS");
+}
+
+Parallel::ExecutionMode ConvertToMD::getParallelExecutionMode(
+    const std::map<std::string, Parallel::StorageMode> &storageModes) const {
+  return Parallel::getCorrespondingExecutionMode(
+      storageModes.at("InputWorkspace"));
+}
+
 } // namespace MDAlgorithms
 } // namespace Mantid
@@ -0,0 +1,53 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidMDAlgorithms/MDHistoWorkspaceReduction.h"
+#include "MantidDataObjects/MDHistoWorkspace.h"
+#include "MantidParallel/Collectives.h"
+
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <limits>
+#include <vector>
+
+namespace Mantid {
+namespace MDAlgorithms {
+
+void reduceToMaster(const Parallel::Communicator &comm,
+                    DataObjects::MDHistoWorkspace &ws) {
+  if (comm.size() == 1)
+    return;
+
+  // The element counts of the reductions are int, so the arrays are reduced
+  // in chunks that fit
+  const size_t size = ws.getNPoints();
+  const auto maxChunk = static_cast<size_t>(std::numeric_limits<int>::max());
+  const std::array<signal_t *, 3> arrays{{ws.getSignalArray(),
+                                          ws.getErrorSquaredArray(),
+                                          ws.getNumEventsArray()}};
+  // The reductions are in flight at the same time
+  std::vector<std::vector<signal_t>> sums(arrays.size());
+  std::vector<Parallel::Request> requests;
+  for (size_t i = 0; i < arrays.size(); ++i) {
+    if (comm.rank() == 0)
+      sums[i].resize(size);
+    for (size_t offset = 0; offset < size; offset += maxChunk) {
+      const auto count = static_cast<int>(std::min(maxChunk, size - offset));
+      signal_t *out = comm.rank() == 0 ? sums[i].data() + offset : nullptr;
+      requests.emplace_back(Parallel::ireduce(comm, arrays[i] + offset, count,
+                                              out, std::plus<signal_t>(), 0));
+    }
+  }
+  Parallel::wait_all(requests.begin(), requests.end());
+  if (comm.rank() == 0) {
+    for (size_t i = 0; i < arrays.size(); ++i)
+      std::copy(sums[i].cbegin(), sums[i].cend(), arrays[i]);
+  }
+}
+
+} // namespace MDAlgorithms
+} // namespace Mantid
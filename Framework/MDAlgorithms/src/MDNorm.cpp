@@ -30,6 +30,8 @@
 #include "MantidKernel/UnitLabelTypes.h"
 #include "MantidKernel/VectorHelper.h"
 #include "MantidKernel/VisibleWhenProperty.h"
+#include "MantidMDAlgorithms/MDHistoWorkspaceReduction.h"
+#include "MantidParallel/Communicator.h"
 #include <boost/lexical_cast.hpp>
 
 namespace Mantid {
@@ -58,6 +60,15 @@ constexpr double energyToK = 8.0 * M_PI * M_PI *
 static bool abs_compare(double a, double b) {
   return (std::fabs(a) < std::fabs(b));
 }
+
+void checkStorageMode(
+    const std::map<std::string, Parallel::StorageMode> &storageModes,
+    const std::string &name) {
+  if (storageModes.count(name) &&
+      storageModes.at(name) != Parallel::StorageMode::Cloned)
+    throw std::runtime_error(name + " must have " +
+                             Parallel::toString(Parallel::StorageMode::Cloned));
+}
 } // namespace
 
 // Register the algorithm into the AlgorithmFactory
@@ -416,7 +427,42 @@ std::map<std::string, std::string> MDNorm::validateInputs() {
 //----------------------------------------------------------------------------------------------
 /** Execute the algorithm.
  */
-void MDNorm::exec() {
+void MDNorm::exec() { setOutputWorkspaces(binAndNormalize()); }
+
+/** Execute the algorithm on a distributed input. The experiment infos of the
+ * rank-local MD workspaces hold only the spectra of their rank, so every rank
+ * bins and normalizes its own part. The results are summed on the master rank,
+ * which is the only rank that has outputs.
+ */
+void MDNorm::execDistributed() {
+  auto outputDataWS = binAndNormalize();
+  reduceToMaster(communicator(), *outputDataWS);
+  reduceToMaster(communicator(), *m_normWS);
+  if (communicator().rank() == 0) {
+    outputDataWS->setStorageMode(Parallel::StorageMode::MasterOnly);
+    m_normWS->setStorageMode(Parallel::StorageMode::MasterOnly);
+    setOutputWorkspaces(outputDataWS);
+  }
+}
+
+Parallel::ExecutionMode MDNorm::getParallelExecutionMode(
+    const std::map<std::string, Parallel::StorageMode> &storageModes) const {
+  if (storageModes.count("TemporaryDataWorkspace") ||
+      storageModes.count("TemporaryNormalizationWorkspace"))
+    throw std::runtime_error("Using TemporaryDataWorkspace or "
+                             "TemporaryNormalizationWorkspace in an MPI run "
+                             "of " +
+                             name() + " is currently not supported.");
+  checkStorageMode(storageModes, "SolidAngleWorkspace");
+  checkStorageMode(storageModes, "FluxWorkspace");
+  return Parallel::getCorrespondingExecutionMode(
+      storageModes.at("InputWorkspace"));
+}
+
+/** Bin the input workspace and calculate the normalization
+ * @return The binned data. The normalization is stored in m_normWS.
+ */
+DataObjects::MDHistoWorkspace_sptr MDNorm::binAndNormalize() {
   convention = Kernel::ConfigService::Instance().getString("Q.convention");
   // symmetry operations
   std::string symOps = this->getProperty("SymmetryOperations");
@@ -473,8 +519,6 @@ void MDNorm::exec() {
   auto outputDataWS = binInputWS(symmetryOps);
 
   createNormalizationWS(*outputDataWS);
-  this->setProperty("OutputNormalizationWorkspace", m_normWS);
-  this->setProperty("OutputDataWorkspace", outputDataWS);
 
   m_numExptInfos = outputDataWS->getNumExperimentInfo();
   // loop over all experiment infos
@@ -502,6 +546,17 @@ void MDNorm::exec() {
     // if more than one experiment info, keep accumulating
     m_accumulate = true;
   }
+  return outputDataWS;
+}
+
+/** Set the binned data and normalization as outputs, together with their
+ * ratio
+ * @param outputDataWS :: The binned data
+ */
+void MDNorm::setOutputWorkspaces(
+    const DataObjects::MDHistoWorkspace_sptr &outputDataWS) {
+  this->setProperty("OutputNormalizationWorkspace", m_normWS);
+  this->setProperty("OutputDataWorkspace", outputDataWS);
 
   IAlgorithm_sptr divideMD = createChildAlgorithm("DivideMD", 0.99, 1.);
   divideMD->setProperty("LHSWorkspace", outputDataWS);
@@ -25,6 +25,8 @@
 #include "MantidMDAlgorithms/LoadMD.h"
 #include "MantidMDAlgorithms/SaveMD2.h"
 #include "MantidTestHelpers/MDEventsTestHelper.h"
+#include "MantidTestHelpers/ParallelAlgorithmCreation.h"
+#include "MantidTestHelpers/ParallelRunner.h"
 
 #include <cmath>
 
@@ -39,6 +41,36 @@ using namespace Mantid::Kernel;
 using namespace Mantid::MDAlgorithms;
 using Mantid::coord_t;
 
+namespace {
+void run_bin_distributed(const Mantid::Parallel::Communicator &comm) {
+  using namespace Mantid::Parallel;
+  // Every rank has 1000 events with a signal of 1
+  auto inWS = MDEventsTestHelper::makeMDEW<3>(10, 0.0, 10.0, 1);
+  inWS->setStorageMode(StorageMode::Distributed);
+  auto alg = ParallelTestHelpers::create<BinMD>(comm);
+  alg->setProperty("InputWorkspace",
+                   boost::dynamic_pointer_cast<IMDWorkspace>(inWS));
+  alg->setProperty("AxisAligned", true);
+  alg->setPropertyValue("AlignedDim0", "Axis0,0,10,5");
+  alg->setPropertyValue("AlignedDim1", "Axis1,0,10,5");
+  alg->setPropertyValue("AlignedDim2", "Axis2,0,10,5");
+  TS_ASSERT_THROWS_NOTHING(alg->execute());
+  IMDHistoWorkspace_sptr out = alg->getProperty("OutputWorkspace");
+  if (comm.rank() == 0) {
+    // The histograms of all ranks are summed on the master rank
+    if (comm.size() > 1)
+      TS_ASSERT_EQUALS(out->storageMode(), StorageMode::MasterOnly);
+    for (size_t i = 0; i < out->getNPoints(); ++i) {
+      TS_ASSERT_DELTA(out->getSignalAt(i), 8.0 * comm.size(), 1e-10);
+      TS_ASSERT_DELTA(out->getErrorAt(i) * out->getErrorAt(i),
+                      8.0 * comm.size(), 1e-10);
+    }
+  } else {
+    TS_ASSERT_EQUALS(out, nullptr);
+  }
+}
+} // namespace
+
 class BinMDTest : public CxxTest::TestSuite {
   GNU_DIAG_OFF_SUGGEST_OVERRIDE
 private:
@@ -989,6 +1021,10 @@ public:
         alg.execute(), std::runtime_error &);
   }
 
+  void test_distributed() {
+    ParallelTestHelpers::runParallel(run_bin_distributed);
+  }
+
   void test_normalization() {
 
     FrameworkManager::Instance().exec(
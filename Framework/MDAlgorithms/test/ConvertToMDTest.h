@@ -8,12 +8,21 @@
 #define MANTID_MD_CONVERT2_Q_NDANY_TEST_H_
 
 #include "MantidAPI/BoxController.h"
+#include "MantidDataObjects/Workspace2D.h"
+#include "MantidDataObjects/WorkspaceCreation.h"
 #include "MantidGeometry/Instrument/Goniometer.h"
+#include "MantidHistogramData/LinearGenerator.h"
+#include "MantidIndexing/IndexInfo.h"
+#include "MantidKernel/UnitFactory.h"
+#include "MantidMDAlgorithms/BinMD.h"
 #include "MantidMDAlgorithms/ConvToMDSelector.h"
 #include "MantidMDAlgorithms/ConvertToMD.h"
 #include "MantidMDAlgorithms/PreprocessDetectorsToMD.h"
+#include "MantidParallel/Collectives.h"
 #include "MantidTestHelpers/ComponentCreationHelper.h"
 #include "MantidTestHelpers/MDEventsTestHelper.h"
+#include "MantidTestHelpers/ParallelAlgorithmCreation.h"
+#include "MantidTestHelpers/ParallelRunner.h"
 #include "MantidTestHelpers/WorkspaceCreationHelper.h"
 
 #include "MantidAPI/AlgorithmManager.h"
@@ -53,6 +62,50 @@ Mantid::API::MatrixWorkspace_sptr createTestWorkspaces() {
 
   return ws;
 }
+
+void run_convert_distributed(const Parallel::Communicator &comm) {
+  using namespace Parallel;
+  using namespace HistogramData;
+  // 16 spectra with 10 bins of unit counts, split between the ranks
+  Indexing::IndexInfo indexInfo(16, StorageMode::Distributed, comm);
+  MatrixWorkspace_sptr inWS = create<Workspace2D>(
+      ComponentCreationHelper::createTestInstrumentRectangular(1, 4),
+      indexInfo,
+      Histogram(BinEdges(11, LinearGenerator(1000.0, 100.0)), Counts(10, 1.0)));
+  inWS->getAxis(0)->unit() = UnitFactory::Instance().create("TOF");
+
+  auto convert = ParallelTestHelpers::create<ConvertToMD>(comm);
+  convert->setProperty("InputWorkspace", inWS);
+  convert->setPropertyValue("QDimensions", "|Q|");
+  convert->setPropertyValue("dEAnalysisMode", "Elastic");
+  TS_ASSERT_THROWS_NOTHING(convert->execute());
+  IMDWorkspace_sptr mdWS = convert->getProperty("OutputWorkspace");
+  TS_ASSERT_EQUALS(mdWS->storageMode(), StorageMode::Distributed);
+
+  // The rank-local workspaces cover the extents of all ranks
+  const auto dimension = mdWS->getDimension(0);
+  std::vector<double> minima(comm.size());
+  std::vector<double> maxima(comm.size());
+  all_gather(comm, static_cast<double>(dimension->getMinimum()), minima);
+  all_gather(comm, static_cast<double>(dimension->getMaximum()), maxima);
+  for (int rank = 1; rank < comm.size(); ++rank) {
+    TS_ASSERT_EQUALS(minima[rank], minima[0]);
+    TS_ASSERT_EQUALS(maxima[rank], maxima[0]);
+  }
+
+  auto bin = ParallelTestHelpers::create<BinMD>(comm);
+  bin->setProperty("InputWorkspace", mdWS);
+  bin->setProperty("AxisAligned", true);
+  bin->setPropertyValue("AlignedDim0", "|Q|,0,10,1");
+  TS_ASSERT_THROWS_NOTHING(bin->execute());
+  IMDHistoWorkspace_sptr binned = bin->getProperty("OutputWorkspace");
+  if (comm.rank() == 0) {
+    // All counts end up in the master rank output
+    TS_ASSERT_DELTA(binned->getSignalAt(0), 160.0, 1e-10);
+  } else {
+    TS_ASSERT_EQUALS(binned, nullptr);
+  }
+}
 } // namespace
 
 class Convert2AnyTestHelper : public ConvertToMD {
@@ -206,6 +259,10 @@ public:
     AnalysisDataService::Instance().remove("WS3DmodQ");
   }
 
+  void test_distributed() {
+    ParallelTestHelpers::runParallel(run_convert_distributed);
+  }
+
   void testExecQ3D() {
     Mantid::API::MatrixWorkspace_sptr ws2D =
         AnalysisDataService::Instance().retrieveWS<MatrixWorkspace>(
@@ -191,6 +191,7 @@ public:
 protected:
   void getData(void *data);
   void getSlab(void *data, int start[], int size[]);
+  void getSlab64(void *data, const int64_t start[], const int64_t size[]);
 
 private:
   NXInfo m_info; ///< Holds the data info
@@ -424,6 +425,33 @@ public:
     getSlab(m_data.get(), start, m_size);
   }
 
+  /**  Read a block of a rank 1 dataset into a new buffer. Unlike load(), the
+   * indices are 64-bit, so that the block may lie anywhere in the dataset.
+   *   @param size :: The number of elements to read
+   *   @param start :: The index of the first element to read
+   *   @return The buffer holding the block. The internal buffer is unchanged.
+   */
+  boost::shared_array<T> loadBlock64(const int64_t size, const int64_t start) {
+    if (rank() != 1)
+      throw std::runtime_error("Cannot load a block of dataset " + path() +
+                               " which is not of rank 1");
+    if (size <= 0 || start < 0)
+      rangeError();
+    boost::shared_array<T> block;
+    try {
+      block.reset(new T[size]);
+    } catch (...) {
+      std::ostringstream ostr;
+      ostr << "Cannot allocate " << size * static_cast<int64_t>(sizeof(T))
+           << " bytes of memory to load the data";
+      throw std::runtime_error(ostr.str());
+    }
+    const int64_t starts[1] = {start};
+    const int64_t sizes[1] = {size};
+    getSlab64(block.get(), starts, sizes);
+    return block;
+  }
+
 private:
   /** Allocates memory for the data buffer
    *  @param n :: The number of elements to allocate.
@@ -20,6 +20,7 @@
 #include <boost/optional.hpp>
 #include <boost/shared_ptr.hpp>
 #include <climits>
+#include <functional>
 #include <nexus/NeXusFile.hpp>
 
 namespace Mantid {
@@ -77,10 +78,17 @@ public:
   int writeNexusProcessedDataEvent(
       const DataObjects::EventWorkspace_const_sptr &ws);
 
+  /// Fills numEvents events of the combined event arrays, starting with the
+  /// event firstEvent of the workspace. Arrays of fields not written are null.
+  using EventBlockPacker = std::function<void(
+      size_t firstEvent, size_t numEvents, double *tofs, float *weights,
+      float *errorSquareds, int64_t *pulsetimes)>;
+
   int writeNexusProcessedDataEventCombined(
       const DataObjects::EventWorkspace_const_sptr &ws,
-      std::vector<int64_t> &indices, double *tofs, float *weights,
-      float *errorSquareds, int64_t *pulsetimes, bool compress) const;
+      std::vector<int64_t> &indices, const EventBlockPacker &packer,
+      bool writeTOF, bool writePulsetime, bool writeWeight, bool writeError,
+      bool compress) const;
 
   int writeEventList(const DataObjects::EventList &el,
                      std::string group_name) const;
@@ -580,6 +580,23 @@ void NXDataSet::getSlab(void *data, int start[], int size[]) {
   NXclosedata(m_fileID);
 }
 
+/**  Wrapper to the NXgetslab64, which takes 64-bit indices.
+ *   @param data :: The pointer to the buffer accepting the data from the file.
+ *   @param start :: The array of starting indices to read in from the file.
+ *          The size of the array must be equal to the rank of the data.
+ *   @param size :: The array of numbers of data elements to read along each
+ *          dimension. The size of the array must be equal to the rank of the
+ *          data.
+ *   @throw runtime_error if the operation fails.
+ */
+void NXDataSet::getSlab64(void *data, const int64_t start[],
+                          const int64_t size[]) {
+  NXopendata(m_fileID, name().c_str());
+  if (NXgetslab64(m_fileID, data, start, size) != NX_OK)
+    throw std::runtime_error("Cannot read data slab from NeXus file");
+  NXclosedata(m_fileID);
+}
+
 //---------------------------------------------------------
 //          NXData methods
 //---------------------------------------------------------
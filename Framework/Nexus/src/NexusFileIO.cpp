@@ -6,6 +6,9 @@
 // SPDX - License - Identifier: GPL - 3.0 +
 // NexusFileIO
 // @author Ronald Fowler
+#include <algorithm>
+#include <array>
+#include <future>
 #include <sstream>
 #include <vector>
 
@@ -16,6 +19,7 @@
 #define NAME_MAX 260
 #endif /* _WIN32 */
 #include "MantidAPI/NumericAxis.h"
+#include "MantidDataObjects/ContiguousWorkspace2D.h"
 #include "MantidDataObjects/PeaksWorkspace.h"
 #include "MantidDataObjects/RebinnedOutput.h"
 #include "MantidDataObjects/TableWorkspace.h"
@@ -40,6 +44,110 @@ using namespace DataObjects;
 namespace {
 /// static logger
 Logger g_log("NexusFileIO");
+
+/// Target size in bytes of an HDF5 chunk of a 2D histogram dataset. Small
+/// enough for a chunk to stay in the default HDF5 chunk cache (1MB).
+constexpr size_t HISTOGRAM_CHUNK_BYTES = 256 * 1024;
+/// HDF5 chunks of a 2D histogram dataset packed and written at once
+constexpr int HISTOGRAM_CHUNKS_PER_BLOCK = 4;
+/// Events per HDF5 chunk of the combined event arrays (512kB of TOFs)
+constexpr int64_t EVENT_CHUNK_SIZE = 64 * 1024;
+/// Events packed and written at once: a whole number of chunks, so that
+/// every chunk but the last is written complete and compressed only once
+constexpr int64_t EVENT_BLOCK_SIZE = 16 * EVENT_CHUNK_SIZE;
+
+/// The number of rows in an HDF5 chunk of a 2D dataset of doubles
+int rowsPerChunk(const int numRows, const int rowLength) {
+  const auto rows = static_cast<int>(
+      HISTOGRAM_CHUNK_BYTES / (sizeof(double) * std::max(rowLength, 1)));
+  return std::max(1, std::min(rows, numRows));
+}
+
+/** Pack and write numBlocks blocks in order. Block k + 1 is packed by
+ * pack(k + 1, buffer) on a worker thread while block k is written by
+ * write(k, buffer) on the calling thread, so that copying the data out of the
+ * workspace overlaps with compression and I/O, which must stay on a single
+ * thread and in file order.
+ */
+template <class Buffer, class Pack, class Write>
+void pipelineBlocks(const size_t numBlocks, const Pack &pack,
+                    const Write &write) {
+  if (numBlocks == 0)
+    return;
+  std::array<Buffer, 2> buffers;
+  auto packing = std::async(std::launch::async, pack, size_t{0},
+                            std::ref(buffers[0]));
+  for (size_t block = 0; block < numBlocks; ++block) {
+    packing.get();
+    if (block + 1 < numBlocks)
+      packing = std::async(std::launch::async, pack, block + 1,
+                           std::ref(buffers[(block + 1) % 2]));
+    write(block, buffers[block % 2]);
+  }
+}
+
+/** Write the rows of the open 2D dataset of doubles in blocks of whole chunks.
+ * @param fileID :: the file handle
+ * @param numRows :: the number of rows of the dataset
+ * @param rowLength :: the length of each row
+ * @param chunkRows :: the number of rows in an HDF5 chunk of the dataset
+ * @param getRow :: returns the data of a row, given its index
+ */
+template <class GetRow>
+void writeRowBlocks(NXhandle fileID, const int numRows, const int rowLength,
+                    const int chunkRows, const GetRow &getRow) {
+  const int blockRows = chunkRows * HISTOGRAM_CHUNKS_PER_BLOCK;
+  const auto numBlocks = static_cast<size_t>((numRows + blockRows - 1) /
+                                             std::max(blockRows, 1));
+  const auto rowsInBlock = [&](const size_t block) {
+    return std::min(blockRows, numRows - static_cast<int>(block) * blockRows);
+  };
+  pipelineBlocks<std::vector<double>>(
+      numBlocks,
+      [&](const size_t block, std::vector<double> &buffer) {
+        const int first = static_cast<int>(block) * blockRows;
+        const int rows = rowsInBlock(block);
+        buffer.resize(static_cast<size_t>(rows) * rowLength);
+        for (int i = 0; i < rows; ++i) {
+          const double *row = getRow(first + i);
+          std::copy(row, row + rowLength,
+                    buffer.begin() + static_cast<size_t>(i) * rowLength);
+        }
+      },
+      [&](const size_t block, std::vector<double> &buffer) {
+        int start[2] = {static_cast<int>(block) * blockRows, 0};
+        int size[2] = {rowsInBlock(block), rowLength};
+        NXputslab(fileID, buffer.data(), start, size);
+      });
+}
+
+/** Write the rows of the open 2D dataset of doubles in blocks of whole chunks,
+ * straight from data, which holds them one after the other.
+ * @param fileID :: the file handle
+ * @param numRows :: the number of rows of the dataset
+ * @param rowLength :: the length of each row
+ * @param chunkRows :: the number of rows in an HDF5 chunk of the dataset
+ * @param data :: the values of all rows
+ */
+void writeConsecutiveRows(NXhandle fileID, const int numRows,
+                          const int rowLength, const int chunkRows,
+                          const double *data) {
+  const int blockRows = std::max(chunkRows * HISTOGRAM_CHUNKS_PER_BLOCK, 1);
+  for (int first = 0; first < numRows; first += blockRows) {
+    int start[2] = {first, 0};
+    int size[2] = {std::min(blockRows, numRows - first), rowLength};
+    NXputslab(fileID, data + static_cast<size_t>(first) * rowLength, start,
+              size);
+  }
+}
+
+/// The per-block buffers of the combined event arrays
+struct EventBlock {
+  std::vector<double> tofs;
+  std::vector<float> weights;
+  std::vector<float> errorSquareds;
+  std::vector<int64_t> pulsetimes;
+};
 } // namespace
 
 /// Empty default constructor
@@ -311,8 +419,18 @@ int NexusFileIO::writeNexusProcessedData2D(
   const size_t nHist = localworkspace->getNumberHistograms();
   if (nHist < 1)
     return (2);
-  const size_t nSpectBins = localworkspace->y(0).size();
+  // The rows of a contiguous workspace are read in place, without copying
+  // them out of its blocks, and are written straight from the blocks if
+  // none has been copied out and the spectra to write are consecutive
+  const auto contiguous =
+      boost::dynamic_pointer_cast<const ContiguousWorkspace2D>(localworkspace);
+  const size_t nSpectBins =
+      contiguous ? contiguous->rowLength() : localworkspace->y(0).size();
   const size_t nSpect = spec.size();
+  bool fromBlocks = contiguous && contiguous->allInBlocks() && nSpect > 0;
+  for (size_t i = 1; fromBlocks && i < nSpect; ++i)
+    fromBlocks = spec[i] == spec[i - 1] + 1;
+  const size_t firstValue = fromBlocks ? spec[0] * nSpectBins : 0;
   int dims_array[2] = {static_cast<int>(nSpect), static_cast<int>(nSpectBins)};
 
   // Set the axis labels and values
@@ -344,20 +462,25 @@ int NexusFileIO::writeNexusProcessedData2D(
     for (size_t i = 0; i < sAxis->length(); i++)
       axis2.push_back((*sAxis)(i));
 
-  int start[2] = {0, 0};
-  int asize[2] = {1, dims_array[1]};
+  // Chunks of several spectra, written a block of chunks at a time
+  int chunk[2] = {rowsPerChunk(dims_array[0], dims_array[1]), dims_array[1]};
 
   // -------------- Actually write the 2D data ----------------------------
   if (write2Ddata) {
     std::string name = "values";
     NXcompmakedata(fileID, name.c_str(), NX_FLOAT64, 2, dims_array,
-                   m_nexuscompression, asize);
+                   m_nexuscompression, chunk);
     NXopendata(fileID, name.c_str());
-    for (size_t i = 0; i < nSpect; i++) {
-      int s = spec[i];
-      NXputslab(fileID, localworkspace->y(s).rawData().data(), start, asize);
-      start[0]++;
-    }
+    if (fromBlocks)
+      writeConsecutiveRows(fileID, dims_array[0], dims_array[1], chunk[0],
+                           contiguous->blockY().data() + firstValue);
+    else
+      writeRowBlocks(fileID, dims_array[0], dims_array[1], chunk[0],
+                     [&](const int i) {
+                       return contiguous
+                                  ? contiguous->rowY(spec[i])
+                                  : localworkspace->y(spec[i]).rawData().data();
+                     });
     if (m_progress != nullptr)
       m_progress->reportIncrement(1, "Writing data");
     int signal = 1;
@@ -377,14 +500,18 @@ int NexusFileIO::writeNexusProcessedData2D(
     // error
     name = "errors";
     NXcompmakedata(fileID, name.c_str(), NX_FLOAT64, 2, dims_array,
-                   m_nexuscompression, asize);
+                   m_nexuscompression, chunk);
     NXopendata(fileID, name.c_str());
-    start[0] = 0;
-    for (size_t i = 0; i < nSpect; i++) {
-      int s = spec[i];
-      NXputslab(fileID, localworkspace->e(s).rawData().data(), start, asize);
-      start[0]++;
-    }
+    if (fromBlocks)
+      writeConsecutiveRows(fileID, dims_array[0], dims_array[1], chunk[0],
+                           contiguous->blockE().data() + firstValue);
+    else
+      writeRowBlocks(fileID, dims_array[0], dims_array[1], chunk[0],
+                     [&](const int i) {
+                       return contiguous
+                                  ? contiguous->rowE(spec[i])
+                                  : localworkspace->e(spec[i]).rawData().data();
+                     });
 
     if (m_progress != nullptr)
       m_progress->reportIncrement(1, "Writing data");
@@ -395,33 +522,31 @@ int NexusFileIO::writeNexusProcessedData2D(
           boost::dynamic_pointer_cast<const RebinnedOutput>(localworkspace);
       name = "frac_area";
       NXcompmakedata(fileID, name.c_str(), NX_FLOAT64, 2, dims_array,
-                     m_nexuscompression, asize);
+                     m_nexuscompression, chunk);
       NXopendata(fileID, name.c_str());
-      start[0] = 0;
-      for (size_t i = 0; i < nSpect; i++) {
-        int s = spec[i];
-        NXputslab(fileID, rebin_workspace->readF(s).data(), start, asize);
-        start[0]++;
-      }
+      writeRowBlocks(fileID, dims_array[0], dims_array[1], chunk[0],
+                     [&](const int i) {
+                       return rebin_workspace->readF(spec[i]).data();
+                     });
       if (m_progress != nullptr)
         m_progress->reportIncrement(1, "Writing data");
     }
 
-    // Potentially x error
-    if (localworkspace->hasDx(0)) {
+    // Potentially x error. Checked on a copy of the histogram, which does not
+    // take a spectrum out of the blocks of a contiguous workspace.
+    if (localworkspace->histogram(0).sharedDx()) {
       dims_array[0] = static_cast<int>(nSpect);
       dims_array[1] = static_cast<int>(localworkspace->dx(0).size());
+      chunk[0] = rowsPerChunk(dims_array[0], dims_array[1]);
+      chunk[1] = dims_array[1];
       std::string dxErrorName = "xerrors";
       NXcompmakedata(fileID, dxErrorName.c_str(), NX_FLOAT64, 2, dims_array,
-                     m_nexuscompression, asize);
+                     m_nexuscompression, chunk);
       NXopendata(fileID, dxErrorName.c_str());
-      start[0] = 0;
-      asize[1] = dims_array[1];
-      for (size_t i = 0; i < nSpect; i++) {
-        int s = spec[i];
-        NXputslab(fileID, localworkspace->dx(s).rawData().data(), start, asize);
-        start[0]++;
-      }
+      writeRowBlocks(fileID, dims_array[0], dims_array[1], chunk[0],
+                     [&](const int i) {
+                       return localworkspace->dx(spec[i]).rawData().data();
+                     });
     }
 
     NXclosedata(fileID);
@@ -439,12 +564,13 @@ int NexusFileIO::writeNexusProcessedData2D(
     dims_array[1] = static_cast<int>(localworkspace->x(0).size());
     NXmakedata(fileID, "axis1", NX_FLOAT64, 2, dims_array);
     NXopendata(fileID, "axis1");
-    start[0] = 0;
-    asize[1] = dims_array[1];
-    for (size_t i = 0; i < nSpect; i++) {
-      NXputslab(fileID, localworkspace->x(i).rawData().data(), start, asize);
-      start[0]++;
-    }
+    writeRowBlocks(fileID, dims_array[0], dims_array[1],
+                   rowsPerChunk(dims_array[0], dims_array[1]),
+                   [&](const int i) {
+                     return localworkspace->x(static_cast<size_t>(i))
+                         .rawData()
+                         .data();
+                   });
   }
 
   std::string dist = (localworkspace->isDistribution()) ? "1" : "0";
@@ -728,20 +854,25 @@ int NexusFileIO::writeNexusTableWorkspace(
 }
 
 //-------------------------------------------------------------------------------------
-/** Write out a combined chunk of event data
+/** Write out the event data of a workspace as combined arrays of events.
+ * The arrays are written in blocks of whole HDF5 chunks: each block is
+ * packed by the given packer on a worker thread while the previous block is
+ * compressed and written, so the full arrays are never held in memory.
  *
  * @param ws :: an EventWorkspace
  * @param indices :: array of event list indexes
- * @param tofs :: array of TOFs
- * @param weights :: array of event weights
- * @param errorSquareds :: array of event squared errors
- * @param pulsetimes :: array of pulsetimes
+ * @param packer :: fills a block of the combined event arrays
+ * @param writeTOF :: if true, write the TOF values
+ * @param writePulsetime :: if true, write the pulse time values
+ * @param writeWeight :: if true, write the event weights
+ * @param writeError :: if true, write the squared errors
  * @param compress :: if true, compress the entry
  */
 int NexusFileIO::writeNexusProcessedDataEventCombined(
     const DataObjects::EventWorkspace_const_sptr &ws,
-    std::vector<int64_t> &indices, double *tofs, float *weights,
-    float *errorSquareds, int64_t *pulsetimes, bool compress) const {
+    std::vector<int64_t> &indices, const EventBlockPacker &packer,
+    bool writeTOF, bool writePulsetime, bool writeWeight, bool writeError,
+    bool compress) const {
   NXopengroup(fileID, "event_workspace", "NXdata");
 
   // The array of indices for each event list #
@@ -763,18 +894,71 @@ int NexusFileIO::writeNexusProcessedDataEventCombined(
     NXclosedata(fileID);
   }
 
-  // Write out each field
-  dims_array[0] = static_cast<int>(
-      indices.back()); // TODO big truncation error! This is the # of events
-  if (tofs)
-    NXwritedata("tof", NX_FLOAT64, 1, dims_array, tofs, compress);
-  if (pulsetimes)
-    NXwritedata("pulsetime", NX_INT64, 1, dims_array, pulsetimes, compress);
-  if (weights)
-    NXwritedata("weight", NX_FLOAT32, 1, dims_array, weights, compress);
-  if (errorSquareds)
-    NXwritedata("error_squared", NX_FLOAT32, 1, dims_array, errorSquareds,
-                compress);
+  // Create each field, sized for the total # of events
+  const int64_t numEvents = indices.empty() ? 0 : indices.back();
+  int64_t dims[1] = {numEvents};
+  int64_t chunk[1] = {
+      std::max(int64_t{1}, std::min(numEvents, EVENT_CHUNK_SIZE))};
+  // Events compress well but slowly: favour speed over ratio
+  const int compression =
+      m_nexuscompression == NX_COMP_NONE ? NX_COMP_NONE : NX_COMP_LZW_LVL1;
+  // HDF5 cannot chunk an empty dataset, so one is never compressed
+  const auto makeField = [&](const char *name, const int datatype) {
+    if (compress && numEvents > 0)
+      NXcompmakedata64(fileID, name, datatype, 1, dims, compression, chunk);
+    else
+      NXmakedata64(fileID, name, datatype, 1, dims);
+  };
+  if (writeTOF)
+    makeField("tof", NX_FLOAT64);
+  if (writePulsetime)
+    makeField("pulsetime", NX_INT64);
+  if (writeWeight)
+    makeField("weight", NX_FLOAT32);
+  if (writeError)
+    makeField("error_squared", NX_FLOAT32);
+
+  const auto eventsInBlock = [&](const size_t block) {
+    return std::min(EVENT_BLOCK_SIZE,
+                    numEvents - static_cast<int64_t>(block) * EVENT_BLOCK_SIZE);
+  };
+  const auto pack = [&](const size_t block, EventBlock &buffer) {
+    const auto size = static_cast<size_t>(eventsInBlock(block));
+    if (writeTOF)
+      buffer.tofs.resize(size);
+    if (writePulsetime)
+      buffer.pulsetimes.resize(size);
+    if (writeWeight)
+      buffer.weights.resize(size);
+    if (writeError)
+      buffer.errorSquareds.resize(size);
+    packer(block * static_cast<size_t>(EVENT_BLOCK_SIZE), size,
+           writeTOF ? buffer.tofs.data() : nullptr,
+           writeWeight ? buffer.weights.data() : nullptr,
+           writeError ? buffer.errorSquareds.data() : nullptr,
+           writePulsetime ? buffer.pulsetimes.data() : nullptr);
+  };
+  const auto write = [&](const size_t block, EventBlock &buffer) {
+    int64_t start[1] = {static_cast<int64_t>(block) * EVENT_BLOCK_SIZE};
+    int64_t size[1] = {eventsInBlock(block)};
+    const auto putSlab = [&](const char *name, const void *data) {
+      NXopendata(fileID, name);
+      NXputslab64(fileID, data, start, size);
+      NXclosedata(fileID);
+    };
+    if (writeTOF)
+      putSlab("tof", buffer.tofs.data());
+    if (writePulsetime)
+      putSlab("pulsetime", buffer.pulsetimes.data());
+    if (writeWeight)
+      putSlab("weight", buffer.weights.data());
+    if (writeError)
+      putSlab("error_squared", buffer.errorSquareds.data());
+  };
+  pipelineBlocks<EventBlock>(
+      static_cast<size_t>((numEvents + EVENT_BLOCK_SIZE - 1) /
+                          EVENT_BLOCK_SIZE),
+      pack, write);
 
   // Close up the overall group
   NXstatus status = NXclosegroup(fileID);
@@ -15,6 +15,11 @@
 #include <boost/mpi/collectives.hpp>
 #endif
 
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
 namespace Mantid {
 namespace Parallel {
 
@@ -22,6 +27,14 @@ namespace Parallel {
   non-MPI builds an equivalent implementation with reduced functionality is
   provided.
 
+  The non-blocking collectives (ireduce, iall_reduce and iall_gatherv) return
+  a Request that must be waited on before the output is used, and the input
+  and output buffers must stay alive until then. Every rank must start
+  collectives in the same order. With the ThreadingBackend the collective runs
+  in a separate thread, overlapping with the computation of the caller. Boost
+  MPI provides no non-blocking collectives, so in MPI runs they complete before
+  returning.
+
   @author Simon Heybrock
   @date 2017
 */
@@ -73,6 +86,141 @@ void all_to_all(const Communicator &comm, const std::vector<T> &in_values,
     comm.send(rank, tag, in_values[rank]);
   wait_all(requests.begin(), requests.end());
 }
+
+/// Number of elements per message in the collectives on arrays. Messages of
+/// this size let the root combine one chunk while receiving the next.
+constexpr int chunkSize = 16384;
+
+template <typename T>
+void send_chunks(const Communicator &comm, int dest, int tag, const T *values,
+                 int n) {
+  std::vector<Request> requests;
+  for (int offset = 0; offset < n; offset += chunkSize)
+    requests.emplace_back(comm.isend(dest, tag, values + offset,
+                                     std::min(chunkSize, n - offset)));
+  wait_all(requests.begin(), requests.end());
+}
+
+template <typename T>
+void recv_chunks(const Communicator &comm, int source, int tag, T *values,
+                 int n) {
+  for (int offset = 0; offset < n; offset += chunkSize)
+    comm.recv(source, tag, values + offset, std::min(chunkSize, n - offset));
+}
+
+template <typename T, typename Op>
+void reduce(const Communicator &comm, const T *in_values, int n,
+            T *out_values, Op op, int root, int tag = 0) {
+  if (comm.rank() != root) {
+    send_chunks(comm, root, tag, in_values, n);
+    return;
+  }
+  // Values are combined in the order of the ranks, so op need not be
+  // commutative. The next chunk of a rank is received while the current one
+  // is combined.
+  const int bufferSize = std::min(chunkSize, n);
+  std::vector<T> buffer(2 * static_cast<size_t>(bufferSize));
+  for (int rank = 0; rank < comm.size(); ++rank) {
+    if (rank == root) {
+      if (rank == 0)
+        std::copy(in_values, in_values + n, out_values);
+      else
+        std::transform(out_values, out_values + n, in_values, out_values, op);
+      continue;
+    }
+    if (n == 0)
+      continue;
+    T *current = buffer.data();
+    T *next = current + bufferSize;
+    Request pending = comm.irecv(rank, tag, current, bufferSize);
+    for (int offset = 0; offset < n; offset += chunkSize) {
+      const int count = std::min(chunkSize, n - offset);
+      pending.wait();
+      if (offset + chunkSize < n)
+        pending = comm.irecv(rank, tag, next,
+                             std::min(chunkSize, n - offset - chunkSize));
+      if (rank == 0)
+        std::copy(current, current + count, out_values + offset);
+      else
+        std::transform(out_values + offset, out_values + offset + count,
+                       current, out_values + offset, op);
+      std::swap(current, next);
+    }
+  }
+}
+
+template <typename T, typename Op>
+void reduce(const Communicator &comm, const T &in_value, T &out_value, Op op,
+            int root) {
+  reduce(comm, &in_value, 1, &out_value, op, root);
+}
+
+template <typename T>
+void broadcast(const Communicator &comm, T *values, int n, int root,
+               int tag = 0) {
+  if (comm.rank() == root) {
+    std::vector<Request> requests;
+    for (int rank = 0; rank < comm.size(); ++rank) {
+      if (rank == root)
+        continue;
+      for (int offset = 0; offset < n; offset += chunkSize)
+        requests.emplace_back(comm.isend(rank, tag, values + offset,
+                                         std::min(chunkSize, n - offset)));
+    }
+    wait_all(requests.begin(), requests.end());
+  } else {
+    recv_chunks(comm, root, tag, values, n);
+  }
+}
+
+template <typename T>
+void broadcast(const Communicator &comm, T &value, int root) {
+  broadcast(comm, &value, 1, root);
+}
+
+template <typename T, typename Op>
+void all_reduce(const Communicator &comm, const T *in_values, int n,
+                T *out_values, Op op, int tag = 0) {
+  reduce(comm, in_values, n, out_values, op, 0, tag);
+  broadcast(comm, out_values, n, 0, tag);
+}
+
+template <typename T, typename Op>
+void all_reduce(const Communicator &comm, const T &in_value, T &out_value,
+                Op op) {
+  all_reduce(comm, &in_value, 1, &out_value, op);
+}
+
+template <typename T>
+void all_gatherv(const Communicator &comm, const T *in_values, int n,
+                 std::vector<T> &out_values, int tag = 0) {
+  std::vector<int> sizes(comm.size());
+  sizes[comm.rank()] = n;
+  std::vector<Request> requests;
+  for (int rank = 0; rank < comm.size(); ++rank) {
+    if (rank == comm.rank())
+      continue;
+    requests.emplace_back(comm.irecv(rank, tag, sizes[rank]));
+    comm.send(rank, tag, n);
+  }
+  wait_all(requests.begin(), requests.end());
+
+  std::vector<int> offsets(comm.size(), 0);
+  std::partial_sum(sizes.begin(), sizes.end() - 1, offsets.begin() + 1);
+  out_values.resize(static_cast<size_t>(offsets.back() + sizes.back()));
+  std::copy(in_values, in_values + n, out_values.data() + offsets[comm.rank()]);
+  requests.clear();
+  for (int rank = 0; rank < comm.size(); ++rank) {
+    if (rank == comm.rank())
+      continue;
+    if (sizes[rank] > 0)
+      requests.emplace_back(comm.irecv(
+          rank, tag, out_values.data() + offsets[rank], sizes[rank]));
+    if (n > 0)
+      requests.emplace_back(comm.isend(rank, tag, in_values, n));
+  }
+  wait_all(requests.begin(), requests.end());
+}
 } // namespace detail
 
 template <typename... T> void gather(const Communicator &comm, T &&... args) {
@@ -101,6 +249,88 @@ void all_to_all(const Communicator &comm, T &&... args) {
   detail::all_to_all(comm, std::forward<T>(args)...);
 }
 
+template <typename... T> void reduce(const Communicator &comm, T &&... args) {
+#ifdef MPI_EXPERIMENTAL
+  if (!comm.hasBackend())
+    return boost::mpi::reduce(comm, std::forward<T>(args)...);
+#endif
+  detail::reduce(comm, std::forward<T>(args)...);
+}
+
+template <typename... T>
+void broadcast(const Communicator &comm, T &&... args) {
+#ifdef MPI_EXPERIMENTAL
+  if (!comm.hasBackend())
+    return boost::mpi::broadcast(comm, std::forward<T>(args)...);
+#endif
+  detail::broadcast(comm, std::forward<T>(args)...);
+}
+
+template <typename... T>
+void all_reduce(const Communicator &comm, T &&... args) {
+#ifdef MPI_EXPERIMENTAL
+  if (!comm.hasBackend())
+    return boost::mpi::all_reduce(comm, std::forward<T>(args)...);
+#endif
+  detail::all_reduce(comm, std::forward<T>(args)...);
+}
+
+/// Gathers arrays of different lengths from all ranks, concatenated in the
+/// order of the ranks, on every rank.
+template <typename T>
+void all_gatherv(const Communicator &comm, const std::vector<T> &in_values,
+                 std::vector<T> &out_values) {
+  detail::all_gatherv(comm, in_values.data(),
+                      static_cast<int>(in_values.size()), out_values);
+}
+
+template <typename T, typename Op>
+Request ireduce(const Communicator &comm, const T *in_values, int n,
+                T *out_values, Op op, int root) {
+#ifdef MPI_EXPERIMENTAL
+  if (!comm.hasBackend()) {
+    boost::mpi::reduce(comm, in_values, n, out_values, op, root);
+    return Request{};
+  }
+#endif
+  const int tag = comm.backend().nextCollectiveTag(comm.rank());
+  return comm.backend().makeRequest([=]() {
+    detail::reduce(comm, in_values, n, out_values, op, root, tag);
+  });
+}
+
+template <typename T, typename Op>
+Request iall_reduce(const Communicator &comm, const T *in_values, int n,
+                    T *out_values, Op op) {
+#ifdef MPI_EXPERIMENTAL
+  if (!comm.hasBackend()) {
+    boost::mpi::all_reduce(comm, in_values, n, out_values, op);
+    return Request{};
+  }
+#endif
+  const int tag = comm.backend().nextCollectiveTag(comm.rank());
+  return comm.backend().makeRequest([=]() {
+    detail::all_reduce(comm, in_values, n, out_values, op, tag);
+  });
+}
+
+template <typename T>
+Request iall_gatherv(const Communicator &comm, const std::vector<T> &in_values,
+                     std::vector<T> &out_values) {
+#ifdef MPI_EXPERIMENTAL
+  if (!comm.hasBackend()) {
+    all_gatherv(comm, in_values, out_values);
+    return Request{};
+  }
+#endif
+  const int tag = comm.backend().nextCollectiveTag(comm.rank());
+  const T *in = in_values.data();
+  const auto n = static_cast<int>(in_values.size());
+  std::vector<T> *out = &out_values;
+  return comm.backend().makeRequest(
+      [=]() { detail::all_gatherv(comm, in, n, *out, tag); });
+}
+
 } // namespace Parallel
 } // namespace Mantid
 
@@ -32,6 +32,9 @@ public:
 #ifdef MPI_EXPERIMENTAL
   Request(const boost::mpi::request &request);
 #endif
+  ~Request();
+  Request(Request &&) = default;
+  Request &operator=(Request &&other);
 
   void wait();
 
@@ -47,7 +50,7 @@ private:
   boost::mpi::request m_request;
 #endif
   std::thread m_thread;
-  const bool m_threadingBackend{false};
+  bool m_threadingBackend{false};
   // For accessing constructor based on callable.
   friend class detail::ThreadingBackend;
 };
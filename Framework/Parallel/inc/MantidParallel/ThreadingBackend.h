@@ -58,11 +58,15 @@ public:
   template <typename T>
   Request irecv(int dest, int source, int tag, T *data, const size_t count);
 
+  int nextCollectiveTag(const int rank);
+  template <class Function> Request makeRequest(Function &&f);
+
 private:
   int m_size{1};
   std::map<std::tuple<int, int, int>,
            std::vector<std::unique_ptr<std::stringbuf>>>
       m_buffer;
+  std::map<int, int> m_collectiveTags;
   std::mutex m_mutex;
 };
 
@@ -171,6 +175,11 @@ Request ThreadingBackend::irecv(int dest, int source, int tag, T *data,
   });
 }
 
+/// Returns a Request that runs f in a separate thread until it is waited on.
+template <class Function> Request ThreadingBackend::makeRequest(Function &&f) {
+  return Request(std::forward<Function>(f));
+}
+
 } // namespace detail
 } // namespace Parallel
 } // namespace Mantid
@@ -10,6 +10,8 @@
 #include <boost/mpi/status.hpp>
 #endif
 
+#include <utility>
+
 namespace Mantid {
 namespace Parallel {
 
@@ -17,6 +19,27 @@ namespace Parallel {
 Request::Request(const boost::mpi::request &request) : m_request(request) {}
 #endif
 
+/// Joins the thread of the threading backend if the request was not waited on,
+/// e.g. when unwinding after an exception
+Request::~Request() {
+  if (m_thread.joinable())
+    m_thread.join();
+}
+
+/// Move assignment. A thread still running for this request is joined first.
+Request &Request::operator=(Request &&other) {
+  if (this == &other)
+    return *this;
+  if (m_thread.joinable())
+    m_thread.join();
+#ifdef MPI_EXPERIMENTAL
+  m_request = std::move(other.m_request);
+#endif
+  m_thread = std::move(other.m_thread);
+  m_threadingBackend = other.m_threadingBackend;
+  return *this;
+}
+
 void Request::wait() {
   // Not returning a status since it would usually not get initialized. See
   // http://mpi-forum.org/docs/mpi-1.1/mpi-11-html/node35.html#Node35.
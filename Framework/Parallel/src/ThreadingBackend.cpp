@@ -10,10 +10,25 @@ namespace Mantid {
 namespace Parallel {
 namespace detail {
 
+namespace {
+/// Tags of non-blocking collectives start here, well above the tags used for
+/// point-to-point messages.
+constexpr int COLLECTIVE_TAG_BASE = 1 << 24;
+} // namespace
+
 ThreadingBackend::ThreadingBackend(const int size) : m_size(size) {}
 
 int ThreadingBackend::size() const { return m_size; }
 
+/** Returns the tag for the next non-blocking collective started by rank. All
+ * ranks start collectives in the same order, so the tags match between ranks.
+ * Distinct tags keep the messages of collectives that run concurrently in
+ * separate threads apart. */
+int ThreadingBackend::nextCollectiveTag(const int rank) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return COLLECTIVE_TAG_BASE + m_collectiveTags[rank]++;
+}
+
 } // namespace detail
 } // namespace Parallel
 } // namespace Mantid
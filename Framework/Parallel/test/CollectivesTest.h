@@ -12,6 +12,10 @@
 #include "MantidParallel/Collectives.h"
 #include "MantidTestHelpers/ParallelRunner.h"
 
+#include <cmath>
+#include <functional>
+#include <numeric>
+
 using namespace Mantid;
 using namespace Parallel;
 
@@ -67,6 +71,136 @@ void run_all_to_all(const Communicator &comm) {
     TS_ASSERT_EQUALS(result[i], 1000 * i + comm.rank());
   }
 }
+
+void run_reduce(const Communicator &comm) {
+  int root = std::min(comm.size() - 1, 2);
+  int value = comm.rank() + 1;
+  int result = -1;
+  TS_ASSERT_THROWS_NOTHING(
+      Parallel::reduce(comm, value, result, std::plus<int>(), root));
+  if (comm.rank() == root) {
+    TS_ASSERT_EQUALS(result, comm.size() * (comm.size() + 1) / 2);
+  } else {
+    TS_ASSERT_EQUALS(result, -1);
+  }
+}
+
+// Spans several chunks, the last of which is partially filled
+constexpr int LARGE_SIZE = 3 * detail::chunkSize + 17;
+
+void run_reduce_array(const Communicator &comm) {
+  int root = std::min(comm.size() - 1, 1);
+  std::vector<double> data(LARGE_SIZE);
+  std::iota(data.begin(), data.end(), static_cast<double>(comm.rank()));
+  std::vector<double> result(LARGE_SIZE, 0.0);
+  TS_ASSERT_THROWS_NOTHING(Parallel::reduce(comm, data.data(), LARGE_SIZE,
+                                            result.data(), std::plus<double>(),
+                                            root));
+  if (comm.rank() == root) {
+    const double rankSum = comm.size() * (comm.size() - 1) / 2;
+    for (int i = 0; i < LARGE_SIZE; ++i)
+      TS_ASSERT_EQUALS(result[i], comm.size() * i + rankSum);
+  }
+}
+
+void run_reduce_non_commutative(const Communicator &comm) {
+  // Subtraction combines the values in the order of the ranks
+  const int root = comm.size() - 1;
+  int value = comm.rank() == 0 ? 100 : comm.rank();
+  int result = 0;
+  Parallel::reduce(comm, value, result, std::minus<int>(), root);
+  if (comm.rank() == root)
+    TS_ASSERT_EQUALS(result, 100 - comm.size() * (comm.size() - 1) / 2);
+}
+
+void run_broadcast(const Communicator &comm) {
+  int root = std::min(comm.size() - 1, 2);
+  std::vector<int> data(LARGE_SIZE, comm.rank() == root ? 42 : 0);
+  TS_ASSERT_THROWS_NOTHING(
+      Parallel::broadcast(comm, data.data(), LARGE_SIZE, root));
+  TS_ASSERT_EQUALS(std::count(data.begin(), data.end(), 42), LARGE_SIZE);
+}
+
+void run_all_reduce(const Communicator &comm) {
+  std::vector<int> data(LARGE_SIZE, comm.rank() + 1);
+  std::vector<int> result(LARGE_SIZE);
+  TS_ASSERT_THROWS_NOTHING(Parallel::all_reduce(
+      comm, data.data(), LARGE_SIZE, result.data(), std::plus<int>()));
+  const int expected = comm.size() * (comm.size() + 1) / 2;
+  TS_ASSERT_EQUALS(std::count(result.begin(), result.end(), expected),
+                   LARGE_SIZE);
+  int maximum = 0;
+  Parallel::all_reduce(comm, comm.rank(), maximum,
+                       [](int a, int b) { return std::max(a, b); });
+  TS_ASSERT_EQUALS(maximum, comm.size() - 1);
+}
+
+void run_all_gatherv(const Communicator &comm) {
+  // Rank r contributes r copies of r
+  std::vector<int> data(comm.rank(), comm.rank());
+  std::vector<int> result;
+  TS_ASSERT_THROWS_NOTHING(Parallel::all_gatherv(comm, data, result));
+  std::vector<int> expected;
+  for (int rank = 0; rank < comm.size(); ++rank)
+    expected.insert(expected.end(), rank, rank);
+  TS_ASSERT_EQUALS(result, expected);
+}
+
+void run_ireduce_overlapping(const Communicator &comm) {
+  std::vector<double> data(LARGE_SIZE, 1.0);
+  std::vector<double> sums(LARGE_SIZE, 0.0);
+  std::vector<double> maxima(LARGE_SIZE, 0.0);
+  std::vector<int> gathered;
+  std::vector<Request> requests;
+  requests.emplace_back(Parallel::ireduce(comm, data.data(), LARGE_SIZE,
+                                          sums.data(), std::plus<double>(), 0));
+  requests.emplace_back(Parallel::iall_reduce(
+      comm, data.data(), LARGE_SIZE, maxima.data(),
+      [](double a, double b) { return std::max(a, b); }));
+  std::vector<int> ranks(1, comm.rank());
+  requests.emplace_back(Parallel::iall_gatherv(comm, ranks, gathered));
+  // Blocking collectives can run while the others are in flight
+  std::vector<int> result;
+  Parallel::all_gather(comm, comm.rank(), result);
+  TS_ASSERT_EQUALS(result.size(), comm.size());
+  TS_ASSERT_THROWS_NOTHING(wait_all(requests.begin(), requests.end()));
+
+  if (comm.rank() == 0)
+    TS_ASSERT_EQUALS(std::count(sums.begin(), sums.end(),
+                                static_cast<double>(comm.size())),
+                     LARGE_SIZE);
+  TS_ASSERT_EQUALS(std::count(maxima.begin(), maxima.end(), 1.0), LARGE_SIZE);
+  TS_ASSERT_EQUALS(gathered.size(), comm.size());
+  for (int rank = 0; rank < comm.size(); ++rank)
+    TS_ASSERT_EQUALS(gathered[rank], rank);
+}
+
+/// Stands in for the computation that communication overlaps with
+double compute(const std::vector<double> &data) {
+  double sum = 0.0;
+  for (int repeat = 0; repeat < 20; ++repeat)
+    for (const auto value : data)
+      sum += std::sqrt(value + repeat);
+  return sum;
+}
+
+void run_reduce_then_compute(const Communicator &comm,
+                             const std::vector<double> &data) {
+  std::vector<double> result(data.size());
+  Parallel::reduce(comm, data.data(), static_cast<int>(data.size()),
+                   result.data(), std::plus<double>(), 0);
+  TS_ASSERT(compute(data) > 0.0);
+}
+
+void run_ireduce_overlapping_compute(const Communicator &comm,
+                                     const std::vector<double> &data) {
+  std::vector<double> result(data.size());
+  auto request =
+      Parallel::ireduce(comm, data.data(), static_cast<int>(data.size()),
+                        result.data(), std::plus<double>(), 0);
+  TS_ASSERT(compute(data) > 0.0);
+  request.wait();
+}
 } // namespace
 
 class CollectivesTest : public CxxTest::TestSuite {
@@ -85,6 +219,52 @@ public:
   void test_all_gather() { ParallelTestHelpers::runParallel(run_all_gather); }
 
   void test_all_to_all() { ParallelTestHelpers::runParallel(run_all_to_all); }
+
+  void test_reduce() { ParallelTestHelpers::runParallel(run_reduce); }
+
+  void test_reduce_array() {
+    ParallelTestHelpers::runParallel(run_reduce_array);
+  }
+
+  void test_reduce_non_commutative() {
+    ParallelTestHelpers::runParallel(run_reduce_non_commutative);
+  }
+
+  void test_broadcast() { ParallelTestHelpers::runParallel(run_broadcast); }
+
+  void test_all_reduce() { ParallelTestHelpers::runParallel(run_all_reduce); }
+
+  void test_all_gatherv() {
+    ParallelTestHelpers::runParallel(run_all_gatherv);
+  }
+
+  void test_nonblocking_collectives_overlap() {
+    ParallelTestHelpers::runParallel(run_ireduce_overlapping);
+  }
+};
+
+class CollectivesTestPerformance : public CxxTest::TestSuite {
+public:
+  static CollectivesTestPerformance *createSuite() {
+    return new CollectivesTestPerformance();
+  }
+  static void destroySuite(CollectivesTestPerformance *suite) { delete suite; }
+
+  CollectivesTestPerformance() : m_runner(4), m_data(1000000, 1.0) {}
+
+  // Compare the two to see how much of the reduction is hidden behind the
+  // computation
+  void test_reduce_then_compute() {
+    m_runner.run(run_reduce_then_compute, m_data);
+  }
+
+  void test_ireduce_overlapping_compute() {
+    m_runner.run(run_ireduce_overlapping_compute, m_data);
+  }
+
+private:
+  ParallelTestHelpers::ParallelRunner m_runner;
+  const std::vector<double> m_data;
 };
 
 #endif /* MANTID_PARALLEL_COLLECTIVESTEST_H_ */
@@ -66,6 +66,22 @@ void isend_recv(const Communicator &comm) {
   TS_ASSERT_THROWS_NOTHING(request.wait());
 }
 
+void isend_recv_without_wait(const Communicator &comm) {
+  int64_t data = 123456789 + comm.rank();
+  int dest = (comm.rank() + 1) % comm.size();
+  int src = (comm.rank() + comm.size() - 1) % comm.size();
+  int tag = 123;
+  int64_t result;
+  {
+    // A request that is overwritten or destroyed without a wait must not
+    // terminate the process
+    auto request = comm.isend(dest, tag, data);
+    TS_ASSERT_THROWS_NOTHING(comm.recv(src, tag, result));
+    request = comm.isend(dest, tag, data);
+    TS_ASSERT_THROWS_NOTHING(comm.recv(src, tag, result));
+  }
+}
+
 void send_irecv(const Communicator &comm) {
   int64_t data = 123456789 + comm.rank();
   int dest = (comm.rank() + 1) % comm.size();
@@ -124,6 +140,9 @@ public:
   void test_send_irecv() { runParallel(send_irecv); }
 
   void test_isend_irecv() { runParallel(isend_irecv); }
+  void test_isend_recv_without_wait() {
+    runParallel(isend_recv_without_wait);
+  }
 };
 
 #endif /* MANTID_PARALLEL_COMMUNICATORTEST_H_ */
@@ -31,6 +31,15 @@ public:
     ThreadingBackend backend{2};
     TS_ASSERT_EQUALS(backend.size(), 2);
   }
+
+  void test_collective_tags_match_between_ranks() {
+    ThreadingBackend backend{2};
+    const int first = backend.nextCollectiveTag(0);
+    const int second = backend.nextCollectiveTag(0);
+    TS_ASSERT_DIFFERS(first, second);
+    TS_ASSERT_EQUALS(backend.nextCollectiveTag(1), first);
+    TS_ASSERT_EQUALS(backend.nextCollectiveTag(1), second);
+  }
 };
 
 #endif /* MANTID_PARALLEL_THREADINGBACKENDTEST_H_ */
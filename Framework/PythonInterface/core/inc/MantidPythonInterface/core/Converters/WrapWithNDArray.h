@@ -9,6 +9,7 @@
 
 #include "MantidKernel/System.h"
 #include <boost/python/detail/prefix.hpp>
+#include <boost/shared_ptr.hpp>
 #include <vector>
 
 namespace Mantid {
@@ -28,6 +29,25 @@ PyObject *wrapWithNDArray(const ElementType *, const int ndims,
                           const OwnershipMode oMode = OwnershipMode::Cpp);
 } // namespace Impl
 
+/**
+ * Wrap an existing, possibly strided, array in a read-only numpy array
+ * without copying. The base object of the numpy array holds a shared pointer
+ * to the owner of the data, which keeps the data alive for as long as the
+ * numpy array or any view of it exists.
+ * @param data :: A pointer to the first element, may be null if the array is
+ * empty
+ * @param ndims :: The number of dimensions
+ * @param dims :: The length of each dimension
+ * @param strides :: The number of bytes between consecutive elements in each
+ * dimension, or null if the array is C-contiguous
+ * @param owner :: The owner of the data
+ * @return A new reference to a read-only numpy array
+ */
+template <typename ElementType>
+PyObject *wrapReadOnlyWithOwner(const ElementType *data, const int ndims,
+                                Py_intptr_t *dims, Py_intptr_t *strides,
+                                const boost::shared_ptr<const void> &owner);
+
 /**
  * WrapReadOnly is a policy for VectorToNDArray
  * to wrap the vector in a read-only numpy array
@@ -15,6 +15,7 @@
 #define NO_IMPORT_ARRAY
 #include <numpy/arrayobject.h>
 
+#include <algorithm>
 #include <string>
 
 namespace {
@@ -29,6 +30,13 @@ template <typename T> void capsule_cleanup(PyObject *capsule) {
   delete[] memory;
 }
 
+/// Destructor for a capsule holding a shared pointer to the owner of the data
+/// of an array
+void owner_cleanup(PyObject *capsule) {
+  delete static_cast<boost::shared_ptr<const void> *>(
+      PyCapsule_GetPointer(capsule, nullptr));
+}
+
 } // namespace
 
 namespace Mantid {
@@ -114,6 +122,42 @@ INSTANTIATE_WRAPNUMPY(double)
 INSTANTIATE_WRAPNUMPY(float)
 ///@endcond
 } // namespace Impl
+
+template <typename ElementType>
+PyObject *wrapReadOnlyWithOwner(const ElementType *data, const int ndims,
+                                Py_intptr_t *dims, Py_intptr_t *strides,
+                                const boost::shared_ptr<const void> &owner) {
+  const bool empty = std::any_of(dims, dims + ndims,
+                                 [](const Py_intptr_t dim) { return dim == 0; });
+  // An empty array must still own a buffer, so numpy allocates one
+  void *buffer = empty ? nullptr : const_cast<ElementType *>(data);
+  auto *nparray = reinterpret_cast<PyArrayObject *>(PyArray_New(
+      &PyArray_Type, ndims, dims, NDArrayTypeIndex<ElementType>::typenum,
+      buffer ? strides : nullptr, buffer, 0, buffer ? NPY_ARRAY_ALIGNED : 0,
+      nullptr));
+  if (!nparray)
+    return nullptr;
+  Impl::markReadOnly(nparray);
+  if (buffer) {
+    PyObject *capsule = PyCapsule_New(new boost::shared_ptr<const void>(owner),
+                                      nullptr, owner_cleanup);
+    // The array steals the reference to its base
+    PyArray_SetBaseObject(nparray, capsule);
+  }
+  return reinterpret_cast<PyObject *>(nparray);
+}
+
+#define INSTANTIATE_WRAPWITHOWNER(ElementType)                                 \
+  template DLLExport PyObject *wrapReadOnlyWithOwner<ElementType>(             \
+      const ElementType *, const int, Py_intptr_t *, Py_intptr_t *,            \
+      const boost::shared_ptr<const void> &);
+
+///@cond Doxygen doesn't seem to like this...
+INSTANTIATE_WRAPWITHOWNER(long)
+INSTANTIATE_WRAPWITHOWNER(long long)
+INSTANTIATE_WRAPWITHOWNER(double)
+INSTANTIATE_WRAPWITHOWNER(float)
+///@endcond
 } // namespace Converters
 } // namespace PythonInterface
 } // namespace Mantid
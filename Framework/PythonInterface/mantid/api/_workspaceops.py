@@ -15,10 +15,12 @@ from __future__ import (absolute_import, division,
 
 import inspect as _inspect
 import sys
+import weakref
 
 from six import Iterator, get_function_code, iteritems
 
-from mantid.api import AnalysisDataServiceImpl, ITableWorkspace, Workspace, WorkspaceGroup, performBinaryOp
+from mantid.api import (AnalysisDataServiceImpl, IEventWorkspace, ITableWorkspace, MatrixWorkspace, Workspace,
+                        WorkspaceGroup, performBinaryOp)
 from mantid.kernel.funcinspect import customise_func, lhs_info
 
 
@@ -36,9 +38,12 @@ def attach_binary_operators_to_workspace():
         def op_wrapper(self, other):
             # Get the result variable to know what to call the output
             result_info = lhs_info()
+            # Only the expression being evaluated holds a reference to self
+            unreferenced = sys.getrefcount(self) <= _unreferenced_refcount
             # Pass off to helper
             return _do_binary_operation(algorithm, self, other, result_info,
-                                        inplace, reverse)
+                                        inplace, reverse, unreferenced,
+                                        _expression_key(_inspect.currentframe().f_back))
 
         op_wrapper.__name__ = attr
         setattr(Workspace, attr, op_wrapper)
@@ -73,9 +78,97 @@ def attach_binary_operators_to_workspace():
 _workspace_op_prefix = '__python_op_tmp'
 # A list of temporary workspaces created by algebraic operations
 _workspace_op_tmps = []
+# Arithmetic that can overwrite a temporary left-hand side rather than
+# create another one
+_workspace_op_fusable = ('Plus', 'Minus', 'Multiply', 'Divide')
+# The temporaries that may be overwritten, mapped to the expression that
+# created them and to the object that was returned for them
+_workspace_op_reusable = {}
 
 
-def _do_binary_operation(op, self, rhs, lhs_vars, inplace, reverse):
+def _probe_refcount(self, other):
+    return sys.getrefcount(self)
+
+
+class _RefcountProbe(object):
+    __add__ = _probe_refcount
+
+
+def _calibrate_unreferenced_refcount():
+    """
+        Returns the reference count of the self argument of a binary operator, as
+        seen by op_wrapper, when only the expression being evaluated refers to it.
+        Returns 0, so that temporaries are never reused, if one more reference
+        does not give a count one higher, as the reuse relies on that.
+    """
+    unreferenced = _RefcountProbe() + None
+    probe = _RefcountProbe()
+    referenced = probe + None
+    if unreferenced < 2 or referenced != unreferenced + 1:
+        return 0
+    return unreferenced
+
+
+_unreferenced_refcount = _calibrate_unreferenced_refcount()
+
+
+def _expression_key(frame):
+    """
+        Returns a key identifying the statement being evaluated in the given frame
+    """
+    return id(frame), frame.f_code, frame.f_lineno
+
+
+def _remember_temporary(name, resultws, expression):
+    """
+        Records that the temporary called name was created by the given expression
+        and returned as resultws
+    """
+    try:
+        _workspace_op_reusable[name] = (expression, weakref.ref(resultws))
+    except TypeError:
+        _workspace_op_reusable.pop(name, None)
+
+
+def _forget_retrieved_temporary(retrieve):
+    """
+        Wraps a retrieval method of the ADS so that a temporary that has been
+        fetched by name is never overwritten, as the caller may keep the handle
+    """
+    def wrapper(self, name):
+        _workspace_op_reusable.pop(name, None)
+        return retrieve(self, name)
+
+    wrapper.__name__ = retrieve.__name__
+    wrapper.__doc__ = retrieve.__doc__
+    return wrapper
+
+
+setattr(AnalysisDataServiceImpl, "__getitem__", _forget_retrieved_temporary(AnalysisDataServiceImpl.__getitem__))
+setattr(AnalysisDataServiceImpl, "retrieve", _forget_retrieved_temporary(AnalysisDataServiceImpl.retrieve))
+
+
+def _can_reuse_temporary(op, self, rhs, reverse, expression):
+    """
+        Returns True if the result of op can overwrite self. The result of an
+        operation on an event workspace may be a Workspace2D, which cannot be
+        stored in place of the event workspace, so those are never reused.
+
+        The reference count of self, checked by op_wrapper, only tells whether
+        Python variables refer to this handle. A second handle to the same
+        workspace, e.g. from mtd[name], is not counted, so self must also be the
+        object returned when the temporary was created by the statement being
+        evaluated, and the temporary must not have been retrieved from the ADS
+        since. Anything else is given a new temporary.
+    """
+    if (reverse or op not in _workspace_op_fusable or not isinstance(self, MatrixWorkspace)
+            or isinstance(self, IEventWorkspace) or isinstance(rhs, IEventWorkspace)):
+        return False
+    created = _workspace_op_reusable.get(self.name())
+    return created is not None and created[0] == expression and created[1]() is self
+
+
+def _do_binary_operation(op, self, rhs, lhs_vars, inplace, reverse, unreferenced=False, expression=None):
     """
         Perform the given binary operation
 
@@ -85,6 +178,9 @@ def _do_binary_operation(op, self, rhs, lhs_vars, inplace, reverse):
         :param lhs_vars: A tuple containing details of the lhs of the assignment, i.e a = b + c, lhs_vars = (1, 'a')
         :param inplace: True if the operation should be performed inplace
         :param reverse: True if the reverse operator was called, i.e. 3 + a calls __radd__
+        :param unreferenced: True if nothing but the expression being evaluated refers to self
+        :param expression: A key identifying the statement being evaluated. Temporaries are only
+                           overwritten by the statement that created them
 
     """
     global _workspace_op_tmps
@@ -97,6 +193,13 @@ def _do_binary_operation(op, self, rhs, lhs_vars, inplace, reverse):
         else:
             output_name = lhs_vars[1][0]
         clear_tmps = True
+    elif unreferenced and expression is not None and _can_reuse_temporary(op, self, rhs, reverse, expression):
+        # self is the result of an earlier operation in this expression that
+        # nothing else can see, e.g. ws * a in ws * a + b, so overwrite it
+        # rather than create another temporary workspace
+        clear_tmps = False
+        inplace = True
+        output_name = self.name()
     else:
         # Give it a temporary name and keep track of it
         clear_tmps = False
@@ -112,6 +215,7 @@ def _do_binary_operation(op, self, rhs, lhs_vars, inplace, reverse):
             if name in ads and output_name != name:
                 del ads[name]
         _workspace_op_tmps = []
+        _workspace_op_reusable.clear()
     else:
         if type(resultws) == WorkspaceGroup:
             # Ensure the members are removed aswell
@@ -119,7 +223,10 @@ def _do_binary_operation(op, self, rhs, lhs_vars, inplace, reverse):
             for member in members:
                 _workspace_op_tmps.append(member)
         else:
-            _workspace_op_tmps.append(output_name)
+            if output_name not in _workspace_op_tmps:
+                _workspace_op_tmps.append(output_name)
+            if expression is not None:
+                _remember_temporary(output_name, resultws, expression)
 
     return resultws  # For self-assignment this will be set to the same workspace
 
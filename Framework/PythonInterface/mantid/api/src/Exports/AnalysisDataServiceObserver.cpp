@@ -51,5 +51,10 @@ void export_AnalysisDataServiceObserver() {
            &AnalysisDataServiceObserverAdapter::observeGroupUpdate,
            (arg("self"), arg("on")),
            "Observe AnalysisDataService for a group being updated by being "
-           "added to or removed from");
+           "added to or removed from")
+      .def("batchNotifications",
+           &AnalysisDataServiceObserverAdapter::batchNotifications,
+           (arg("self"), arg("on")),
+           "Hold back the changes made while a synchronous top-level "
+           "algorithm runs and deliver them together when it finishes");
 }
\ No newline at end of file
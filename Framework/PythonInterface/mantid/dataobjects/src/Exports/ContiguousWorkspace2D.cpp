@@ -0,0 +1,88 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidDataObjects/ContiguousWorkspace2D.h"
+#include "MantidPythonInterface/core/Converters/WrapWithNDArray.h"
+#include "MantidPythonInterface/core/ExtractWorkspace.h"
+#include "MantidPythonInterface/core/GetPointer.h"
+#include "MantidPythonInterface/kernel/Registry/RegisterWorkspacePtrToPython.h"
+
+#include <boost/make_shared.hpp>
+#include <boost/python/class.hpp>
+
+#include <algorithm>
+
+using Mantid::DataObjects::ContiguousWorkspace2D;
+using Mantid::DataObjects::ContiguousWorkspace2D_const_sptr;
+using Mantid::DataObjects::Workspace2D;
+using Mantid::PythonInterface::ExtractWorkspace;
+using Mantid::PythonInterface::Converters::wrapReadOnlyWithOwner;
+using namespace Mantid::PythonInterface::Registry;
+using namespace boost::python;
+
+GET_POINTER_SPECIALIZATION(ContiguousWorkspace2D)
+
+namespace {
+/// The workspace held by the Python object of a ContiguousWorkspace2D
+ContiguousWorkspace2D_const_sptr workspace(const object &self) {
+  return boost::dynamic_pointer_cast<const ContiguousWorkspace2D>(
+      ExtractWorkspace(self)());
+}
+
+/**
+ * Wrap a block of the workspace in a read-only 2D numpy array with one row
+ * per spectrum, whose base object holds the workspace. If some spectra have
+ * been moved out of the blocks, their rows are out of date, so the array
+ * holds a copy of the values of every spectrum instead.
+ * @param ws :: The workspace
+ * @param block :: The block of Y or E values
+ * @param row :: Returns the values of a spectrum, wherever they are held
+ */
+PyObject *wrapBlock(const ContiguousWorkspace2D_const_sptr &ws,
+                    const std::vector<double> &block,
+                    const double *(ContiguousWorkspace2D::*row)(const size_t)
+                        const) {
+  const size_t numberOfRows = ws->getNumberHistograms();
+  const size_t rowLength = ws->rowLength();
+  Py_intptr_t dims[2] = {static_cast<Py_intptr_t>(numberOfRows),
+                         static_cast<Py_intptr_t>(rowLength)};
+  if (ws->allInBlocks())
+    return wrapReadOnlyWithOwner(block.data(), 2, dims, nullptr, ws);
+  auto values = boost::make_shared<std::vector<double>>(numberOfRows *
+                                                        rowLength);
+  for (size_t i = 0; i < numberOfRows; ++i)
+    std::copy_n(((*ws).*row)(i), rowLength, values->begin() + i * rowLength);
+  return wrapReadOnlyWithOwner(values->data(), 2, dims, nullptr, values);
+}
+
+PyObject *readYBlock(const object &self) {
+  const auto ws = workspace(self);
+  return wrapBlock(ws, ws->blockY(), &ContiguousWorkspace2D::rowY);
+}
+
+PyObject *readEBlock(const object &self) {
+  const auto ws = workspace(self);
+  return wrapBlock(ws, ws->blockE(), &ContiguousWorkspace2D::rowE);
+}
+} // namespace
+
+void export_ContiguousWorkspace2D() {
+  class_<ContiguousWorkspace2D, bases<Workspace2D>, boost::noncopyable>(
+      "ContiguousWorkspace2D", no_init)
+      .def("readYBlock", &readYBlock, arg("self"),
+           "Returns a read-only 2D array of the Y values of all spectra, one "
+           "row per spectrum, that looks at the workspace without copying "
+           "it and keeps it alive. If the values of some spectra have been "
+           "moved out of the contiguous blocks, it is a copy.")
+      .def("readEBlock", &readEBlock, arg("self"),
+           "Returns a read-only 2D array of the E values of all spectra, one "
+           "row per spectrum, that looks at the workspace without copying "
+           "it and keeps it alive. If the values of some spectra have been "
+           "moved out of the contiguous blocks, it is a copy.");
+
+  // register pointers
+  RegisterWorkspacePtrToPython<ContiguousWorkspace2D>();
+}
@@ -5,6 +5,8 @@
 //     & Institut Laue - Langevin
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "MantidDataObjects/EventWorkspace.h"
+#include "MantidPythonInterface/core/Converters/WrapWithNDArray.h"
+#include "MantidPythonInterface/core/ExtractWorkspace.h"
 #include "MantidPythonInterface/core/GetPointer.h"
 #include "MantidPythonInterface/kernel/Registry/RegisterWorkspacePtrToPython.h"
 
@@ -13,14 +15,77 @@
 
 using Mantid::API::IEventWorkspace;
 using Mantid::DataObjects::EventWorkspace;
+using Mantid::DataObjects::EventWorkspace_const_sptr;
+using Mantid::PythonInterface::ExtractWorkspace;
+using Mantid::PythonInterface::Converters::wrapReadOnlyWithOwner;
 using namespace Mantid::PythonInterface::Registry;
 using namespace boost::python;
 
 GET_POINTER_SPECIALIZATION(EventWorkspace)
 
+namespace {
+/// The workspace held by the Python object of an EventWorkspace
+EventWorkspace_const_sptr workspace(const object &self) {
+  return boost::dynamic_pointer_cast<const EventWorkspace>(
+      ExtractWorkspace(self)());
+}
+
+/**
+ * Wrap one field of the events of a spectrum in a read-only numpy array,
+ * whose base object holds the workspace
+ * @param view :: The field and the workspace that holds it
+ */
+template <typename T>
+PyObject *wrapField(const EventWorkspace::EventFieldView<T> &view) {
+  Py_intptr_t dims[1] = {static_cast<Py_intptr_t>(view.field.size)};
+  Py_intptr_t strides[1] = {static_cast<Py_intptr_t>(view.field.stride)};
+  return wrapReadOnlyWithOwner(view.field.data, 1, dims, strides,
+                               view.workspace);
+}
+
+PyObject *getTofsView(const object &self, const size_t index) {
+  return wrapField(EventWorkspace::tofView(workspace(self), index));
+}
+
+PyObject *getWeightsView(const object &self, const size_t index) {
+  return wrapField(EventWorkspace::weightView(workspace(self), index));
+}
+
+PyObject *getErrorSquaredView(const object &self, const size_t index) {
+  return wrapField(EventWorkspace::errorSquaredView(workspace(self), index));
+}
+
+PyObject *getPulseTimesView(const object &self, const size_t index) {
+  return wrapField(EventWorkspace::pulseTimeView(workspace(self), index));
+}
+} // namespace
+
 void export_EventWorkspace() {
   class_<EventWorkspace, bases<IEventWorkspace>, boost::noncopyable>(
-      "EventWorkspace", no_init);
+      "EventWorkspace", no_init)
+      .def("getTofsView", &getTofsView, (arg("self"), arg("workspaceIndex")),
+           "Returns a read-only array of the TOFs of the events of a "
+           "spectrum that looks at the events without copying them. It "
+           "keeps the workspace alive. Changing the events, for example by "
+           "running an algorithm on the workspace in place, changes what it "
+           "shows.")
+      .def("getWeightsView", &getWeightsView,
+           (arg("self"), arg("workspaceIndex")),
+           "Returns a read-only array of the weights of the events of a "
+           "spectrum that looks at the events without copying them. It keeps "
+           "the workspace alive. Unweighted events have a weight of 1.")
+      .def("getErrorSquaredView", &getErrorSquaredView,
+           (arg("self"), arg("workspaceIndex")),
+           "Returns a read-only array of the squared errors of the weights of "
+           "the events of a spectrum that looks at the events without "
+           "copying them. It keeps the workspace alive. Unweighted events "
+           "have a squared error of 1.")
+      .def("getPulseTimesView", &getPulseTimesView,
+           (arg("self"), arg("workspaceIndex")),
+           "Returns a read-only array of the pulse times of the events of a "
+           "spectrum, in nanoseconds since 1990-01-01, that looks at the "
+           "events without copying them. It keeps the workspace alive. "
+           "Events without pulse times have a time of 0.");
 
   // register pointers
   RegisterWorkspacePtrToPython<EventWorkspace>();
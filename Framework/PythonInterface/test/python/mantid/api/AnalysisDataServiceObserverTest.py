@@ -238,6 +238,21 @@ class AnalysisDataServiceObserverTest(unittest.TestCase):
 
         self.assertEqual(self.fake_class.groupUpdateHandle.call_count, 1)
 
+    def test_batchNotifications_calls_anyChangeHandle_once_per_algorithm(self):
+        CreateSampleWorkspace(OutputWorkspace="ws1")
+        CreateSampleWorkspace(OutputWorkspace="ws2")
+        self.fake_class.observeAll(True)
+        self.fake_class.batchNotifications(True)
+        self.fake_class.groupHandle = mock.MagicMock()
+        self.fake_class.addHandle = mock.MagicMock()
+
+        GroupWorkspaces(InputWorkspaces="ws1,ws2", OutputWorkspace="NewGroup")
+        self.fake_class.batchNotifications(False)
+
+        self.assertEqual(self.fake_class.anyChangeHandle.call_count, 1)
+        self.assertEqual(self.fake_class.groupHandle.call_count, 1)
+        self.assertEqual(self.fake_class.addHandle.call_count, 1)
+
 
 if __name__ == "__main__":
     unittest.main()
@@ -6,7 +6,8 @@
 # SPDX - License - Identifier: GPL - 3.0 +
 from __future__ import (absolute_import, division, print_function)
 
-from mantid.api import mtd
+from mantid.api import mtd, _workspaceops
+from mantid.py3compat import mock
 from mantid.simpleapi import CreateSampleWorkspace
 import unittest
 
@@ -40,5 +41,61 @@ class WorkspaceBinaryOpsTest(unittest.TestCase):
         ws_ads += 1
         self.assertTrue(mtd.doesExist('ws_ads'))
 
+    def test_chained_operations_leave_inputs_unchanged(self):
+        ws = CreateSampleWorkspace()
+        initialY = ws.readY(0)[0]
+        result = ws * 2. + ws / 2. - 1.
+        self.assertAlmostEqual(result.readY(0)[0], 2.5 * initialY - 1.)
+        self.assertEqual(ws.readY(0)[0], initialY)
+        self.assertFalse(mtd.doesExist('__python_op_tmp0'))
+        self.assertFalse(mtd.doesExist('__python_op_tmp1'))
+
+    def test_referenced_temporaries_are_not_overwritten(self):
+        ws = CreateSampleWorkspace()
+        initialY = ws.readY(0)[0]
+        temporaries = []
+        temporaries.append(ws * 2.)
+        result = temporaries[0] * 3. + 1.
+        self.assertAlmostEqual(result.readY(0)[0], 6. * initialY + 1.)
+        self.assertAlmostEqual(temporaries[0].readY(0)[0], 2. * initialY)
+
+    def test_temporaries_retrieved_from_the_ADS_are_not_overwritten(self):
+        ws = CreateSampleWorkspace()
+        initialY = ws.readY(0)[0]
+        handles = []
+
+        def hold(temporary):
+            handles.append(mtd[temporary.name()])
+            return temporary
+
+        result = hold(ws * 2.) * 3. + 1.
+        self.assertAlmostEqual(result.readY(0)[0], 6. * initialY + 1.)
+        self.assertAlmostEqual(handles[0].readY(0)[0], 2. * initialY)
+
+    def test_chained_operations_on_event_workspaces(self):
+        ev = CreateSampleWorkspace(WorkspaceType='Event')
+        hist = CreateSampleWorkspace()
+        initialY = ev.readY(0)[0]
+        histY = hist.readY(0)[0]
+        result1 = ev * 2. + 1.
+        self.assertAlmostEqual(result1.readY(0)[0], 2. * initialY + 1.)
+        result2 = ev * 2. + hist
+        self.assertAlmostEqual(result2.readY(0)[0], 2. * initialY + histY)
+        result3 = ev * 2. - hist
+        self.assertAlmostEqual(result3.readY(0)[0], 2. * initialY - histY)
+        result4 = hist * 2. + ev
+        self.assertAlmostEqual(result4.readY(0)[0], 2. * histY + initialY)
+        self.assertEqual(ev.id(), 'EventWorkspace')
+        self.assertAlmostEqual(ev.readY(0)[0], initialY)
+
+    def test_unreferenced_left_operands_are_detected(self):
+        ws = CreateSampleWorkspace()
+        with mock.patch.object(_workspaceops, '_do_binary_operation') as binary_op:
+            ws * 2.
+            CreateSampleWorkspace(OutputWorkspace='unreferenced') * 2.
+        # The seventh argument is whether only the expression refers to self
+        self.assertEqual([call[0][6] for call in binary_op.call_args_list], [False, True])
+
+
 if __name__ == '__main__':
     unittest.main()
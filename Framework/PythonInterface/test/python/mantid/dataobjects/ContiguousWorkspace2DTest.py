@@ -0,0 +1,54 @@
+# Mantid Repository : https://github.com/mantidproject/mantid
+#
+# Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+#     NScD Oak Ridge National Laboratory, European Spallation Source
+#     & Institut Laue - Langevin
+# SPDX - License - Identifier: GPL - 3.0 +
+# pylint: disable=invalid-name, too-many-public-methods
+from __future__ import (absolute_import, division, print_function)
+
+import unittest
+
+import numpy as np
+
+from mantid.dataobjects import ContiguousWorkspace2D
+from mantid.simpleapi import ConvertToMatrixWorkspace, CreateSampleWorkspace
+
+
+class ContiguousWorkspace2DTest(unittest.TestCase):
+
+    def createWorkspace(self):
+        events = CreateSampleWorkspace(WorkspaceType='Event', NumBanks=1, BankPixelWidth=2,
+                                       NumEvents=20, StoreInADS=False)
+        return ConvertToMatrixWorkspace(events, StoreInADS=False)
+
+    def test_converted_event_workspace_is_contiguous(self):
+        self.assertTrue(isinstance(self.createWorkspace(), ContiguousWorkspace2D))
+
+    def test_block_views_hold_all_spectra(self):
+        ws = self.createWorkspace()
+        y = ws.readYBlock()
+        e = ws.readEBlock()
+        self.assertEqual(y.shape, (ws.getNumberHistograms(), ws.blocksize()))
+        self.assertFalse(y.flags.writeable)
+        self.assertFalse(e.flags.writeable)
+        self.assertTrue(np.array_equal(y, ws.extractY()))
+        self.assertTrue(np.array_equal(e, ws.extractE()))
+
+    def test_block_views_keep_the_workspace_alive(self):
+        ws = self.createWorkspace()
+        expected = ws.extractY()
+        y = ws.readYBlock()
+        del ws
+        self.assertTrue(np.array_equal(y, expected))
+
+    def test_block_views_copy_once_spectra_are_moved_out(self):
+        ws = self.createWorkspace()
+        ws.dataY(1)[0] = -1.
+        y = ws.readYBlock()
+        self.assertEqual(y[1][0], -1.)
+        self.assertTrue(np.array_equal(y, ws.extractY()))
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,61 @@
+# Mantid Repository : https://github.com/mantidproject/mantid
+#
+# Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+#     NScD Oak Ridge National Laboratory, European Spallation Source
+#     & Institut Laue - Langevin
+# SPDX - License - Identifier: GPL - 3.0 +
+# pylint: disable=invalid-name, too-many-public-methods
+from __future__ import (absolute_import, division, print_function)
+
+import unittest
+
+import numpy as np
+
+from mantid.simpleapi import CreateSampleWorkspace, Scale
+
+
+class EventWorkspaceTest(unittest.TestCase):
+
+    def createWorkspace(self):
+        return CreateSampleWorkspace(WorkspaceType='Event', NumBanks=1, BankPixelWidth=2,
+                                     NumEvents=20, StoreInADS=False)
+
+    def test_views_look_at_tof_events(self):
+        ws = self.createWorkspace()
+        spectrum = ws.getSpectrum(1)
+
+        tofs = ws.getTofsView(1)
+        self.assertTrue(np.array_equal(tofs, spectrum.getTofs()))
+        self.assertFalse(tofs.flags.writeable)
+        self.assertTrue(np.array_equal(ws.getPulseTimesView(1),
+                                       [time.totalNanoseconds() for time in spectrum.getPulseTimes()]))
+        self.assertTrue(np.array_equal(ws.getWeightsView(1), np.ones(len(tofs))))
+        self.assertTrue(np.array_equal(ws.getErrorSquaredView(1), np.ones(len(tofs))))
+
+    def test_views_look_at_weighted_events(self):
+        ws = Scale(self.createWorkspace(), Factor=2., StoreInADS=False)
+        spectrum = ws.getSpectrum(0)
+
+        self.assertTrue(np.array_equal(ws.getTofsView(0), spectrum.getTofs()))
+        self.assertTrue(np.array_equal(ws.getWeightsView(0), spectrum.getWeights()))
+        self.assertTrue(np.array_equal(np.sqrt(ws.getErrorSquaredView(0)), spectrum.getWeightErrors()))
+
+    def test_views_keep_the_workspace_alive(self):
+        ws = self.createWorkspace()
+        expected = ws.getSpectrum(2).getTofs()
+        tofs = ws.getTofsView(2)
+        del ws
+        self.assertTrue(np.array_equal(tofs, expected))
+
+    def test_views_cannot_be_written(self):
+        tofs = self.createWorkspace().getTofsView(0)
+        with self.assertRaises(ValueError):
+            tofs[0] = 1.
+
+    def test_view_of_a_workspace_index_out_of_range_raises(self):
+        ws = self.createWorkspace()
+        self.assertRaises(RuntimeError, ws.getTofsView, ws.getNumberHistograms())
+
+
+if __name__ == '__main__':
+    unittest.main()